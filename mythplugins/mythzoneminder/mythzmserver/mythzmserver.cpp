@@ -16,6 +16,7 @@
 #include <arpa/inet.h>
 #include <algorithm>
 #include <array>
+#include <cerrno>
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
@@ -25,10 +26,12 @@
 #include <map>
 #include <netinet/in.h>
 #include <string>
+#include <sys/epoll.h>
 #include <sys/socket.h>
 #include <sys/time.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <vector>
 
 #include "zmserver.h"
 
@@ -55,11 +58,10 @@ enum EXIT_CODES : std::uint8_t {
 
 int main(int argc, char **argv)
 {
-    fd_set master;                  // master file descriptor list
-    fd_set read_fds;                // temp file descriptor list for select()
+    std::array<struct epoll_event,64> events {}; // events from epoll_wait()
     struct sockaddr_in myaddr {};   // server address
     struct sockaddr_in remoteaddr {};// client address
-    int fdmax = -1;                 // maximum file descriptor number
+    int epfd = -1;                  // epoll file descriptor
     int listener = -1;              // listening socket descriptor
     int newfd = -1;                 // newly accept()ed socket descriptor
     std::array<char,4096> buf {};   // buffer for client data
@@ -260,9 +262,13 @@ int main(int argc, char **argv)
     // connect to the DB
     connectToDatabase();
 
-    // clear the master and temp sets
-    FD_ZERO(&master);   // NOLINT(readability-isolate-declaration)
-    FD_ZERO(&read_fds); // NOLINT(readability-isolate-declaration)
+    // get the epoll instance
+    epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (epfd == -1)
+    {
+        perror("epoll_create1");
+        return EXIT_SOCKET_ERROR;
+    }
 
     // get the listener
     listener = socket(AF_INET, SOCK_STREAM, 0);
@@ -300,105 +306,182 @@ int main(int argc, char **argv)
 
     std::cout << "Listening on port: " << port << '\n';
 
-    // add the listener to the master set
-    FD_SET(listener, &master);
+    // watch the listener for new connections
+    struct epoll_event ev {};
+    ev.events = EPOLLIN;
+    ev.data.fd = listener;
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, listener, &ev) == -1)
+    {
+        perror("epoll_ctl");
+        return EXIT_SOCKET_ERROR;
+    }
+
+    // clients we are currently waiting on to accept more data
+    std::map<int, bool> writeWanted;
+
+    auto closeClient = [&](int fd)
+    {
+        epoll_ctl(epfd, EPOLL_CTL_DEL, fd, nullptr);
+        close(fd);
 
-    // keep track of the biggest file descriptor
-    fdmax = listener; // so far, it's this one
+        // remove from server list
+        delete serverList[fd];
+        serverList.erase(fd);
+        writeWanted.erase(fd);
+    };
 
     // main loop
     while (!quit)
     {
-        // the maximum time select() should wait
-        struct timeval timeout {.tv_sec=DB_CHECK_TIME.count(), .tv_usec=0};
+        bool subscribed = std::any_of(serverList.cbegin(), serverList.cend(),
+            [](const auto & server) { return server.second->hasLiveSubscriptions(); });
 
-        read_fds = master; // copy it
-        int res = select(fdmax+1, &read_fds, nullptr, nullptr, &timeout);
+        // the maximum time epoll_wait() should wait
+        auto timeout = subscribed
+            ? LIVE_FRAME_CHECK_TIME
+            : std::chrono::duration_cast<std::chrono::milliseconds>(DB_CHECK_TIME);
+
+        int res = epoll_wait(epfd, events.data(), events.size(), timeout.count());
 
         if (res == -1)
         {
-            perror("select");
+            if (errno == EINTR)
+                continue;
+            perror("epoll_wait");
             return EXIT_SOCKET_ERROR;
         }
-        if (res == 0)
+        if (res == 0 && !subscribed)
         {
-            // select timed out
+            // epoll_wait timed out
             // just kick the DB connection to keep it alive
             kickDatabase(debug);
             continue;
         }
 
-        // run through the existing connections looking for data to read
-        for (int i = 0; i <= fdmax; i++)
+        // run through the connections that have something for us
+        for (int n = 0; n < res && !quit; n++)
         {
-            if (FD_ISSET(i, &read_fds))
+            int i = events[n].data.fd;
+
+            if (i == listener)
             {
-                // we got one!!
-                if (i == listener) 
+                // handle new connections
+                socklen_t addrlen = sizeof(remoteaddr);
+                newfd = accept(listener, (struct sockaddr *) &remoteaddr,
+                               &addrlen);
+                if (newfd == -1)
                 {
-                    // handle new connections
-                    socklen_t addrlen = sizeof(remoteaddr);
-                    newfd = accept(listener, (struct sockaddr *) &remoteaddr,
-                                   &addrlen);
-                    if (newfd == -1)
-                    {
-                        perror("accept");
-                    }
-                    else
-                    {
-                        // add to master set
-                        FD_SET(newfd, &master);
-                        fdmax = std::max(newfd, fdmax); // keep track of the maximum
+                    perror("accept");
+                    continue;
+                }
 
-                        // create new ZMServer and add to map
-                        auto *server = new ZMServer(newfd, debug);
-                        serverList[newfd] = server;
+                // replies and pushed frames are written without blocking
+                fcntl(newfd, F_SETFL, fcntl(newfd, F_GETFL) | O_NONBLOCK);
 
-                        printf("new connection from %s on socket %d\n",
-                               inet_ntoa(remoteaddr.sin_addr), newfd);
-                    }
+                ev.events = EPOLLIN;
+                ev.data.fd = newfd;
+                if (epoll_ctl(epfd, EPOLL_CTL_ADD, newfd, &ev) == -1)
+                {
+                    perror("epoll_ctl");
+                    close(newfd);
+                    continue;
+                }
+
+                // create new ZMServer and add to map
+                auto *server = new ZMServer(newfd, debug);
+                serverList[newfd] = server;
+
+                printf("new connection from %s on socket %d\n",
+                       inet_ntoa(remoteaddr.sin_addr), newfd);
+                continue;
+            }
+
+            if (!serverList.contains(i))
+                continue;
+
+            ZMServer *server = serverList[i];
+
+            if (events[n].events & EPOLLOUT)
+            {
+                if (!server->flushSendQueue())
+                {
+                    perror("send");
+                    closeClient(i);
+                    continue;
                 }
-                else
+            }
+
+            if (events[n].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+            {
+                // handle data from a client
+                int nbytes = recv(i, buf.data(), buf.size() - 1, 0);
+                if (nbytes == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                    continue;
+
+                if (nbytes <= 0)
                 {
-                    // handle data from a client
-                    int nbytes = recv(i, buf.data(), buf.size(), 0);
-                    if (nbytes <= 0)
+                    // got error or connection closed by client
+                    if (nbytes == 0)
                     {
-                        // got error or connection closed by client
-                        if (nbytes == 0)
-                        {
-                            // connection closed
-                            printf("socket %d hung up\n", i);
-                        }
-                        else
-                        {
-                            perror("recv");
-                        }
-
-                        // remove from master set
-                        FD_CLR(i, &master);
-
-                        close(i);
-
-                        // remove from server list
-                        ZMServer *server = serverList[i];
-                        delete server;
-                        serverList.erase(i);
+                        // connection closed
+                        printf("socket %d hung up\n", i);
                     }
                     else
                     {
-                        ZMServer *server = serverList[i];
-                        quit = server->processRequest(buf.data(), nbytes);
+                        perror("recv");
                     }
+
+                    closeClient(i);
+                    continue;
                 }
+
+                quit = server->processRequest(buf.data(), nbytes);
+            }
+        }
+
+        if (subscribed)
+        {
+            // the live view doesn't otherwise touch the DB so make sure
+            // the connection doesn't timeout
+            kickDatabase(debug);
+
+            // push any new frames to the subscribers
+            for (auto & server : serverList)
+            {
+                if (server.second->hasLiveSubscriptions())
+                    server.second->pushLiveFrames();
+            }
+        }
+
+        // only wait for the sockets to drain while we have something queued
+        std::vector<int> failed;
+        for (auto & [fd, server] : serverList)
+        {
+            bool wanted = server->hasPendingData();
+            if (wanted == writeWanted[fd])
+                continue;
+
+            ev.events = wanted ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+            ev.data.fd = fd;
+            if (epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &ev) == -1)
+            {
+                perror("epoll_ctl");
+                failed.push_back(fd);
+                continue;
             }
+            writeWanted[fd] = wanted;
         }
+
+        for (int fd : failed)
+            closeClient(fd);
     }
 
     // cleanly remove all the ZMServer's
     for (auto & server : serverList)
         delete server.second;
 
+    close(epfd);
+
     mysql_close(&g_dbConn);
 
     return EXIT_OK;
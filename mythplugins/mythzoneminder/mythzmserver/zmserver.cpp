@@ -660,6 +660,10 @@ bool ZMServer::processRequest(char* buf, int nbytes)
         handleGetAnalysisFrame(tokens);
     else if (tokens[0] == "GET_LIVE_FRAME")
         handleGetLiveFrame(tokens);
+    else if (tokens[0] == "SUBSCRIBE_LIVE_FRAMES")
+        handleSubscribeLiveFrames(tokens);
+    else if (tokens[0] == "UNSUBSCRIBE_LIVE_FRAMES")
+        handleUnsubscribeLiveFrames(tokens);
     else if (tokens[0] == "GET_FRAME_LIST")
         handleGetFrameList(tokens);
     else if (tokens[0] == "GET_CAMERA_LIST")
@@ -680,37 +684,89 @@ bool ZMServer::processRequest(char* buf, int nbytes)
     return false;
 }
 
-bool ZMServer::send(const std::string &s) const
+// length followed by the message followed by any data
+std::string ZMServer::buildMessage(const std::string &s,
+                                   const unsigned char *buffer, int dataLen)
 {
-    // send length
     std::string str = "0000000" + std::to_string(s.size());
     str.erase(0, str.size()-8);
-    int status = ::send(m_sock, str.data(), 8, MSG_NOSIGNAL);
-    if (status == -1)
-        return false;
+    str.reserve(str.size() + s.size() + dataLen);
+    str += s;
+    if (buffer)
+        str.append(reinterpret_cast<const char*>(buffer), dataLen);
+    return str;
+}
 
-    // send message
-    status = ::send(m_sock, s.c_str(), s.size(), MSG_NOSIGNAL);
-    return status != -1;
+bool ZMServer::send(const std::string &s)
+{
+    return queueMessage(buildMessage(s));
 }
 
-bool ZMServer::send(const std::string &s, const unsigned char *buffer, int dataLen) const
+bool ZMServer::send(const std::string &s, const unsigned char *buffer, int dataLen)
 {
-    // send length
-    std::string str = "0000000" + std::to_string(s.size());
-    str.erase(0, str.size()-8);
-    int status = ::send(m_sock, str.data(), 8, MSG_NOSIGNAL);
-    if (status == -1)
-        return false;
+    return queueMessage(buildMessage(s, buffer, dataLen));
+}
 
-    // send message
-    status = ::send(m_sock, s.c_str(), s.size(), MSG_NOSIGNAL);
-    if ( status == -1 )
+bool ZMServer::queueMessage(std::string data, int monitorId)
+{
+    if (m_sendFailed)
         return false;
 
-    // send data
-    status = ::send(m_sock, buffer, dataLen, MSG_NOSIGNAL);
-    return status != -1;
+    if (monitorId != -1)
+    {
+        // a slow client only ever gets the latest frame from a monitor so
+        // replace any pushed frame that hasn't started going out yet
+        for (auto & msg : m_sendQueue)
+        {
+            if (msg.m_monitorId == monitorId && msg.m_offset == 0)
+            {
+                m_queuedBytes -= msg.m_data.size();
+                m_queuedBytes += data.size();
+                msg.m_data = std::move(data);
+                return true;
+            }
+        }
+
+        if (m_queuedBytes + data.size() > MAX_QUEUED_BYTES)
+        {
+            if (m_debug)
+                std::cout << "Client on socket " << m_sock << " is too slow, dropping frame\n";
+            return true;
+        }
+    }
+
+    m_queuedBytes += data.size();
+    m_sendQueue.push_back({std::move(data), 0, monitorId});
+
+    return flushSendQueue();
+}
+
+// returns false if the socket has failed
+bool ZMServer::flushSendQueue(void)
+{
+    while (!m_sendQueue.empty())
+    {
+        OutMessage &msg = m_sendQueue.front();
+        ssize_t status = ::send(m_sock, msg.m_data.data() + msg.m_offset,
+                                msg.m_data.size() - msg.m_offset, MSG_NOSIGNAL);
+        if (status == -1)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+                return true;
+
+            m_sendFailed = true;
+            return false;
+        }
+
+        msg.m_offset += status;
+        if (msg.m_offset < msg.m_data.size())
+            continue;
+
+        m_queuedBytes -= msg.m_data.size();
+        m_sendQueue.pop_front();
+    }
+
+    return true;
 }
 
 void ZMServer::sendError(const std::string &error)
@@ -1445,6 +1501,121 @@ void ZMServer::handleGetLiveFrame(std::vector<std::string> tokens)
     send(outStr, s_buffer.data(), dataSize);
 }
 
+// SUBSCRIBE_LIVE_FRAMES[]:[]monitorID[]:[]scale
+//
+// After the OK reply every new frame written by the monitor is pushed to
+// the client unrequested as
+// LIVE_FRAME[]:[]monitorID[]:[]status[]:[]width[]:[]height[]:[]dataSize
+// followed by the RGB24 data, downscaled by 'scale' in each direction.
+void ZMServer::handleSubscribeLiveFrames(std::vector<std::string> tokens)
+{
+    if (tokens.size() != 3)
+    {
+        sendError(ERROR_TOKEN_COUNT);
+        return;
+    }
+
+    int monitorID = atoi(tokens[1].c_str());
+    int scale = std::clamp(atoi(tokens[2].c_str()), 1, MAX_LIVE_FRAME_SCALE);
+
+    if (m_debug)
+    {
+        std::cout << "Subscribing to live frames from monitor: " << monitorID
+                  << " scale: " << scale << '\n';
+    }
+
+    auto it = m_monitorMap.find(monitorID);
+    if (it == m_monitorMap.end())
+    {
+        sendError(ERROR_INVALID_MONITOR);
+        return;
+    }
+
+    if (!it->second->isValid())
+    {
+        sendError(ERROR_INVALID_POINTERS);
+        return;
+    }
+
+    m_liveSubscriptions[monitorID] = scale;
+
+    std::string outStr;
+    ADD_STR(outStr, "OK");
+    ADD_INT(outStr, monitorID);
+    ADD_INT(outStr, scale);
+    send(outStr);
+}
+
+// UNSUBSCRIBE_LIVE_FRAMES[]:[]monitorID
+//
+// A monitorID of -1 cancels all subscriptions. Frames already queued for the
+// client may still arrive after the OK reply.
+void ZMServer::handleUnsubscribeLiveFrames(std::vector<std::string> tokens)
+{
+    if (tokens.size() != 2)
+    {
+        sendError(ERROR_TOKEN_COUNT);
+        return;
+    }
+
+    int monitorID = atoi(tokens[1].c_str());
+
+    if (m_debug)
+        std::cout << "Unsubscribing from live frames from monitor: " << monitorID << '\n';
+
+    if (monitorID == -1)
+        m_liveSubscriptions.clear();
+    else
+        m_liveSubscriptions.erase(monitorID);
+
+    std::string outStr;
+    ADD_STR(outStr, "OK");
+    ADD_INT(outStr, monitorID);
+    send(outStr);
+}
+
+void ZMServer::pushLiveFrames(void)
+{
+    static FrameData s_buffer {};
+    static FrameData s_scaled {};
+
+    for (auto [monitorID, scale] : m_liveSubscriptions)
+    {
+        auto it = m_monitorMap.find(monitorID);
+        if (it == m_monitorMap.end() || !it->second->isValid())
+            continue;
+        MONITOR *monitor = it->second;
+
+        // getFrame() returns 0 if nothing new has been written
+        int dataSize = getFrame(s_buffer, monitor);
+        if (dataSize == 0)
+            continue;
+
+        const unsigned char *data = s_buffer.data();
+        int width = monitor->m_width;
+        int height = monitor->m_height;
+
+        if (scale > 1)
+        {
+            dataSize = scaleFrame(s_buffer, s_scaled, width, height, scale);
+            data = s_scaled.data();
+            width /= scale;
+            height /= scale;
+        }
+
+        std::string outStr;
+        ADD_STR(outStr, "LIVE_FRAME");
+        ADD_INT(outStr, monitorID);
+        ADD_STR(outStr, monitor->m_status);
+        ADD_INT(outStr, width);
+        ADD_INT(outStr, height);
+        ADD_INT(outStr, dataSize);
+
+        if (!queueMessage(buildMessage(outStr, data, dataSize), monitorID))
+            return;
+    }
+}
+
 void ZMServer::handleGetFrameList(std::vector<std::string> tokens)
 {
     std::string eventID;
@@ -1899,6 +2070,45 @@ int ZMServer::getFrame(FrameData &buffer, MONITOR *monitor)
     return monitor->m_width * monitor->m_height * 3;
 }
 
+// box filter an RGB24 frame down by 'scale' in each direction
+int ZMServer::scaleFrame(const FrameData &src, FrameData &dst,
+                         int width, int height, int scale)
+{
+    int dstWidth = width / scale;
+    int dstHeight = height / scale;
+    int area = scale * scale;
+    size_t srcStride = static_cast<size_t>(width) * 3;
+    size_t wpos = 0;
+
+    for (int y = 0; y < dstHeight; y++)
+    {
+        const uint8_t *row = src.data() + (srcStride * y * scale);
+
+        for (int x = 0; x < dstWidth; x++)
+        {
+            std::array<int,3> sum {0, 0, 0};
+            const uint8_t *block = row + (static_cast<size_t>(x) * scale * 3);
+
+            for (int by = 0; by < scale; by++)
+            {
+                const uint8_t *pixel = block + (srcStride * by);
+                for (int bx = 0; bx < scale; bx++, pixel += 3)
+                {
+                    sum[0] += pixel[0];
+                    sum[1] += pixel[1];
+                    sum[2] += pixel[2];
+                }
+            }
+
+            dst[wpos++] = sum[0] / area; // r
+            dst[wpos++] = sum[1] / area; // g
+            dst[wpos++] = sum[2] / area; // b
+        }
+    }
+
+    return static_cast<int>(wpos);
+}
+
 std::string ZMServer::getZMSetting(const std::string &setting) const
 {
     std::string result;
@@ -16,8 +16,10 @@
 #ifndef ZMSERVER_H
 #define ZMSERVER_H
 
+#include <array>
 #include <chrono>
 #include <cstdint>
+#include <deque>
 #include <map>
 #include <mysql/mysql.h>
 #include <sstream>
@@ -52,6 +54,16 @@ extern int     g_minorVersion;
 extern int     g_revisionVersion;
 
 static constexpr std::chrono::seconds DB_CHECK_TIME { 60s };
+
+// how often monitors with live frame subscribers are checked for a new frame
+static constexpr std::chrono::milliseconds LIVE_FRAME_CHECK_TIME { 20ms };
+
+// the largest downscale factor a live frame subscriber can ask for
+static constexpr int MAX_LIVE_FRAME_SCALE { 8 };
+
+// once this much data is queued for a client, new pushed frames are dropped
+// until the client catches up
+static constexpr size_t MAX_QUEUED_BYTES { MAX_IMAGE_SIZE * 2 };
 extern TimePoint g_lastDBKick;
 
 const std::string FUNCTION_MONITOR = "Monitor";
@@ -284,6 +296,8 @@ class MONITOR
     int            m_bytesPerPixel      {3};
     int            m_monId              {0};
     unsigned char *m_sharedImages       {nullptr};
+    // Each client's ZMServer has its own MONITORs, so this is per client.
+    // A GET_LIVE_FRAME and the frames pushed to that client share it.
     int            m_lastRead           {0};
     std::string    m_status;
     int            m_palette            {0};
@@ -299,6 +313,15 @@ class MONITOR
     std::string    m_id;
 };
 
+// a message waiting to be written to a client's (non-blocking) socket
+struct OutMessage
+{
+    std::string m_data;
+    size_t      m_offset     {0};
+    // the monitor a pushed live frame came from or -1 for a reply
+    int         m_monitorId  {-1};
+};
+
 class ZMServer
 {
   public:
@@ -307,13 +330,27 @@ class ZMServer
 
     bool processRequest(char* buf, int nbytes);
 
+    // live frame subscriptions
+    bool hasLiveSubscriptions(void) const { return !m_liveSubscriptions.empty(); }
+    void pushLiveFrames(void);
+
+    // non-blocking writer
+    bool hasPendingData(void) const { return !m_sendQueue.empty(); }
+    bool flushSendQueue(void);
+
   private:
     std::string getZMSetting(const std::string &setting) const;
-    bool send(const std::string &s) const;
-    bool send(const std::string &s, const unsigned char *buffer, int dataLen) const;
+    static std::string buildMessage(const std::string &s,
+                                    const unsigned char *buffer = nullptr,
+                                    int dataLen = 0);
+    bool send(const std::string &s);
+    bool send(const std::string &s, const unsigned char *buffer, int dataLen);
+    bool queueMessage(std::string data, int monitorId = -1);
     void sendError(const std::string &error);
     void getMonitorList(void);
     static int  getFrame(FrameData &buffer, MONITOR *monitor);
+    static int  scaleFrame(const FrameData &src, FrameData &dst,
+                           int width, int height, int scale);
     static void tokenize(const std::string &command, std::vector<std::string> &tokens);
     void handleHello(void);
     static std::string runCommand(const std::string& command);
@@ -331,6 +368,8 @@ class ZMServer
     void handleGetEventFrame(std::vector<std::string> tokens);
     void handleGetAnalysisFrame(std::vector<std::string> tokens);
     void handleGetLiveFrame(std::vector<std::string> tokens);
+    void handleSubscribeLiveFrames(std::vector<std::string> tokens);
+    void handleUnsubscribeLiveFrames(std::vector<std::string> tokens);
     void handleGetFrameList(std::vector<std::string> tokens);
     void handleDeleteEvent(std::vector<std::string> tokens);
     void handleDeleteEventList(std::vector<std::string> tokens);
@@ -350,6 +389,11 @@ class ZMServer
     std::string          m_analysisFileFormat;
     key_t                m_shmKey;
     std::string          m_mmapPath;
+    // monitor id -> downscale factor for the pushed frames
+    std::map<int, int>   m_liveSubscriptions;
+    std::deque<OutMessage> m_sendQueue;
+    size_t               m_queuedBytes        {0};
+    bool                 m_sendFailed         {false};
 };
 
 
@@ -79,12 +79,13 @@ void MythHTTPCache::PreConditionCheck(const HTTPResponse& Response)
     if ((cache & HTTPETag) == HTTPETag)
     {
         QByteArray& etag = data ? (*data)->m_etag : (*file)->m_etag;
-        if (file)
+        // Content addressed files arrive with a strong ETag already set
+        if (file && etag.isEmpty())
         {
             QByteArray hashdata = ((*file)->fileName() + lastmodified.toString("ddMMyyyyhhmmsszzz")).toLocal8Bit().constData();
             etag = QCryptographicHash::hash(hashdata, QCryptographicHash::Sha224).toHex();
         }
-        else
+        else if (data)
         {
             etag = QCryptographicHash::hash((*data)->constData(), QCryptographicHash::Sha224).toHex();
         }
@@ -25,6 +25,7 @@ class MBASE_PUBLIC MythHTTPMetaMethod
 
     bool                    m_valid         { false };
     bool                    m_protected     { false };
+    bool                    m_contentAddressed { false };
     int                     m_index         { 0 };
     int                     m_requestTypes  { HTTPUnknown };
     QMetaMethod             m_method;
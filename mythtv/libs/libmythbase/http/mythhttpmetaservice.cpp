@@ -97,6 +97,7 @@ MythHTTPMetaService::MythHTTPMetaService(const QString& Name, const QMetaObject&
                     if (newmethod)
                     {
                         newmethod->m_protected = isProtected(Meta, name);
+                        newmethod->m_contentAddressed = isContentAddressed(Meta, name);
                         RemoveExisting(m_slots, newmethod, name);
                         m_slots.emplace(name, newmethod);
                     }
@@ -178,3 +179,20 @@ bool MythHTTPMetaService::isProtected(const QMetaObject& Meta, const QString& Me
     }
     return false;
 }
+
+/*! \brief Whether the file returned by a method is named by its content.
+ *
+ * Methods flagged with 'ContentAddressed=true' guarantee that the base name of
+ * any file they return identifies its exact contents, so it can be used as a
+ * strong ETag without hashing the file.
+*/
+bool MythHTTPMetaService::isContentAddressed(const QMetaObject& Meta, const QString& Method)
+{
+    int index = Meta.indexOfClassInfo(Method.toLatin1().constData());
+    if (index > -1)
+    {
+        QStringList infos = QString(Meta.classInfo(index).value()).split(';', Qt::SkipEmptyParts);
+        return infos.contains(QStringLiteral("ContentAddressed=true"));
+    }
+    return false;
+}
@@ -16,6 +16,7 @@ class MBASE_PUBLIC MythHTTPMetaService
 
     static int ParseRequestTypes(const QMetaObject& Meta, const QString& Method, QString& ReturnName);
     static bool isProtected(const QMetaObject& Meta, const QString& Method);
+    static bool isContentAddressed(const QMetaObject& Meta, const QString& Method);
 
     const QMetaObject& m_meta;
     QString        m_name;
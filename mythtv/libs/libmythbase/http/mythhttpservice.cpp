@@ -227,7 +227,15 @@ HTTPResponse MythHTTPService::HTTPRequest(const HTTPRequest2& Request)
                     else
                     {
                         httpfile->m_lastModified = info.lastModified();
-                        httpfile->m_cacheType = HTTPLastModified | HTTPLongLife;
+                        if (handler->m_contentAddressed)
+                        {
+                            httpfile->m_etag = info.completeBaseName().toLatin1();
+                            httpfile->m_cacheType = HTTPETag | HTTPLongLife;
+                        }
+                        else
+                        {
+                            httpfile->m_cacheType = HTTPLastModified | HTTPLongLife;
+                        }
                         LOG(VB_HTTP, LOG_DEBUG, LOC + QString("Last modified: %2")
                             .arg(MythDate::toString(httpfile->m_lastModified, MythDate::kOverrideUTC | MythDate::kRFC822)));
                         // Create our response
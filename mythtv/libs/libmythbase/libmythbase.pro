@@ -19,7 +19,7 @@ HEADERS += mythobservable.h mythevent.h
 HEADERS += mythtimer.h mythdirs.h exitcodes.h
 HEADERS += lcddevice.h mythstorage.h remotefile.h logging.h loggingserver.h
 HEADERS += mythcorecontext.h mythsystem.h mythsystemprivate.h
-HEADERS += mythlocale.h storagegroup.h
+HEADERS += mythlocale.h storagegroup.h storagegroupindex.h
 HEADERS += mythdownloadmanager.h mythtranslation.h
 HEADERS += unzip2.h iso639.h iso3166.h mythmedia.h
 HEADERS += mythmiscutil.h mythhdd.h mythcdrom.h autodeletedeque.h dbutil.h
@@ -34,7 +34,7 @@ HEADERS += mythrandom.h
 HEADERS += stringutil.h
 HEADERS += mythsystemlegacy.h mythtypes.h
 HEADERS += threadedfilewriter.h mythsingledownload.h
-HEADERS += mythsession.h
+HEADERS += mythsession.h mythsettinghandle.h
 HEADERS += portchecker.h
 HEADERS += mythsorthelper.h mythdbcheck.h
 HEADERS += mythpower.h
@@ -54,6 +54,7 @@ SOURCES += mythobservable.cpp mythevent.cpp
 SOURCES += mythtimer.cpp mythdirs.cpp
 SOURCES += lcddevice.cpp mythstorage.cpp remotefile.cpp
 SOURCES += mythcorecontext.cpp mythsystem.cpp mythlocale.cpp storagegroup.cpp
+SOURCES += storagegroupindex.cpp
 SOURCES += mythdownloadmanager.cpp mythtranslation.cpp
 SOURCES += unzip2.cpp iso639.cpp iso3166.cpp mythmedia.cpp mythmiscutil.cpp
 SOURCES += mythhdd.cpp mythcdrom.cpp dbutil.cpp
@@ -66,7 +67,7 @@ SOURCES += mythsystemlegacy.cpp mythtypes.cpp
 SOURCES += mythrandom.cpp
 SOURCES += stringutil.cpp
 SOURCES += threadedfilewriter.cpp mythsingledownload.cpp
-SOURCES += mythsession.cpp
+SOURCES += mythsession.cpp mythsettinghandle.cpp
 SOURCES += portchecker.cpp
 SOURCES += mythsorthelper.cpp dbcheckcommon.cpp
 SOURCES += mythpower.cpp
@@ -182,6 +183,7 @@ inc.files += mythplugin.h mythpluginapi.h
 inc.files += mythpluginexport.h
 inc.files += remotefile.h mythsystemlegacy.h mythtypes.h
 inc.files += threadedfilewriter.h mythsingledownload.h mythsession.h
+inc.files += mythsettinghandle.h
 inc.files += mythsorthelper.h mythdbcheck.h
 inc.files += mythconfig.h
 inc.files += mythrandom.h
@@ -18,6 +18,7 @@
 #include "mythdirs.h"
 #include "mythcorecontext.h"
 #include "mythrandom.h"
+#include "mythsettinghandle.h"
 
 static MythDB *mythdb = nullptr;
 static QMutex dbLock;
@@ -920,6 +921,8 @@ void MythDB::OverrideSettingForSession(
     d->m_settingsCache[mk]      = mv;
     d->m_settingsCache[mk2]     = mv;
     d->m_settingsCacheLock.unlock();
+
+    MythSettingHandleBase::Invalidate(mk);
 }
 
 /// \brief Clears session Overrides for the given setting.
@@ -935,6 +938,8 @@ void MythDB::ClearOverrideSettingForSession(const QString &key)
     d->m_settingsCache.remove(mk2);
 
     d->m_settingsCacheLock.unlock();
+
+    MythSettingHandleBase::Invalidate(mk);
 }
 
 static void clear(
@@ -992,6 +997,9 @@ void MythDB::ClearSettingsCache(const QString &_key)
     }
 
     d->m_settingsCacheLock.unlock();
+
+    // Handles read the new value from the cache, so tell them afterwards
+    MythSettingHandleBase::Invalidate(_key);
 }
 
 void MythDB::ActivateSettingsCache(bool activate)
@@ -1005,6 +1013,11 @@ void MythDB::ActivateSettingsCache(bool activate)
     ClearSettingsCache();
 }
 
+bool MythDB::IsSettingsCacheActive(void) const
+{
+    return d->m_useSettingsCache;
+}
+
 void MythDB::WriteDelayedSettings(void)
 {
     if (!HaveValidDatabase())
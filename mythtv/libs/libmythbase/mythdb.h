@@ -37,6 +37,7 @@ class MBASE_PUBLIC MythDB
 
     void ClearSettingsCache(const QString &key = QString());
     void ActivateSettingsCache(bool activate = true);
+    bool IsSettingsCacheActive(void) const;
     void OverrideSettingForSession(const QString &key, const QString &newValue);
     void ClearOverrideSettingForSession(const QString &key);
 
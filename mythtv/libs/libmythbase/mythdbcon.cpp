@@ -1,10 +1,18 @@
 #include <unistd.h>
 
 // ANSI C
+#include <algorithm>
+#include <bit>
+#include <cmath>
 #include <cstdlib>
 #include <thread>
+#include <vector>
 
 // Qt
+#include <QtGlobal>
+#if QT_VERSION >= QT_VERSION_CHECK(6,5,0)
+#include <QtEnvironmentVariables>
+#endif
 #include <QCoreApplication>
 #include <QElapsedTimer>
 #include <QRegularExpression>
@@ -36,6 +44,19 @@
 #endif
 
 static constexpr std::chrono::seconds kPurgeTimeout { 1h };
+// Prepared statements kept per connection
+static constexpr size_t kMaxCachedStatements { 24 };
+// Limits the statistics for statements that still differ once normalized
+static constexpr int kMaxStatementStats { 500 };
+// Longer statements are counted by their start
+static constexpr int kMaxStatementText { 1000 };
+// Limits the SQL texts remembered, so that they are only normalized once
+static constexpr int kMaxQueryTexts { 1000 };
+// Only texts up to this long are remembered
+static constexpr int kMaxQueryText { 500 };
+
+static const bool s_cacheStatements =
+    !qEnvironmentVariableIsSet("MYTHTV_NO_SQL_STATEMENT_CACHE");
 
 static QMutex sMutex;
 
@@ -109,6 +130,7 @@ MSqlDatabase::MSqlDatabase(QString name, QString driver)
 
 MSqlDatabase::~MSqlDatabase()
 {
+    ClearStatements();
     if (m_db.isOpen())
     {
         m_db.close();
@@ -145,6 +167,7 @@ bool MSqlDatabase::OpenDatabase(bool skipdb)
 
     if (!m_db.isOpen())
     {
+        ClearStatements();
         if (!skipdb)
             m_dbparms = GetMythDB()->GetDatabaseParams();
         m_db.setDatabaseName(m_dbparms.m_dbName);
@@ -258,13 +281,17 @@ bool MSqlDatabase::KickDatabase(void)
     m_lastDBKick = MythDate::current().addSecs(-60);
 
     if (!m_db.isOpen())
+    {
+        ClearStatements();
         m_db.open();
+    }
 
     return m_db.isOpen();
 }
 
 bool MSqlDatabase::Reconnect()
 {
+    ClearStatements();
     m_db.close();
     m_db.open();
 
@@ -288,6 +315,50 @@ void MSqlDatabase::InitSessionVars()
     query.exec("SET @@session.sql_mode=''");
 }
 
+/*! \brief Take the prepared statement for Query out of the cache.
+ *
+ * Statements are taken rather than shared, so that nested queries using the
+ * same SQL on this connection do not get each other's results.
+ */
+bool MSqlDatabase::TakeStatement(const QString &Query, QSqlQuery &Statement,
+                                 MSqlStatementStats *&Stats, uint &Generation)
+{
+    auto it = std::ranges::find(m_statements, Query, &CachedStatement::m_query);
+    if (it == m_statements.end())
+        return false;
+
+    Statement  = it->m_statement;
+    Stats      = it->m_stats;
+    Generation = m_generation;
+    m_statements.erase(it);
+    return true;
+}
+
+/// \brief Keep a prepared statement for the next query with the same SQL.
+void MSqlDatabase::ReturnStatement(const QString &Query, const QSqlQuery &Statement,
+                                   MSqlStatementStats *Stats, uint Generation)
+{
+    // Prepared on a connection that has since been closed
+    if (Generation != m_generation)
+        return;
+
+    // A nested query prepared the same SQL, keep the newest
+    auto it = std::ranges::find(m_statements, Query, &CachedStatement::m_query);
+    if (it != m_statements.end())
+        m_statements.erase(it);
+
+    m_statements.push_front({ Query, Statement, Stats });
+    if (m_statements.size() > kMaxCachedStatements)
+        m_statements.pop_back();
+}
+
+/// \brief Drop all prepared statements, they must go before the connection.
+void MSqlDatabase::ClearStatements(void)
+{
+    m_statements.clear();
+    m_generation++;
+}
+
 // -----------------------------------------------------------------------
 
 
@@ -295,6 +366,9 @@ void MSqlDatabase::InitSessionVars()
 MDBManager::~MDBManager()
 {
     CloseDatabases();
+    LogStatementStats();
+    qDeleteAll(m_statementStats);
+    m_queryStats.clear();
 
     if (m_connCount != 0 || m_schedCon || m_channelCon)
     {
@@ -308,8 +382,28 @@ MDBManager::~MDBManager()
 #endif
 }
 
+static void UpdateMaximum(std::atomic<int64_t> &Maximum, int64_t Value)
+{
+    int64_t max = Maximum.load(std::memory_order_relaxed);
+    while (Value > max &&
+           !Maximum.compare_exchange_weak(max, Value, std::memory_order_relaxed))
+    {
+    }
+}
+
 MSqlDatabase *MDBManager::popConnection(bool reuse)
 {
+    QElapsedTimer timer;
+    timer.start();
+    auto waited = [&]()
+    {
+        int64_t nsecs = timer.nsecsElapsed();
+        m_poolRequests++;
+        m_poolWaitTime += nsecs;
+        UpdateMaximum(m_maxPoolWait, nsecs);
+        m_poolWaitHistogram.Add(nsecs);
+    };
+
     PurgeIdleConnections(true);
 
     m_lock.lock();
@@ -324,6 +418,7 @@ MSqlDatabase *MDBManager::popConnection(bool reuse)
         {
             m_inuseCount[QThread::currentThread()]++;
             m_lock.unlock();
+            waited();
             return db;
         }
     }
@@ -337,6 +432,7 @@ MSqlDatabase *MDBManager::popConnection(bool reuse)
         db = new MSqlDatabase("DBManager" + QString::number(m_nextConnID++),
             params.m_dbType);
         ++m_connCount;
+        m_newConnections++;
         LOG(VB_DATABASE, LOG_INFO,
                 QString("New DB connection, total: %1").arg(m_connCount));
     }
@@ -357,6 +453,7 @@ MSqlDatabase *MDBManager::popConnection(bool reuse)
     m_lock.unlock();
 
     db->OpenDatabase();
+    waited();
 
     return db;
 }
@@ -464,6 +561,8 @@ MSqlDatabase *MDBManager::getStaticCon(MSqlDatabase **dbcon, const QString& name
     if (!*dbcon)
     {
         *dbcon = new MSqlDatabase(name);
+        // Shared between threads, so no statements are kept in it
+        (*dbcon)->m_cacheStatements = false;
         LOG(VB_GENERAL, LOG_INFO, "New static DB connection" + name);
     }
 
@@ -496,6 +595,7 @@ void MDBManager::CloseDatabases()
     {
         LOG(VB_DATABASE, LOG_INFO,
             "Closing DB connection named '" + conn->m_name + "'");
+        conn->ClearStatements();
         conn->m_db.close();
         delete conn;
         m_connCount--;
@@ -509,6 +609,7 @@ void MDBManager::CloseDatabases()
         MSqlDatabase *db = slist.takeFirst();
         LOG(VB_DATABASE, LOG_INFO,
             "Closing DB connection named '" + db->m_name + "'");
+        db->ClearStatements();
         db->m_db.close();
         delete db;
 
@@ -521,8 +622,251 @@ void MDBManager::CloseDatabases()
 }
 
 
+/*! \brief Return the statistics for Query, creating them if necessary.
+ *
+ * Statements that only differ in their literal values share their
+ * statistics. The result is valid for the lifetime of the manager.
+ *
+ * Short statements without any literals, usually those with placeholders,
+ * are remembered as they are so that they are only normalized once. Those
+ * with their values in the text would only fill that up.
+ */
+MSqlStatementStats *MDBManager::GetStatementStats(const QString &Query)
+{
+    auto isLiteral = [](QChar c) { return c.isDigit() || c == '\'' || c == '"'; };
+    bool remember = (Query.size() <= kMaxQueryText) &&
+        std::none_of(Query.cbegin(), Query.cend(), isLiteral);
+    if (remember)
+    {
+        QMutexLocker locker(&m_statsLock);
+        auto it = m_queryStats.constFind(Query);
+        if (it != m_queryStats.constEnd())
+            return *it;
+    }
+
+    // Normalized without the lock, as it takes as long as Query is
+    QString key = MSqlNormalizeQuery(Query);
+    if (key.size() > kMaxStatementText)
+    {
+        key.truncate(kMaxStatementText);
+        key += "...";
+    }
+    key.squeeze();
+
+    QMutexLocker locker(&m_statsLock);
+    MSqlStatementStats *stats = m_statementStats.value(key);
+    if (stats == nullptr)
+    {
+        // Everything else is counted together
+        if (m_statementStats.size() >= kMaxStatementStats)
+        {
+            key = "<other>";
+            stats = m_statementStats.value(key);
+        }
+        if (stats == nullptr)
+        {
+            stats = new MSqlStatementStats;
+            m_statementStats.insert(key, stats);
+        }
+    }
+
+    if (remember && m_queryStats.size() < kMaxQueryTexts)
+        m_queryStats.insert(Query, stats);
+    return stats;
+}
+
+/// \brief Remember Location as one of the places Stats' statement is used from.
+void MDBManager::AddCallSite(MSqlStatementStats *Stats, const std::source_location &Location)
+{
+    // Without locking for the usual case of a known or full list
+    auto known = [&]()
+    {
+        for (const auto & site : Stats->m_callSites)
+        {
+            const char *file = site.m_file.load(std::memory_order_acquire);
+            if (file == nullptr)
+                return false;
+            if (site.m_line == Location.line() && file == Location.file_name())
+                return true;
+        }
+        return true;
+    };
+    if (known())
+        return;
+
+    QMutexLocker locker(&m_statsLock);
+    if (known())
+        return;
+    for (auto & site : Stats->m_callSites)
+    {
+        if (site.m_file.load(std::memory_order_relaxed) == nullptr)
+        {
+            site.m_line = Location.line();
+            site.m_file.store(Location.file_name(), std::memory_order_release);
+            break;
+        }
+    }
+}
+
+/// \brief Copy the statement statistics, those that took the most time first.
+std::vector<MSqlStatementSummary> MDBManager::GetStatementSummaries(size_t Top)
+{
+    std::vector<MSqlStatementSummary> result;
+    QMutexLocker locker(&m_statsLock);
+    result.reserve(m_statementStats.size());
+    for (auto it = m_statementStats.cbegin(); it != m_statementStats.cend(); ++it)
+    {
+        const MSqlStatementStats *stats = it.value();
+        MSqlStatementSummary summary;
+        summary.m_query       = it.key();
+        summary.m_prepares    = stats->m_prepares.load();
+        summary.m_reuses      = stats->m_reuses.load();
+        summary.m_prepareTime = stats->m_prepareTime.load();
+        summary.m_execs       = stats->m_execs.load();
+        summary.m_execTime    = stats->m_execTime.load();
+        summary.m_maxExecTime = stats->m_maxExecTime.load();
+        summary.m_histogram   = stats->m_execHistogram.Get();
+        for (const auto & site : stats->m_callSites)
+        {
+            const char *file = site.m_file.load(std::memory_order_acquire);
+            if (file == nullptr)
+                break;
+            // Keep the directory, which is usually the library or program
+            QString name = QString::fromUtf8(file);
+            int slash = name.lastIndexOf('/', name.lastIndexOf('/') - 1);
+            summary.m_callSites.append(QString("%1:%2").arg(name.mid(slash + 1))
+                                       .arg(site.m_line));
+        }
+        result.push_back(summary);
+    }
+    locker.unlock();
+
+    auto total = [](const MSqlStatementSummary &Summary)
+    {
+        return Summary.m_prepareTime + Summary.m_execTime;
+    };
+    std::ranges::sort(result, std::ranges::greater(), total);
+    if (Top > 0 && result.size() > Top)
+        result.resize(Top);
+    return result;
+}
+
+/// \brief Copy the connection pool counters.
+MSqlPoolSummary MDBManager::GetPoolSummary(void)
+{
+    MSqlPoolSummary summary;
+    m_lock.lock();
+    summary.m_connections = m_connCount;
+    m_lock.unlock();
+    summary.m_requests       = m_poolRequests.load();
+    summary.m_newConnections = m_newConnections.load();
+    summary.m_waitTime       = m_poolWaitTime.load();
+    summary.m_maxWait        = m_maxPoolWait.load();
+    summary.m_histogram      = m_poolWaitHistogram.Get();
+    return summary;
+}
+
+/// \brief Log the statements that took the most time.
+void MDBManager::LogStatementStats(void)
+{
+    if (!VERBOSE_LEVEL_CHECK(VB_DATABASE, LOG_INFO))
+        return;
+
+    MSqlPoolSummary pool = GetPoolSummary();
+    LOG(VB_DATABASE, LOG_INFO,
+        QString("%1 DB connections handed out, %2 new, waited %3 ms "
+                "(max %4 us, 99% under %5 us)")
+        .arg(pool.m_requests).arg(pool.m_newConnections)
+        .arg(pool.m_waitTime / 1000000).arg(pool.m_maxWait / 1000)
+        .arg(MSqlTimeHistogram::Percentile(pool.m_histogram, 0.99)));
+
+    std::vector<MSqlStatementSummary> stats = GetStatementSummaries(20);
+    LOG(VB_DATABASE, LOG_INFO, QString("Top %1 SQL statements by time:")
+        .arg(stats.size()));
+    for (const auto & stat : stats)
+    {
+        uint64_t execs = std::max(stat.m_execs, static_cast<uint64_t>(1));
+        LOG(VB_DATABASE, LOG_INFO,
+            QString("  %1 prepares (%2 ms), %3 reused, %4 execs (%5 ms, "
+                    "avg %6 us, 95% under %7 us, max %8 us) from %9: %10")
+            .arg(stat.m_prepares).arg(stat.m_prepareTime / 1000000)
+            .arg(stat.m_reuses).arg(stat.m_execs)
+            .arg(stat.m_execTime / 1000000)
+            .arg(stat.m_execTime / static_cast<int64_t>(execs) / 1000)
+            .arg(MSqlTimeHistogram::Percentile(stat.m_histogram, 0.95))
+            .arg(stat.m_maxExecTime / 1000)
+            .arg(stat.m_callSites.join(", "), stat.m_query.left(200)));
+    }
+}
+
+// -----------------------------------------------------------------------
+
+void MSqlTimeHistogram::Add(int64_t Nanoseconds)
+{
+    auto usecs = static_cast<uint64_t>(std::max(Nanoseconds, int64_t{0}) / 1000);
+    size_t bucket = 0;
+    if (usecs >= 128)
+        bucket = std::min(static_cast<size_t>(std::bit_width(usecs)) - 7, kBuckets - 1);
+    m_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+MSqlTimeHistogram::Counts MSqlTimeHistogram::Get(void) const
+{
+    Counts result {};
+    for (size_t i = 0; i < kBuckets; ++i)
+        result[i] = m_counts[i].load(std::memory_order_relaxed);
+    return result;
+}
+
+/// \brief The lowest duration counted in Bucket, in microseconds.
+int64_t MSqlTimeHistogram::BucketStart(size_t Bucket)
+{
+    return Bucket == 0 ? 0 : int64_t{64} << Bucket;
+}
+
+/*! \brief Estimate a percentile of the durations, in microseconds.
+ *
+ * \return The end of the bucket holding the percentile, or the start of the
+ *         last bucket when it falls in there. 0 if nothing was counted.
+ */
+int64_t MSqlTimeHistogram::Percentile(const Counts &Histogram, double Fraction)
+{
+    uint64_t total = 0;
+    for (auto count : Histogram)
+        total += count;
+    if (total == 0)
+        return 0;
+
+    auto wanted = static_cast<uint64_t>(std::ceil(static_cast<double>(total) * Fraction));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBuckets - 1; ++i)
+    {
+        seen += Histogram[i];
+        if (seen >= wanted)
+            return BucketStart(i + 1);
+    }
+    return BucketStart(kBuckets - 1);
+}
+
+void MSqlStatementStats::AddExec(int64_t Nanoseconds)
+{
+    m_execs++;
+    m_execTime += Nanoseconds;
+    UpdateMaximum(m_maxExecTime, Nanoseconds);
+    m_execHistogram.Add(Nanoseconds);
+}
+
 // -----------------------------------------------------------------------
 
+static bool IsCacheableStatement(const QString &Query)
+{
+    // Leave DDL, locks and session statements alone
+    static const QRegularExpression kDML
+        { R"(^\s*(SELECT|INSERT|UPDATE|DELETE|REPLACE)\b)",
+          QRegularExpression::CaseInsensitiveOption };
+    return kDML.match(Query).hasMatch();
+}
+
 static void InitMSqlQueryInfo(MSqlQueryInfo &qi)
 {
     qi.db = nullptr;
@@ -541,6 +885,8 @@ MSqlQuery::MSqlQuery(const MSqlQueryInfo &qi)
 
 MSqlQuery::~MSqlQuery()
 {
+    ReleaseStatement(false);
+
     if (m_returnConnection)
     {
         MDBManager *dbmanager = GetMythDB()->GetDBManager();
@@ -640,6 +986,8 @@ bool MSqlQuery::exec()
     {
         LOG(VB_GENERAL, LOG_INFO,
             "MSqlQuery disconnecting DB to test reconnection logic");
+        ReleaseStatement(true);
+        m_db->ClearStatements();
         m_db->m_db.close();
     }
 #endif
@@ -657,6 +1005,8 @@ bool MSqlQuery::exec()
 
     bool result = QSqlQuery::exec();
     qint64 elapsed = timer.elapsed();
+    if (m_stats)
+        m_stats->AddExec(timer.nsecsElapsed());
 
     if (!result && lostConnectionCheck())
         result = QSqlQuery::exec();
@@ -748,7 +1098,7 @@ bool MSqlQuery::exec()
     return result;
 }
 
-bool MSqlQuery::exec(const QString &query)
+bool MSqlQuery::exec(const QString &query, const std::source_location &location)
 {
     if (!m_db)
     {
@@ -764,7 +1114,17 @@ bool MSqlQuery::exec(const QString &query)
         return false;
     }
 
+    // Not a prepared statement, so the last one can go back to the cache
+    ReleaseStatement(true);
+
+    MDBManager *dbmanager = GetMythDB()->GetDBManager();
+    m_stats = dbmanager->GetStatementStats(query);
+    dbmanager->AddCallSite(m_stats, location);
+
+    QElapsedTimer timer;
+    timer.start();
     bool result = QSqlQuery::exec(query);
+    m_stats->AddExec(timer.nsecsElapsed());
 
     if (!result && lostConnectionCheck())
         result = QSqlQuery::exec(query);
@@ -839,7 +1199,7 @@ bool MSqlQuery::seek(int where, bool relative)
     return seekDebug("seek", QSqlQuery::seek(where, relative), where, relative);
 }
 
-bool MSqlQuery::prepare(const QString& query)
+bool MSqlQuery::prepare(const QString& query, const std::source_location &location)
 {
     if (!m_db)
     {
@@ -855,6 +1215,30 @@ bool MSqlQuery::prepare(const QString& query)
         return false;
     }
 
+    MDBManager *dbmanager = GetMythDB()->GetDBManager();
+
+    // The same statement again, as in a loop, only needs its results dropped
+    if (!m_statement.isEmpty() && query == m_statement &&
+        m_statementGeneration == m_db->m_generation)
+    {
+        QSqlQuery::finish();
+        ClearBoundValues();
+        m_stats->m_reuses++;
+        dbmanager->AddCallSite(m_stats, location);
+        return true;
+    }
+
+    ReleaseStatement(true);
+    if (s_cacheStatements && m_db->m_cacheStatements &&
+        m_db->TakeStatement(query, *this, m_stats, m_statementGeneration))
+    {
+        m_statement = query;
+        ClearBoundValues();
+        m_stats->m_reuses++;
+        dbmanager->AddCallSite(m_stats, location);
+        return true;
+    }
+
     // QT docs indicate that there are significant speed ups and a reduction
     // in memory usage by enabling forward-only cursors
     //
@@ -862,11 +1246,24 @@ bool MSqlQuery::prepare(const QString& query)
     // iterate forward over the result set.
     setForwardOnly(true);
 
+    QElapsedTimer timer;
+    timer.start();
     bool ok = QSqlQuery::prepare(query);
+    m_stats = dbmanager->GetStatementStats(query);
+    m_stats->m_prepares++;
+    m_stats->m_prepareTime += timer.nsecsElapsed();
+    dbmanager->AddCallSite(m_stats, location);
 
     if (!ok && lostConnectionCheck())
         ok = true;
 
+    if (ok && s_cacheStatements && m_db->m_cacheStatements &&
+        IsCacheableStatement(query))
+    {
+        m_statement = query;
+        m_statementGeneration = m_db->m_generation;
+    }
+
     if (!ok && !(GetMythDB()->SuppressDBMessages()))
     {
         LOG(VB_GENERAL, LOG_ERR,
@@ -878,6 +1275,42 @@ bool MSqlQuery::prepare(const QString& query)
     return ok;
 }
 
+/*! \brief Give the prepared statement back to the connection's cache.
+ *
+ * \param Detach Replace it with an empty query, so that this query no
+ *               longer shares it with the cache.
+ */
+void MSqlQuery::ReleaseStatement(bool Detach)
+{
+    if (m_statement.isEmpty())
+        return;
+
+    if (m_db)
+    {
+        QSqlQuery::finish();
+        m_db->ReturnStatement(m_statement, *this, m_stats, m_statementGeneration);
+        if (Detach)
+        {
+            // A fresh QSqlQuery would drop the caller's setForwardOnly()
+            bool forwardOnly = QSqlQuery::isForwardOnly();
+            QSqlQuery::operator=(QSqlQuery(QString(), m_db->db()));
+            QSqlQuery::setForwardOnly(forwardOnly);
+        }
+    }
+    m_statement.clear();
+}
+
+/*! \brief Forget the values bound for the last use of a reused statement.
+ *
+ * A new prepare() starts without any, so a reused statement must too.
+ */
+void MSqlQuery::ClearBoundValues(void)
+{
+    auto count = static_cast<int>(QSqlQuery::boundValues().size());
+    for (int i = 0; i < count; ++i)
+        QSqlQuery::bindValue(i, QVariant());
+}
+
 bool MSqlQuery::testDBConnection()
 {
     MSqlDatabase *db = GetMythDB()->GetDBManager()->popConnection(true);
@@ -946,6 +1379,9 @@ bool MSqlQuery::Reconnect(void)
 {
     if (!m_db->Reconnect())
         return false;
+    // Went with the old connection, and the query may be re-prepared below
+    // with other SQL
+    m_statement.clear();
     if (!m_lastPreparedQuery.isEmpty())
     {
 #if QT_VERSION < QT_VERSION_CHECK(6,0,0)
@@ -1044,3 +1480,70 @@ void MSqlEscapeAsAQuery(QString &query, const MSqlBindings &bindings)
                               result.driver()->formatValue(f));
     }
 }
+
+/*! \brief Replace the literal values in an SQL statement with '?'.
+ *
+ * Quoted strings and numbers become '?', lists of them "?, ..." and runs of
+ * white space a single space, so that statements built with their values in
+ * the text are counted together. Identifiers and placeholders are kept.
+ */
+QString MSqlNormalizeQuery(const QString &query)
+{
+    auto isWord = [](QChar c) { return c.isLetterOrNumber() || c == '_' || c == '$'; };
+
+    QString result;
+    result.reserve(query.size());
+    int size = query.size();
+    int i = 0;
+    while (i < size)
+    {
+        QChar c = query[i];
+        if (c.isSpace())
+        {
+            while (i < size && query[i].isSpace())
+                ++i;
+            if (!result.isEmpty() && i < size)
+                result += ' ';
+        }
+        else if (c == '\'' || c == '"')
+        {
+            // Backslash escapes and doubled quotes stay inside the string
+            for (++i; i < size; ++i)
+            {
+                if (query[i] == '\\')
+                    ++i;
+                else if (query[i] == c && (i + 1 >= size || query[i + 1] != c))
+                    break;
+                else if (query[i] == c)
+                    ++i;
+            }
+            ++i;
+            result += '?';
+        }
+        else if (c == '`')
+        {
+            int end = query.indexOf('`', i + 1);
+            end = (end < 0) ? size : end + 1;
+            result += query.mid(i, end - i);
+            i = end;
+        }
+        else if (c.isDigit() && (result.isEmpty() || !isWord(result.back())))
+        {
+            while (i < size && (isWord(query[i]) || query[i] == '.'))
+                ++i;
+            result += '?';
+        }
+        else
+        {
+            result += c;
+            ++i;
+        }
+    }
+
+    static const QRegularExpression kValues { R"(\?(?:\s*,\s*\?)+)" };
+    static const QRegularExpression kRows
+        { R"((\(\?(?:, \.\.\.)?\))(?:\s*,\s*\(\?(?:, \.\.\.)?\))+)" };
+    result.replace(kValues, "?, ...");
+    result.replace(kRows, "\\1, ...");
+    return result;
+}
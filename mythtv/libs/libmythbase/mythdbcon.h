@@ -1,6 +1,13 @@
 #ifndef MYTHDBCON_H_
 #define MYTHDBCON_H_
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <source_location>
+#include <vector>
+
 #include <QSqlDatabase>
 #include <QSqlRecord>
 #include <QSqlError>
@@ -9,6 +16,7 @@
 #include <QDateTime>
 #include <QMutex>
 #include <QList>
+#include <QStringList>
 
 #include "mythbaseexp.h"
 #include "mythdbparams.h"
@@ -21,6 +29,77 @@ MBASE_PUBLIC bool TestDatabase(const QString& dbHostName,
                                QString dbName = "mythconverg",
                                int     dbPort = 3306);
 
+/*! \brief Lock free histogram of durations.
+ *
+ * Bucket 0 counts everything below 128 us, each following bucket is twice
+ * as wide as the one before and the last one has no upper limit.
+ */
+class MBASE_PUBLIC MSqlTimeHistogram
+{
+  public:
+    static constexpr size_t kBuckets { 16 };
+    using Counts = std::array<uint64_t, kBuckets>;
+
+    void Add(int64_t Nanoseconds);
+    Counts Get(void) const;
+
+    static int64_t BucketStart(size_t Bucket);
+    static int64_t Percentile(const Counts &Histogram, double Fraction);
+
+  private:
+    std::array<std::atomic<uint64_t>, kBuckets> m_counts {};
+};
+
+/// \brief Prepare and exec counts and times of one normalized SQL statement.
+struct MBASE_PUBLIC MSqlStatementStats
+{
+    static constexpr size_t kMaxCallSites { 4 };
+
+    std::atomic<uint64_t> m_prepares    {0}; ///< prepared by the server
+    std::atomic<uint64_t> m_reuses      {0}; ///< prepared statement reused
+    std::atomic<int64_t>  m_prepareTime {0}; ///< total, in nanoseconds
+    std::atomic<uint64_t> m_execs       {0};
+    std::atomic<int64_t>  m_execTime    {0}; ///< total, in nanoseconds
+    std::atomic<int64_t>  m_maxExecTime {0}; ///< in nanoseconds
+    MSqlTimeHistogram     m_execHistogram;
+
+    /// The first places the statement is used from. A slot is written once,
+    /// under MDBManager::m_statsLock, and m_file is set last.
+    struct CallSite
+    {
+        std::atomic<const char*> m_file {nullptr};
+        uint_least32_t           m_line {0};
+    };
+    std::array<CallSite, kMaxCallSites> m_callSites;
+
+    void AddExec(int64_t Nanoseconds);
+};
+
+/// \brief Copy of the statistics of one normalized SQL statement.
+struct MSqlStatementSummary
+{
+    QString     m_query;
+    QStringList m_callSites;      ///< "directory/file.cpp:line"
+    uint64_t    m_prepares    {0};
+    uint64_t    m_reuses      {0};
+    int64_t     m_prepareTime {0}; ///< total, in nanoseconds
+    uint64_t    m_execs       {0};
+    int64_t     m_execTime    {0}; ///< total, in nanoseconds
+    int64_t     m_maxExecTime {0}; ///< in nanoseconds
+    MSqlTimeHistogram::Counts m_histogram {};
+};
+
+/// \brief Copy of the connection pool counters.
+struct MSqlPoolSummary
+{
+    int      m_connections    {0}; ///< open now
+    uint64_t m_requests       {0}; ///< connections handed out
+    uint64_t m_newConnections {0};
+    int64_t  m_waitTime       {0}; ///< total, in nanoseconds
+    int64_t  m_maxWait        {0}; ///< in nanoseconds
+    MSqlTimeHistogram::Counts m_histogram {};
+};
+
 /// \brief QSqlDatabase wrapper, used by MSqlQuery. Do not use directly.
 class MSqlDatabase
 {
@@ -42,12 +121,31 @@ class MSqlDatabase
     bool Reconnect(void);
     void InitSessionVars(void);
 
+    bool TakeStatement(const QString &Query, QSqlQuery &Statement,
+                       MSqlStatementStats *&Stats, uint &Generation);
+    void ReturnStatement(const QString &Query, const QSqlQuery &Statement,
+                         MSqlStatementStats *Stats, uint Generation);
+    void ClearStatements(void);
+
   private:
     QString m_name;
     QString m_driver;
     QSqlDatabase m_db;
     QDateTime m_lastDBKick;
     DatabaseParams m_dbparms;
+
+    /// Prepared statements not in use by any MSqlQuery, most recent first.
+    struct CachedStatement
+    {
+        QString             m_query;
+        QSqlQuery           m_statement;
+        MSqlStatementStats *m_stats {nullptr};
+    };
+    std::list<CachedStatement> m_statements;
+    /// Changes whenever the connection is closed, which drops its statements
+    uint m_generation {0};
+    /// False for the static connections, which are used from several threads
+    bool m_cacheStatements {true};
 };
 
 /// \brief DB connection pool, used by MSqlQuery. Do not use directly.
@@ -61,6 +159,12 @@ class MBASE_PUBLIC MDBManager
     void CloseDatabases(void);
     void PurgeIdleConnections(bool leaveOne = false);
 
+    MSqlStatementStats *GetStatementStats(const QString &Query);
+    void AddCallSite(MSqlStatementStats *Stats, const std::source_location &Location);
+    std::vector<MSqlStatementSummary> GetStatementSummaries(size_t Top = 0);
+    MSqlPoolSummary GetPoolSummary(void);
+    void LogStatementStats(void);
+
   protected:
     MSqlDatabase *popConnection(bool reuse);
     void pushConnection(MSqlDatabase *db);
@@ -86,6 +190,18 @@ class MBASE_PUBLIC MDBManager
     MSqlDatabase *m_schedCon {nullptr};
     MSqlDatabase *m_channelCon {nullptr};
     QHash<QThread*, DBList> m_staticPool;
+
+    QMutex m_statsLock;
+    // keyed by the normalized SQL, protected by m_statsLock
+    QHash<QString, MSqlStatementStats*> m_statementStats;
+    // SQL as prepared, protected by m_statsLock
+    QHash<QString, MSqlStatementStats*> m_queryStats;
+
+    std::atomic<uint64_t> m_poolRequests   {0};
+    std::atomic<uint64_t> m_newConnections {0};
+    std::atomic<int64_t>  m_poolWaitTime   {0};
+    std::atomic<int64_t>  m_maxPoolWait    {0};
+    MSqlTimeHistogram     m_poolWaitHistogram;
 };
 
 /// \brief MSqlDatabase Info, used by MSqlQuery. Do not use directly.
@@ -105,6 +221,9 @@ using MSqlBindings = QMap<QString, QVariant>;
 /// \brief Given a partial query string and a bindings object, escape the string
  MBASE_PUBLIC  void MSqlEscapeAsAQuery(QString &query, const MSqlBindings &bindings);
 
+/// \brief Replace the literal values in an SQL statement with '?'
+ MBASE_PUBLIC  QString MSqlNormalizeQuery(const QString &query);
+
 /** \brief QSqlQuery wrapper that fetches a DB connection from the connection pool.
  *
  *   Myth & database connections
@@ -156,10 +275,14 @@ class MBASE_PUBLIC MSqlQuery : private QSqlQuery
     bool seek(int where, bool relative = false);
 
     /// \brief Wrap QSqlQuery::exec(const QString &query) so we can display SQL
-    bool exec(const QString &query);
+    bool exec(const QString &query,
+              const std::source_location &location = std::source_location::current());
 
     /// \brief QSqlQuery::prepare() is not thread safe in Qt <= 3.3.2
-    bool prepare(const QString &query);
+    ///
+    /// The caller's location labels the statement in the query statistics.
+    bool prepare(const QString &query,
+                 const std::source_location &location = std::source_location::current());
 
     /// \brief Add a single binding
     void bindValue(const QString &placeholder, const QVariant &val);
@@ -247,11 +370,16 @@ class MBASE_PUBLIC MSqlQuery : private QSqlQuery
 
     bool seekDebug(const char *type, bool result,
                    int where, bool relative) const;
+    void ReleaseStatement(bool Detach);
+    void ClearBoundValues(void);
 
     MSqlDatabase *m_db               {nullptr};
     bool          m_isConnected      {false};
     bool          m_returnConnection {false};
     QString       m_lastPreparedQuery; // holds a copy of the last prepared query
+    QString       m_statement;         // prepared statement to give back to m_db
+    uint          m_statementGeneration {0};
+    MSqlStatementStats *m_stats      {nullptr};
 };
 
 #endif
@@ -0,0 +1,91 @@
+// C++
+#include <algorithm>
+#include <vector>
+
+// MythTV
+#include "mythcorecontext.h"
+#include "mythdb.h"
+#include "mythsettinghandle.h"
+
+namespace
+{
+// Function local so that it outlives static handles
+struct HandleRegistry
+{
+    QMutex                               m_lock;
+    std::vector<MythSettingHandleBase *> m_handles;
+};
+
+HandleRegistry &Registry(void)
+{
+    static HandleRegistry s_registry;
+    return s_registry;
+}
+} // namespace
+
+MythSettingHandleBase::MythSettingHandleBase(const QString &Key)
+  : m_key(Key)
+{
+    HandleRegistry &registry = Registry();
+    QMutexLocker locker(&registry.m_lock);
+    registry.m_handles.push_back(this);
+}
+
+MythSettingHandleBase::~MythSettingHandleBase()
+{
+    HandleRegistry &registry = Registry();
+    QMutexLocker locker(&registry.m_lock);
+    std::erase(registry.m_handles, this);
+}
+
+/*! \brief Mark the handles for Key, or all of them, out of date.
+ *
+ * Key may be prefixed with a host name, as used by the settings cache.
+ */
+void MythSettingHandleBase::Invalidate(const QString &Key)
+{
+    QString key = Key.section(QChar(' '), -1);
+
+    HandleRegistry &registry = Registry();
+    QMutexLocker locker(&registry.m_lock);
+    for (auto * handle : registry.m_handles)
+        if (key.isEmpty() || handle->m_key.compare(key, Qt::CaseInsensitive) == 0)
+            handle->m_changes.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void MythSettingHandleBase::Resolve(void)
+{
+    QMutexLocker locker(&m_resolveLock);
+    uint changes = m_changes.load(std::memory_order_acquire);
+    Load();
+
+    // Until there is a settings cache that is told about changes, or while
+    // the database may still turn up, keep reading the setting
+    MythDB *db = GetMythDB();
+    if (db->IsSettingsCacheActive() &&
+        (db->HaveValidDatabase() || db->IsDatabaseIgnored()))
+    {
+        m_resolved.store(changes, std::memory_order_release);
+    }
+}
+
+int MythSettingHandleBase::ReadSetting(const QString &Key, int Default)
+{
+    if (gCoreContext)
+        return gCoreContext->GetNumSetting(Key, Default);
+    return GetMythDB()->GetNumSetting(Key, Default);
+}
+
+bool MythSettingHandleBase::ReadSetting(const QString &Key, bool Default)
+{
+    if (gCoreContext)
+        return gCoreContext->GetBoolSetting(Key, Default);
+    return GetMythDB()->GetBoolSetting(Key, Default);
+}
+
+double MythSettingHandleBase::ReadSetting(const QString &Key, double Default)
+{
+    if (gCoreContext)
+        return gCoreContext->GetFloatSetting(Key, Default);
+    return GetMythDB()->GetFloatSetting(Key, Default);
+}
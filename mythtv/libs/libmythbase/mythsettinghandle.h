@@ -0,0 +1,101 @@
+#ifndef MYTHSETTINGHANDLE_H
+#define MYTHSETTINGHANDLE_H
+
+// C++
+#include <atomic>
+
+// Qt
+#include <QMutex>
+#include <QString>
+
+// MythTV
+#include "mythbaseexp.h"
+
+/*! \brief Common part of MythSettingHandle.
+ *
+ * All handles are registered here so that MythDB can tell them when a
+ * setting changes. That only marks them out of date, the new value is read
+ * by the next Get().
+ */
+class MBASE_PUBLIC MythSettingHandleBase
+{
+  public:
+    static void Invalidate(const QString &Key = QString());
+
+    QString GetKey(void) const { return m_key; }
+
+  protected:
+    explicit MythSettingHandleBase(const QString &Key);
+    virtual ~MythSettingHandleBase();
+
+    bool IsCurrent(void) const
+    {
+        return m_resolved.load(std::memory_order_acquire) ==
+               m_changes.load(std::memory_order_acquire);
+    }
+    void Resolve(void);
+    virtual void Load(void) = 0;
+
+    static int    ReadSetting(const QString &Key, int    Default);
+    static bool   ReadSetting(const QString &Key, bool   Default);
+    static double ReadSetting(const QString &Key, double Default);
+
+    QString m_key;
+
+  private:
+    Q_DISABLE_COPY_MOVE(MythSettingHandleBase)
+
+    std::atomic<uint> m_changes  { 1 };
+    std::atomic<uint> m_resolved { 0 };
+    QMutex            m_resolveLock;
+};
+
+/*! \brief A setting that is looked up once and then read without locking.
+ *
+ * GetNumSetting() and friends lowercase the key, take the settings cache
+ * lock and parse the value on every call. For settings that are read over
+ * and over (in the scheduler, job queue or recorder loops) keep a handle
+ * instead:
+ *
+ * \code
+ * MythSettingHandle<int> m_maxJobs { "JobQueueMaxSimultaneousJobs", 3 };
+ * ...
+ * int maxjobs = m_maxJobs.Get();
+ * \endcode
+ *
+ * The value is read again after the setting is saved, cleared from the
+ * settings cache (e.g. by a CLEAR_SETTINGS_CACHE message) or overridden.
+ * Without an active settings cache every Get() reads the setting.
+ *
+ * T is int, bool or double.
+ */
+template <typename T>
+class MythSettingHandle : public MythSettingHandleBase
+{
+  public:
+    MythSettingHandle(const QString &Key, T Default)
+      : MythSettingHandleBase(Key),
+        m_value(Default),
+        m_default(Default)
+    {
+    }
+
+    T Get(void)
+    {
+        if (!IsCurrent())
+            Resolve();
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+  protected:
+    void Load(void) override
+    {
+        m_value.store(ReadSetting(m_key, m_default), std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<T> m_value;
+    T              m_default;
+};
+
+#endif // MYTHSETTINGHANDLE_H
@@ -3,6 +3,7 @@
 #include <QUrl>
 
 #include "storagegroup.h"
+#include "storagegroupindex.h"
 #include "mythcorecontext.h"
 #include "mythdb.h"
 #include "mythlogging.h"
@@ -633,6 +634,14 @@ QString StorageGroup::FindFile(const QString &filename)
 QString StorageGroup::FindFileDir(const QString &filename)
 {
     QString result = "";
+    if (StorageGroupIndex::FindFileDir(m_dirlist, filename, result))
+    {
+        LOG(VB_FILE, LOG_DEBUG, LOC +
+            QString("FindFileDir: Index has '%1' in '%2'")
+                .arg(filename, result));
+        return result;
+    }
+
     QFileInfo checkFile("");
 
     int curDir = 0;
@@ -783,6 +792,24 @@ void StorageGroup::CheckAllStorageGroupDirs(void)
     }
 }
 
+/** \brief Answer FindFileDir() from an in memory index of the local storage
+ *         group directories where possible, instead of checking each
+ *         directory on disk.
+ *
+ *  This is meant for the backend, which looks up files for every client
+ *  request. The index is kept current with file system change
+ *  notifications until DisableFileIndex() is called.
+ */
+void StorageGroup::EnableFileIndex(void)
+{
+    StorageGroupIndex::Enable();
+}
+
+void StorageGroup::DisableFileIndex(void)
+{
+    StorageGroupIndex::Shutdown();
+}
+
 QStringList StorageGroup::getRecordingsGroups(void)
 {
     QStringList groups;
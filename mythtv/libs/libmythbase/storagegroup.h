@@ -41,6 +41,8 @@ class MBASE_PUBLIC StorageGroup
     QString FindNextDirMostFree(void);
 
     static void CheckAllStorageGroupDirs(void);
+    static void EnableFileIndex(void);
+    static void DisableFileIndex(void);
 
     static const char *kDefaultStorageDir;
     static const QStringList kSpecialGroups;
@@ -0,0 +1,272 @@
+// C++
+#include <algorithm>
+
+// Qt
+#include <QDir>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QTimer>
+
+// MythTV
+#include "filesysteminfo.h"
+#include "mthread.h"
+#include "mythchrono.h"
+#include "mythlogging.h"
+#include "storagegroup.h"
+#include "storagegroupindex.h"
+
+#define LOC QString("SGIndex: ")
+
+// Collects the changes from a burst of file operations into one listing
+static constexpr std::chrono::milliseconds kChangeDelay { 250ms };
+// Network mounts do not report changes made by other hosts
+static constexpr std::chrono::minutes      kRescanInterval { 5min };
+
+StorageGroupIndex *StorageGroupIndex::s_index = nullptr;
+QReadWriteLock     StorageGroupIndex::s_indexLock;
+
+/// Start indexing every storage group directory that exists on this host.
+void StorageGroupIndex::Enable(void)
+{
+    QStringList dirs;
+    StorageGroup::FindDirs("", "", &dirs);
+
+    QWriteLocker locker(&s_indexLock);
+    if (!s_index)
+        s_index = new StorageGroupIndex();
+
+    QMetaObject::invokeMethod(s_index, [dirs](){ s_index->AddDirs(dirs); },
+                              Qt::QueuedConnection);
+}
+
+void StorageGroupIndex::Shutdown(void)
+{
+    QWriteLocker locker(&s_indexLock);
+    if (!s_index)
+        return;
+
+    QMetaObject::invokeMethod(s_index, [](){ s_index->Stop(); },
+                              Qt::BlockingQueuedConnection);
+    delete s_index;
+    s_index = nullptr;
+}
+
+/** \brief Look up the first of Dirs that contains Filename.
+ *
+ *  \return true if Dir was set from the index. false if the index is not
+ *          enabled, does not cover all of Dirs yet, or has not seen the
+ *          file, in which case the caller has to look on disk.
+ */
+bool StorageGroupIndex::FindFileDir(const QStringList &Dirs,
+                                    const QString &Filename, QString &Dir)
+{
+    if (Filename.isEmpty() || Filename.contains('/'))
+        return false;
+
+    QReadLocker locker(&s_indexLock);
+    return s_index && s_index->Find(Dirs, Filename, Dir);
+}
+
+StorageGroupIndex::StorageGroupIndex()
+  : m_thread(new MThread("SGIndex")),
+    m_watcher(new QFileSystemWatcher(this)),
+    m_changeTimer(new QTimer(this)),
+    m_rescanTimer(new QTimer(this))
+{
+    m_changeTimer->setSingleShot(true);
+    m_changeTimer->setInterval(kChangeDelay);
+    m_rescanTimer->setInterval(kRescanInterval);
+
+    connect(m_watcher, &QFileSystemWatcher::directoryChanged,
+            this, &StorageGroupIndex::DirectoryChanged);
+    connect(m_changeTimer, &QTimer::timeout, this, &StorageGroupIndex::ScanChanged);
+    connect(m_rescanTimer, &QTimer::timeout, this, &StorageGroupIndex::Rescan);
+
+    moveToThread(m_thread->qthread());
+    m_thread->start();
+}
+
+StorageGroupIndex::~StorageGroupIndex()
+{
+    m_thread->quit();
+    m_thread->wait();
+    delete m_thread;
+    m_thread = nullptr;
+}
+
+bool StorageGroupIndex::Find(const QStringList &Dirs, const QString &Filename,
+                             QString &Dir)
+{
+    QStringList unindexed;
+    QString found;
+    bool verify = false;
+    {
+        QReadLocker locker(&m_lock);
+        for (const auto &dir : Dirs)
+            if (!m_dirs.contains(dir) && !m_queued.contains(dir))
+                unindexed << dir;
+
+        if (unindexed.isEmpty())
+        {
+            // An earlier directory that is still being listed might also
+            // hold the file, so only answer once all of them are known
+            for (const auto &dir : Dirs)
+                if (!m_dirs.contains(dir))
+                    return false;
+
+            auto it = m_files.constFind(Filename);
+            if (it == m_files.constEnd())
+                return false;
+            auto dir = std::ranges::find_if(Dirs, [&it](const QString &D)
+                                            { return it->contains(D); });
+            if (dir == Dirs.cend())
+                return false;
+            found = *dir;
+            verify = m_rescanDirs.contains(found);
+        }
+    }
+
+    if (unindexed.isEmpty())
+    {
+        // Up to a few minutes old, so the file may have gone since
+        if (verify && !QFileInfo::exists(found + '/' + Filename))
+            return false;
+        Dir = found;
+        return true;
+    }
+
+    QWriteLocker locker(&m_lock);
+    for (const auto &dir : std::as_const(unindexed))
+        m_queued.insert(dir);
+    QMetaObject::invokeMethod(this, [this, unindexed](){ AddDirs(unindexed); },
+                              Qt::QueuedConnection);
+    return false;
+}
+
+void StorageGroupIndex::AddDirs(const QStringList &Dirs)
+{
+    for (const auto &dir : Dirs)
+    {
+        bool known = false;
+        {
+            QReadLocker locker(&m_lock);
+            known = m_dirs.contains(dir);
+        }
+        if (known)
+            continue;
+
+        ScanDir(dir);
+
+        if (!m_rescanDirs.contains(dir) && !FileSystemInfo(QString(), dir).isLocal())
+        {
+            LOG(VB_FILE, LOG_INFO, LOC +
+                QString("'%1' is not local, listing it every %2 minutes")
+                    .arg(dir).arg(kRescanInterval.count()));
+            SetRescan(dir, true);
+        }
+    }
+
+    if (!m_rescanDirs.isEmpty() && !m_rescanTimer->isActive())
+        m_rescanTimer->start();
+}
+
+/// List Dir and bring its part of the index up to date.
+void StorageGroupIndex::ScanDir(const QString &Dir)
+{
+    QDir qdir(Dir);
+    QSet<QString> names;
+    bool exists = qdir.exists();
+    if (exists)
+    {
+        const QStringList list = qdir.entryList(QDir::AllEntries | QDir::System |
+                                                QDir::Hidden | QDir::NoDotAndDotDot);
+        names = QSet<QString>(list.cbegin(), list.cend());
+        if (!m_watcher->directories().contains(Dir) && !m_watcher->addPath(Dir))
+        {
+            LOG(VB_FILE, LOG_WARNING, LOC +
+                QString("Unable to watch '%1' for changes").arg(Dir));
+            SetRescan(Dir, true);
+        }
+    }
+    else
+    {
+        // Listed again later in case it is an unmounted disk
+        SetRescan(Dir, true);
+    }
+
+    int added = 0;
+    int removed = 0;
+    {
+        QWriteLocker locker(&m_lock);
+        QSet<QString> &old = m_dirs[Dir];
+        for (const auto &name : std::as_const(old))
+        {
+            if (names.contains(name))
+                continue;
+            auto it = m_files.find(name);
+            if (it == m_files.end())
+                continue;
+            it->removeOne(Dir);
+            if (it->isEmpty())
+                m_files.erase(it);
+            removed++;
+        }
+        for (const auto &name : std::as_const(names))
+        {
+            if (old.contains(name))
+                continue;
+            m_files[name].append(Dir);
+            added++;
+        }
+        old = names;
+        m_queued.remove(Dir);
+    }
+
+    LOG(VB_FILE, LOG_DEBUG, LOC + QString("Listed '%1': %2 files, +%3 -%4")
+        .arg(Dir).arg(names.size()).arg(added).arg(removed));
+}
+
+void StorageGroupIndex::SetRescan(const QString &Dir, bool Rescan)
+{
+    QWriteLocker locker(&m_lock);
+    if (Rescan)
+        m_rescanDirs.insert(Dir);
+    else
+        m_rescanDirs.remove(Dir);
+}
+
+void StorageGroupIndex::DirectoryChanged(const QString &Dir)
+{
+    m_changed.insert(Dir);
+    if (!m_changeTimer->isActive())
+        m_changeTimer->start();
+}
+
+void StorageGroupIndex::ScanChanged(void)
+{
+    const QSet<QString> changed = m_changed;
+    m_changed.clear();
+    for (const auto &dir : changed)
+        ScanDir(dir);
+}
+
+void StorageGroupIndex::Rescan(void)
+{
+    const QSet<QString> dirs = m_rescanDirs;
+    for (const auto &dir : dirs)
+    {
+        // Directories that have come back are watched again
+        if (QDir(dir).exists() && FileSystemInfo(QString(), dir).isLocal())
+            SetRescan(dir, false);
+        ScanDir(dir);
+    }
+}
+
+void StorageGroupIndex::Stop(void)
+{
+    m_changeTimer->stop();
+    m_rescanTimer->stop();
+    const QStringList dirs = m_watcher->directories();
+    if (!dirs.isEmpty())
+        m_watcher->removePaths(dirs);
+}
@@ -0,0 +1,75 @@
+#ifndef STORAGEGROUPINDEX_H
+#define STORAGEGROUPINDEX_H
+
+// Qt
+#include <QHash>
+#include <QObject>
+#include <QReadWriteLock>
+#include <QSet>
+#include <QStringList>
+
+class MThread;
+class QFileSystemWatcher;
+class QTimer;
+
+/** \class StorageGroupIndex
+ *  \brief Remembers which local storage group directory holds each file.
+ *
+ *  StorageGroup::FindFileDir() checks every directory of a group for the
+ *  file, which wakes sleeping disks and can block on network mounts. The
+ *  index lists each directory once, on its own thread, and then keeps the
+ *  list current with QFileSystemWatcher (inotify on Linux). Directories on
+ *  network mounts, where changes made by other hosts are not reported, and
+ *  directories that could not be read are listed again every few minutes.
+ *
+ *  Only names directly inside a directory are indexed. A file found in the
+ *  index is returned without touching the disk, unless its directory is
+ *  one of those listed every few minutes, where it is checked first.
+ *  Anything else, including a file created moments ago, is left to the
+ *  normal search.
+ */
+class StorageGroupIndex : public QObject
+{
+    Q_OBJECT
+
+  public:
+    static void Enable(void);
+    static void Shutdown(void);
+    static bool FindFileDir(const QStringList &Dirs, const QString &Filename,
+                            QString &Dir);
+
+  private:
+    StorageGroupIndex();
+    ~StorageGroupIndex() override;
+
+    bool Find(const QStringList &Dirs, const QString &Filename, QString &Dir);
+    void AddDirs(const QStringList &Dirs);
+    void ScanDir(const QString &Dir);
+    void SetRescan(const QString &Dir, bool Rescan);
+    void DirectoryChanged(const QString &Dir);
+    void ScanChanged(void);
+    void Rescan(void);
+    void Stop(void);
+
+    static StorageGroupIndex *s_index;
+    /// Only written to create or delete the index
+    static QReadWriteLock     s_indexLock;
+
+    MThread            *m_thread        { nullptr };
+    QFileSystemWatcher *m_watcher       { nullptr };
+    QTimer             *m_changeTimer   { nullptr };
+    QTimer             *m_rescanTimer   { nullptr };
+
+    // Only used on the index thread
+    QSet<QString>       m_changed;
+
+    QReadWriteLock                m_lock;
+    /// Not watched, so listed again every few minutes. Only changed on the
+    /// index thread, which reads it without the lock.
+    QSet<QString>                 m_rescanDirs;
+    QHash<QString, QStringList>   m_files;   ///< name -> directories
+    QHash<QString, QSet<QString>> m_dirs;    ///< directory -> names
+    QSet<QString>                 m_queued;  ///< waiting to be listed
+};
+
+#endif // STORAGEGROUPINDEX_H
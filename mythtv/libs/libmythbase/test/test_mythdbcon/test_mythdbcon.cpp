@@ -18,13 +18,18 @@
  *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
  */
 
+#include <algorithm>
+#include <numeric>
+
 #include "test_mythdbcon.h"
 
 #include "libmythbase/mythcorecontext.h"
+#include "libmythbase/mythdb.h"
 
 void TestDbCon::initTestCase()
 {
     gCoreContext = new MythCoreContext("test_mythdbcon_1.0", nullptr);
+    GetMythTestDB("test_mythdbcon");
 }
 
 void TestDbCon::test_escapeAsQuery_data(void)
@@ -78,6 +83,132 @@ void TestDbCon::test_escapeAsQuery(void)
     QCOMPARE(query, e_result);
 }
 
+void TestDbCon::test_statementCache(void)
+{
+    MSqlQuery create(MSqlQuery::InitCon());
+    QVERIFY(create.exec("CREATE TABLE cachetest (id INTEGER, name TEXT);"));
+
+    // Prepared once, then taken from the connection's cache
+    const QString insert = "INSERT INTO cachetest (id, name) VALUES (:ID, :NAME);";
+    MSqlStatementStats *stats = GetMythDB()->GetDBManager()->GetStatementStats(insert);
+    const QStringList names { "one", "two", "three" };
+    for (int i = 0; i < names.size(); ++i)
+    {
+        MSqlQuery query(MSqlQuery::InitCon());
+        QVERIFY(query.prepare(insert));
+        query.bindValue(":ID", i + 1);
+        query.bindValue(":NAME", names[i]);
+        QVERIFY(query.exec());
+    }
+    QCOMPARE(stats->m_prepares.load(), uint64_t{1});
+    QCOMPARE(stats->m_reuses.load(), uint64_t{2});
+    QCOMPARE(stats->m_execs.load(), uint64_t{3});
+
+    // Counted in the histogram and labelled with this file
+    std::vector<MSqlStatementSummary> summaries =
+        GetMythDB()->GetDBManager()->GetStatementSummaries();
+    auto summary = std::ranges::find(summaries, MSqlNormalizeQuery(insert),
+                                     &MSqlStatementSummary::m_query);
+    QVERIFY(summary != summaries.end());
+    QCOMPARE(std::accumulate(summary->m_histogram.cbegin(), summary->m_histogram.cend(),
+                             uint64_t{0}), uint64_t{3});
+    QCOMPARE(summary->m_callSites.size(), 1);
+    QVERIFY(summary->m_callSites[0].contains("test_mythdbcon.cpp:"));
+    QVERIFY(GetMythDB()->GetDBManager()->GetPoolSummary().m_requests > 0);
+
+    // Prepared again on the same query
+    const QString select = "SELECT name FROM cachetest WHERE id = :ID;";
+    MSqlQuery query(MSqlQuery::InitCon());
+    for (int i = 0; i < names.size(); ++i)
+    {
+        QVERIFY(query.prepare(select));
+        query.bindValue(":ID", i + 1);
+        QVERIFY(query.exec());
+        QVERIFY(query.next());
+        QCOMPARE(query.value(0).toString(), names[i]);
+    }
+
+    // A nested query with the same SQL on the same connection
+    QVERIFY(query.prepare(select));
+    query.bindValue(":ID", 1);
+    QVERIFY(query.exec());
+    {
+        MSqlQuery inner(MSqlQuery::InitCon());
+        QVERIFY(inner.prepare(select));
+        inner.bindValue(":ID", 2);
+        QVERIFY(inner.exec());
+        QVERIFY(inner.next());
+        QCOMPARE(inner.value(0).toString(), names[1]);
+    }
+    QVERIFY(query.next());
+    QCOMPARE(query.value(0).toString(), names[0]);
+
+    // Values in the text share statistics, however many there are
+    QString values = "INSERT INTO cachetest (id, name) VALUES (1, 'a')";
+    for (int i = 2; i < 1000; ++i)
+        values += QString(", (%1, 'x')").arg(i);
+    MDBManager *dbmanager = GetMythDB()->GetDBManager();
+    QCOMPARE(dbmanager->GetStatementStats(values),
+             dbmanager->GetStatementStats("INSERT INTO cachetest (id, name) VALUES (7, 'b')"));
+}
+
+void TestDbCon::test_normalizeQuery_data(void)
+{
+    QTest::addColumn<QString>("query");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("placeholders")
+        << "SELECT title FROM program WHERE chanid = :CHANID;"
+        << "SELECT title FROM program WHERE chanid = :CHANID;";
+    QTest::newRow("numbers")
+        << "SELECT title FROM program WHERE chanid = 1051 AND x264 > 2.5"
+        << "SELECT title FROM program WHERE chanid = ? AND x264 > ?";
+    QTest::newRow("strings")
+        << "UPDATE settings SET data = 'it''s \\'' WHERE value = \"Theme\""
+        << "UPDATE settings SET data = ? WHERE value = ?";
+    QTest::newRow("identifiers")
+        << "SELECT `1st` FROM t1 WHERE t1.id2 = 3"
+        << "SELECT `1st` FROM t1 WHERE t1.id2 = ?";
+    QTest::newRow("lists")
+        << "DELETE FROM record WHERE recordid IN (1,2, 3 ,'4')"
+        << "DELETE FROM record WHERE recordid IN (?, ...)";
+    QTest::newRow("rows")
+        << "INSERT INTO t (a, b) VALUES (1, 'x'), (2, 'y'),(3,'z')"
+        << "INSERT INTO t (a, b) VALUES (?, ...), ...";
+    QTest::newRow("white space")
+        << "  SELECT a\n\t FROM   t  "
+        << "SELECT a FROM t";
+}
+
+void TestDbCon::test_normalizeQuery(void)
+{
+    QFETCH(QString, query);
+    QFETCH(QString, expected);
+
+    QCOMPARE(MSqlNormalizeQuery(query), expected);
+}
+
+void TestDbCon::test_timeHistogram(void)
+{
+    MSqlTimeHistogram histogram;
+    for (int i = 0; i < 90; ++i)
+        histogram.Add(100'000);        // 100 us
+    for (int i = 0; i < 9; ++i)
+        histogram.Add(3'000'000);      // 3 ms
+    histogram.Add(60'000'000'000);     // 1 minute
+
+    MSqlTimeHistogram::Counts counts = histogram.Get();
+    QCOMPARE(counts[0], uint64_t{90});
+    QCOMPARE(counts[5], uint64_t{9});
+    QCOMPARE(counts[MSqlTimeHistogram::kBuckets - 1], uint64_t{1});
+    QCOMPARE(MSqlTimeHistogram::BucketStart(5), int64_t{2048});
+    QCOMPARE(MSqlTimeHistogram::Percentile(counts, 0.5), int64_t{128});
+    QCOMPARE(MSqlTimeHistogram::Percentile(counts, 0.95), int64_t{4096});
+    QCOMPARE(MSqlTimeHistogram::Percentile(counts, 1.0),
+             MSqlTimeHistogram::BucketStart(MSqlTimeHistogram::kBuckets - 1));
+    QCOMPARE(MSqlTimeHistogram::Percentile(MSqlTimeHistogram::Counts {}, 0.5), int64_t{0});
+}
+
 void TestDbCon::cleanupTestCase()
 {
 }
@@ -32,6 +32,10 @@ private slots:
     static void initTestCase();
     static void test_escapeAsQuery_data(void);
     static void test_escapeAsQuery(void);
+    static void test_statementCache(void);
+    static void test_normalizeQuery_data(void);
+    static void test_normalizeQuery(void);
+    static void test_timeHistogram(void);
     static void cleanupTestCase();
 };
 
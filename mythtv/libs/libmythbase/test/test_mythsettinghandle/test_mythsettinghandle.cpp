@@ -0,0 +1,102 @@
+#include "test_mythsettinghandle.h"
+
+#include "libmythbase/mythcorecontext.h"
+#include "libmythbase/mythdb.h"
+#include "libmythbase/mythsettinghandle.h"
+
+void TestSettingHandle::initTestCase(void)
+{
+    gCoreContext = new MythCoreContext("test_mythsettinghandle_1.0", nullptr);
+    // Settings only come from session overrides
+    GetMythDB()->IgnoreDatabase(true);
+}
+
+void TestSettingHandle::cleanupTestCase(void)
+{
+    delete gCoreContext;
+    gCoreContext = nullptr;
+}
+
+void TestSettingHandle::init(void)
+{
+    GetMythDB()->ActivateSettingsCache(true);
+    GetMythDB()->ClearOverrideSettingForSession("TestHandleNum");
+    GetMythDB()->ClearOverrideSettingForSession("TestHandleBool");
+    GetMythDB()->ClearOverrideSettingForSession("TestHandleFloat");
+}
+
+void TestSettingHandle::Defaults(void)
+{
+    MythSettingHandle<int> num("TestHandleNum", 7);
+    MythSettingHandle<bool> flag("TestHandleBool", true);
+    MythSettingHandle<double> real("TestHandleFloat", 2.5);
+    QCOMPARE(num.Get(), 7);
+    QCOMPARE(flag.Get(), true);
+    QCOMPARE(real.Get(), 2.5);
+}
+
+void TestSettingHandle::Override(void)
+{
+    MythSettingHandle<int> num("TestHandleNum", 7);
+    MythSettingHandle<bool> flag("TestHandleBool", true);
+    QCOMPARE(num.Get(), 7);
+
+    gCoreContext->OverrideSettingForSession("TestHandleNum", "12");
+    gCoreContext->OverrideSettingForSession("TestHandleBool", "0");
+    QCOMPARE(num.Get(), 12);
+    QCOMPARE(flag.Get(), false);
+
+    // Keys are not case sensitive
+    gCoreContext->OverrideSettingForSession("testhandlenum", "13");
+    QCOMPARE(num.Get(), 13);
+
+    gCoreContext->ClearOverrideSettingForSession("TestHandleNum");
+    QCOMPARE(num.Get(), 7);
+}
+
+void TestSettingHandle::ClearCache(void)
+{
+    MythSettingHandle<int> num("TestHandleNum", 7);
+    gCoreContext->OverrideSettingForSession("TestHandleNum", "12");
+    QCOMPARE(num.Get(), 12);
+
+    // As sent for a change made in another process
+    gCoreContext->ClearSettingsCache();
+    QCOMPARE(num.Get(), 12);
+    gCoreContext->ClearSettingsCache(gCoreContext->GetHostName() + " TestHandleNum");
+    QCOMPARE(num.Get(), 12);
+}
+
+void TestSettingHandle::CacheInactive(void)
+{
+    GetMythDB()->ActivateSettingsCache(false);
+    MythSettingHandle<int> num("TestHandleNum", 7);
+    QCOMPARE(num.Get(), 7);
+    gCoreContext->OverrideSettingForSession("TestHandleNum", "12");
+    QCOMPARE(num.Get(), 12);
+}
+
+void TestSettingHandle::Read_data(void)
+{
+    QTest::addColumn<bool>("handle");
+    QTest::newRow("GetNumSetting") << false;
+    QTest::newRow("handle")        << true;
+}
+
+// What a loop that reads a setting every pass pays for it
+void TestSettingHandle::Read(void)
+{
+    QFETCH(bool, handle);
+    gCoreContext->OverrideSettingForSession("TestHandleNum", "12");
+    MythSettingHandle<int> num("TestHandleNum", 7);
+
+    int total = 0;
+    QBENCHMARK
+    {
+        for (int i = 0; i < 1000; ++i)
+            total += handle ? num.Get() : gCoreContext->GetNumSetting("TestHandleNum", 7);
+    }
+    QVERIFY(total > 0);
+}
+
+QTEST_GUILESS_MAIN(TestSettingHandle)
@@ -0,0 +1,23 @@
+#ifndef LIBMYTHBASE_TEST_MYTHSETTINGHANDLE_H
+#define LIBMYTHBASE_TEST_MYTHSETTINGHANDLE_H
+
+#include <QTest>
+
+class TestSettingHandle : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    static void initTestCase(void);
+    static void cleanupTestCase(void);
+    static void init(void);
+
+    static void Defaults(void);
+    static void Override(void);
+    static void ClearCache(void);
+    static void CacheInactive(void);
+    static void Read_data(void);
+    static void Read(void);
+};
+
+#endif // LIBMYTHBASE_TEST_MYTHSETTINGHANDLE_H
@@ -47,6 +47,9 @@ const uint ThreadedFileWriter::kMaxBufferSize   = 8 * 1024 * 1024;
 const uint ThreadedFileWriter::kMinWriteSize    = 64 * 1024;
 const uint ThreadedFileWriter::kMaxBlockSize    = 1 * 1024 * 1024;
 
+QMutex                   ThreadedFileWriter::s_deviceLock;
+QHash<quint64, uint64_t> ThreadedFileWriter::s_deviceBytes;
+
 /** \class ThreadedFileWriter
  *  \brief This class supports the writing of recordings to disk.
  *
@@ -117,6 +120,10 @@ bool ThreadedFileWriter::Open(void)
     gCoreContext->RegisterFileForWrite(m_filename);
     m_registered = true;
 
+    struct stat st {};
+    m_haveDevice = (fstat(m_fd, &st) == 0);
+    m_device = m_haveDevice ? st.st_dev : 0;
+
     LOG(VB_FILE, LOG_INFO, LOC + "Open() successful");
 
 #ifdef Q_OS_WINDOWS
@@ -512,6 +519,8 @@ void ThreadedFileWriter::DiskLoop(void)
             {
                 tot += ret;
                 total_written += ret;
+                if (m_haveDevice)
+                    AddDeviceBytesWritten(m_device, ret);
                 LOG(VB_FILE, LOG_DEBUG, LOC +
                     QString("total written so far: %1 bytes")
                     .arg(total_written));
@@ -621,3 +630,21 @@ bool ThreadedFileWriter::SetBlocking(bool block)
     m_blocking = block;
     return old;
 }
+
+/** \brief Total bytes written so far by all ThreadedFileWriters to files on
+ *         the given device.
+ *
+ *  Sampling this twice gives the current recording write rate on a disk,
+ *  which background tasks such as deletes can use to stay out of the way.
+ */
+uint64_t ThreadedFileWriter::GetDeviceBytesWritten(dev_t device)
+{
+    QMutexLocker locker(&s_deviceLock);
+    return s_deviceBytes.value(static_cast<quint64>(device), 0);
+}
+
+void ThreadedFileWriter::AddDeviceBytesWritten(dev_t device, uint64_t bytes)
+{
+    QMutexLocker locker(&s_deviceLock);
+    s_deviceBytes[static_cast<quint64>(device)] += bytes;
+}
@@ -4,12 +4,14 @@
 
 #include <cstdint>
 #include <fcntl.h>
+#include <sys/types.h>
 #include <utility>
 #include <vector>
 
 // Qt headers
 #include <QWaitCondition>
 #include <QDateTime>
+#include <QHash>
 #include <QString>
 #include <QMutex>
 
@@ -66,10 +68,13 @@ class MBASE_PUBLIC ThreadedFileWriter
     bool SetBlocking(bool block = true);
     bool WritesFailing(void) const { return m_ignoreWrites; }
 
+    static uint64_t GetDeviceBytesWritten(dev_t device);
+
   protected:
     void DiskLoop(void);
     void SyncLoop(void);
     void TrimEmptyBuffers(void);
+    static void AddDeviceBytesWritten(dev_t device, uint64_t bytes);
 
   private:
     // file info
@@ -77,6 +82,8 @@ class MBASE_PUBLIC ThreadedFileWriter
     int             m_flags;
     mode_t          m_mode;
     int             m_fd                 {-1};
+    dev_t           m_device             {0};
+    bool            m_haveDevice         {false};
 
     // state
     bool            m_flush              {false};         // protected by buflock
@@ -113,6 +120,10 @@ class MBASE_PUBLIC ThreadedFileWriter
     /// Maximum block size to write at a time
     static const uint kMaxBlockSize;
 
+    /// Bytes written by all writers, per device the files are on
+    static QMutex                   s_deviceLock;
+    static QHash<quint64, uint64_t> s_deviceBytes;
+
     bool m_warned                        {false};
     bool m_blocking                      {false};
     bool m_registered                    {false};
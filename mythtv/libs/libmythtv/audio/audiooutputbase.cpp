@@ -1162,7 +1162,8 @@ void AudioOutputBase::Reconfigure(const AudioSettings &orig_settings)
     {
         m_surroundMode = gCoreContext->GetNumSetting("AudioUpmixType", QUALITY_HIGH);
         m_upmixer = new FreeSurround(m_sampleRate, m_source == AUDIOOUTPUT_VIDEO,
-                                   (FreeSurround::SurroundMode)m_surroundMode);
+                                   (FreeSurround::SurroundMode)m_surroundMode,
+                                   gCoreContext->GetBoolSetting("AudioUpmixFast", false));
         LOG(VB_AUDIO, LOG_INFO, LOC + QString("Create %1 quality upmixer done")
                 .arg(quality_string(m_surroundMode)));
     }
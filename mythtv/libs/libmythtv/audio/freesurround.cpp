@@ -73,13 +73,14 @@ struct buffers
 int channel_select = -1;
 #endif
 
-FreeSurround::FreeSurround(uint srate, bool moviemode, SurroundMode smode) :
+FreeSurround::FreeSurround(uint srate, bool moviemode, SurroundMode smode, bool fast) :
     m_srate(srate),
+    m_fast(fast),
     m_surroundMode(smode)
 {
     LOG(VB_AUDIO, LOG_DEBUG,
-        QString("FreeSurround::FreeSurround rate %1 moviemode %2")
-            .arg(srate).arg(moviemode));
+        QString("FreeSurround::FreeSurround rate %1 moviemode %2 fast %3")
+            .arg(srate).arg(moviemode).arg(fast));
 
     if (moviemode)
     {
@@ -126,6 +127,7 @@ void FreeSurround::SetParams()
         m_decoder->phase_mode(m_params.phasemode);
         m_decoder->surround_coefficients(m_params.coeff_a, m_params.coeff_b);
         m_decoder->separation(m_params.front_sep/100.0F,m_params.rear_sep/100.0F);
+        m_decoder->fast_mode(m_fast);
     }
 }
 
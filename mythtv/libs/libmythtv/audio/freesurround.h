@@ -37,7 +37,7 @@ public:
         SurroundModePassiveHall
     };
 public:
-    FreeSurround(uint srate, bool moviemode, SurroundMode mode);
+    FreeSurround(uint srate, bool moviemode, SurroundMode mode, bool fast = false);
     ~FreeSurround();
 
     // put frames in buffer, returns number of frames used
@@ -77,6 +77,7 @@ private:
 
     // additional settings
     uint m_srate;
+    bool m_fast;                                  // use the approximating decoder
 
     // info about the current setup
     struct buffers          *m_bufs    {nullptr}; // our buffers
@@ -17,6 +17,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 */
 #include "freesurround_decoder.h"
 
+#include "libmythbase/mythconfig.h"
+
 #include <algorithm>
 #include <array>
 #include <cmath>
@@ -26,10 +28,26 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 #include <numbers>
 #include <vector>
 extern "C" {
+#include "libavutil/cpu.h"
 #include "libavutil/mem.h"
 #include "libavutil/tx.h"
 }
 
+#include <QtGlobal>
+#if QT_VERSION >= QT_VERSION_CHECK(6,5,0)
+#include <QtProcessorDetection>
+#endif
+
+#ifdef Q_PROCESSOR_X86_64
+#   include <emmintrin.h>
+static const bool s_haveSIMD = true;
+#elif HAVE_INTRINSICS_NEON
+#   include <arm_neon.h>
+static const bool s_haveSIMD = av_get_cpu_flags() & AV_CPU_FLAG_NEON;
+#else
+static const bool s_haveSIMD = false;
+#endif
+
 using cfloat = std::complex<float>;
 using InputBufs  = std::array<float*,2>;
 using OutputBufs = std::array<float*,6>;
@@ -41,6 +59,10 @@ static const float center_level = 0.5F*sqrtf(0.5F);
 template <class T>
 T sqr(T x) { return x*x; }
 
+// the resolution of the fast mode steering tables
+static constexpr unsigned kSteeringSize  { 128 };
+static constexpr unsigned kSteeringWidth { kSteeringSize + 1 };
+
 // private implementation of the surround decoder
 class fsurround_decoder::Impl {
 public:
@@ -175,11 +197,22 @@ public:
         const std::array<std::array<float,2>,4> modes {{ {0,0}, {0,PI}, {PI,0}, {-PI/2,PI/2} }};
         m_phaseOffsetL = modes[mode][0];
         m_phaseOffsetR = modes[mode][1];
+        m_rotateL = polar(1, m_phaseOffsetL);
+        m_rotateR = polar(1, m_phaseOffsetR);
     }
 
     // what steering mode should be chosen
     void steering_mode(bool mode) { m_linearSteering = mode; }
 
+    // use the vectorised, approximating per bin decode
+    void fast_mode(bool fast) {
+        m_fast = fast;
+        if (m_fast && m_ampDiff.empty()) {
+            m_ampDiff.resize(m_n);
+            m_phaseDiff.resize(m_n);
+        }
+    }
+
     // set front & rear separation controls
     void separation(float front, float rear) {
         m_frontSeparation = front;
@@ -227,6 +260,23 @@ private:
 
         // 2. compare amplitude and phase of each DFT bin and produce the X/Y coordinates in the sound field
         //    but dont do DC or N/2 component
+        // 3. generate frequency filters for each output channel
+        if (m_fast)
+            decode_bins_fast(center_width, dimension, adaption_rate);
+        else
+            decode_bins(center_width, dimension, adaption_rate);
+
+        // 4. distribute the unfiltered reference signals over the channels
+        apply_filter((m_frontL).data(), m_filter[0].data(),&output[0][0]);  // front left
+        apply_filter((m_avg).data(),    m_filter[1].data(),&output[1][0]);  // front center
+        apply_filter((m_frontR).data(), m_filter[2].data(),&output[2][0]);  // front right
+        apply_filter((m_surL).data(),   m_filter[3].data(),&output[3][0]);  // surround left
+        apply_filter((m_surR).data(),   m_filter[4].data(),&output[4][0]);  // surround right
+        apply_filter((m_trueavg).data(),m_filter[5].data(),&output[5][0]);  // lfe
+    }
+
+    // steps 2 and 3 of block_decode
+    void decode_bins(float center_width, float dimension, float adaption_rate) {
         for (unsigned f=0;f<m_halfN;f++) {
             // get left/right amplitudes/phases
             float ampL = amplitude(m_dftL[f]);
@@ -324,14 +374,293 @@ private:
             m_surR[f] = polar(ampL+ampR,phaseR+m_phaseOffsetR);
             m_trueavg[f] = cfloat(m_dftL[f].re + m_dftR[f].re, m_dftL[f].im + m_dftR[f].im);
         }
+    }
 
-        // 4. distribute the unfiltered reference signals over the channels
-        apply_filter((m_frontL).data(), m_filter[0].data(),&output[0][0]);  // front left
-        apply_filter((m_avg).data(),    m_filter[1].data(),&output[1][0]);  // front center
-        apply_filter((m_frontR).data(), m_filter[2].data(),&output[2][0]);  // front right
-        apply_filter((m_surL).data(),   m_filter[3].data(),&output[3][0]);  // surround left
-        apply_filter((m_surR).data(),   m_filter[4].data(),&output[4][0]);  // surround right
-        apply_filter((m_trueavg).data(),m_filter[5].data(),&output[5][0]);  // lfe
+    // steps 2 and 3 of block_decode, approximated
+    //  - the signals to be positioned are built by scaling the DFT bins rather than
+    //    by a round trip through polar coordinates, with SIMD where available
+    //  - the phase difference comes from a polynomial atan2 of L * conj(R)
+    //  - the linear steering position comes from an interpolated table
+    void decode_bins_fast(float center_width, float dimension, float adaption_rate) {
+        unsigned start = s_haveSIMD ? analyse_bins_simd() : 0;
+        for (unsigned f = start; f < m_halfN; f++)
+            analyse_bin(f);
+
+        const auto & table = steering_table();
+        for (unsigned f=0;f<m_halfN;f++) {
+            float ampDiff = m_ampDiff[f];
+            float xfs = NAN;
+            float yfs = NAN;
+            if (m_linearSteering) {
+                // bilinear interpolation; yfs is even and xfs odd in ampDiff
+                float x = std::abs(ampDiff) * kSteeringSize;
+                float y = m_phaseDiff[f] * (kSteeringSize / PI);
+                auto xi = std::min(static_cast<unsigned>(x), kSteeringSize - 1);
+                auto yi = std::min(static_cast<unsigned>(y), kSteeringSize - 1);
+                float xf = x - xi;
+                float yf = y - yi;
+                unsigned i = (yi * kSteeringWidth) + xi;
+                auto lerp2 = [&](const std::vector<float> &t) {
+                    float top = t[i] + (xf * (t[i + 1] - t[i]));
+                    float bot = t[i + kSteeringWidth] + (xf * (t[i + kSteeringWidth + 1] - t[i + kSteeringWidth]));
+                    return top + (yf * (bot - top));
+                };
+                yfs = lerp2(table[0]);
+                xfs = std::copysign(lerp2(table[1]), ampDiff);
+            } else {
+                xfs = ampDiff;
+                yfs = 1 - ((m_phaseDiff[f]/PI)*2);
+                if (std::abs(xfs) > m_surroundBalance) {
+                    float frontness = (std::abs(xfs) - m_surroundBalance)/(1-m_surroundBalance);
+                    yfs = ((1-frontness) * yfs) + frontness;
+                }
+            }
+
+            yfs = clamp_unit_mag(yfs - dimension);
+            xfs = clamp_unit_mag(xfs * ((m_frontSeparation*(1+yfs)/2) + (m_rearSeparation*(1-yfs)/2)));
+            m_xFs[f] = xfs;
+            m_yFs[f] = yfs;
+
+            float left = (1-xfs)/2;
+            float right = (1+xfs)/2;
+            float front = (1+yfs)/2;
+            float back = (1-yfs)/2;
+            float surroundLeft = left;
+            float surroundRight = right;
+            if (!m_linearSteering) {
+                surroundLeft  = std::clamp((1.0F - (xfs / m_surroundBalance)) / 2.0F, 0.0F, 1.0F);
+                surroundRight = std::clamp((1.0F + (xfs / m_surroundBalance)) / 2.0F, 0.0F, 1.0F);
+            }
+            std::array<float, 5> volume
+            {
+                front * ((left  * center_width) + (std::max(0.0F, -xfs) * (1.0F - center_width))), // left
+                front * center_level * ((1.0F - std::abs(xfs)) * (1.0F - center_width)),          // center
+                front * ((right * center_width) + (std::max(0.0F,  xfs) * (1.0F - center_width))), // right
+                back * m_surroundLevel * surroundLeft,                                              // left surround
+                back * m_surroundLevel * surroundRight                                              // right surround
+            };
+
+            for (unsigned c=0;c<5;c++)
+                m_filter[c][f] = ((1-adaption_rate)*m_filter[c][f]) + (adaption_rate*volume[c]);
+        }
+    }
+
+    // approximate atan2 for y >= 0, max error around 1e-5 radians
+    static float fast_atan2(float y, float x) {
+        float ax = std::abs(x);
+        float a = std::min(ax, y) / std::max(std::max(ax, y), 1e-30F);
+        float s = a * a;
+        float r = ((((-0.0464964749F * s) + 0.15931422F) * s - 0.327622764F) * s * a) + a;
+        if (y > ax) r = (PI / 2) - r;
+        if (x < 0) r = PI - r;
+        return r;
+    }
+
+    // amplitude/phase differences and the signals to be positioned for one bin
+    void analyse_bin(unsigned f) {
+        AVComplexFloat l = m_dftL[f];
+        AVComplexFloat r = m_dftR[f];
+        float ampL = std::sqrt((l.re * l.re) + (l.im * l.im));
+        float ampR = std::sqrt((r.re * r.re) + (r.im * r.im));
+        float sum = ampL + ampR;
+        m_ampDiff[f] = clamp_unit_mag((sum < epsilon) ? 0 : (ampR - ampL) / sum);
+        // the phase difference is the argument of L * conj(R)
+        m_phaseDiff[f] = fast_atan2(std::abs((l.im * r.re) - (l.re * r.im)), (l.re * r.re) + (l.im * r.im));
+        // polar(ampL+ampR, phaseL) is L scaled by (ampL+ampR)/ampL
+        float scaleL = sum / std::max(ampL, 1e-30F);
+        float scaleR = sum / std::max(ampR, 1e-30F);
+        m_frontL[f] = cfloat(l.re * scaleL, l.im * scaleL);
+        m_frontR[f] = cfloat(r.re * scaleR, r.im * scaleR);
+        m_avg[f] = m_frontL[f] + m_frontR[f];
+        m_surL[f] = m_frontL[f] * m_rotateL;
+        m_surR[f] = m_frontR[f] * m_rotateR;
+        m_trueavg[f] = cfloat(l.re + r.re, l.im + r.im);
+    }
+
+    // analyse_bin() four bins at a time, returns the number of bins processed
+    unsigned analyse_bins_simd() {
+        unsigned count = m_halfN & ~3U;
+#if defined(Q_PROCESSOR_X86_64)
+        const __m128 zero  = _mm_setzero_ps();
+        const __m128 one   = _mm_set1_ps(1.0F);
+        const __m128 tiny  = _mm_set1_ps(1e-30F);
+        const __m128 eps   = _mm_set1_ps(epsilon);
+        const __m128 sign  = _mm_set1_ps(-0.0F);
+        const __m128 pi    = _mm_set1_ps(PI);
+        const __m128 pi2   = _mm_set1_ps(PI / 2);
+        const __m128 c0    = _mm_set1_ps(-0.0464964749F);
+        const __m128 c1    = _mm_set1_ps(0.15931422F);
+        const __m128 c2    = _mm_set1_ps(-0.327622764F);
+        const __m128 rotLr = _mm_set1_ps(m_rotateL.real());
+        const __m128 rotLi = _mm_set1_ps(m_rotateL.imag());
+        const __m128 rotRr = _mm_set1_ps(m_rotateR.real());
+        const __m128 rotRi = _mm_set1_ps(m_rotateR.imag());
+        auto * ptrL = reinterpret_cast<const float*>(m_dftL);
+        auto * ptrR = reinterpret_cast<const float*>(m_dftR);
+
+        auto store = [](cfloat *dest, __m128 re, __m128 im) {
+            auto * ptr = reinterpret_cast<float*>(dest);
+            _mm_storeu_ps(ptr,     _mm_unpacklo_ps(re, im));
+            _mm_storeu_ps(ptr + 4, _mm_unpackhi_ps(re, im));
+        };
+
+        for (unsigned f = 0; f < count; f += 4) {
+            // deinterleave 4 complex values
+            __m128 a = _mm_loadu_ps(ptrL + (2 * f));
+            __m128 b = _mm_loadu_ps(ptrL + (2 * f) + 4);
+            __m128 lre = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2,0,2,0));
+            __m128 lim = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3,1,3,1));
+            a = _mm_loadu_ps(ptrR + (2 * f));
+            b = _mm_loadu_ps(ptrR + (2 * f) + 4);
+            __m128 rre = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2,0,2,0));
+            __m128 rim = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3,1,3,1));
+
+            __m128 ampL = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(lre, lre), _mm_mul_ps(lim, lim)));
+            __m128 ampR = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(rre, rre), _mm_mul_ps(rim, rim)));
+            __m128 sum  = _mm_add_ps(ampL, ampR);
+
+            // amplitude difference
+            __m128 diff = _mm_div_ps(_mm_sub_ps(ampR, ampL), _mm_max_ps(sum, tiny));
+            diff = _mm_and_ps(diff, _mm_cmpge_ps(sum, eps));
+            diff = _mm_max_ps(_mm_min_ps(diff, one), _mm_sub_ps(zero, one));
+            _mm_storeu_ps(&m_ampDiff[f], diff);
+
+            // phase difference
+            __m128 y  = _mm_andnot_ps(sign, _mm_sub_ps(_mm_mul_ps(lim, rre), _mm_mul_ps(lre, rim)));
+            __m128 x  = _mm_add_ps(_mm_mul_ps(lre, rre), _mm_mul_ps(lim, rim));
+            __m128 ax = _mm_andnot_ps(sign, x);
+            __m128 ratio = _mm_div_ps(_mm_min_ps(ax, y), _mm_max_ps(_mm_max_ps(ax, y), tiny));
+            __m128 s  = _mm_mul_ps(ratio, ratio);
+            __m128 r  = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(c0, s), c1), s), c2), s), ratio), ratio);
+            __m128 mask = _mm_cmpgt_ps(y, ax);
+            r = _mm_or_ps(_mm_and_ps(mask, _mm_sub_ps(pi2, r)), _mm_andnot_ps(mask, r));
+            mask = _mm_cmplt_ps(x, zero);
+            r = _mm_or_ps(_mm_and_ps(mask, _mm_sub_ps(pi, r)), _mm_andnot_ps(mask, r));
+            _mm_storeu_ps(&m_phaseDiff[f], r);
+
+            // the signals to be positioned
+            __m128 scaleL = _mm_div_ps(sum, _mm_max_ps(ampL, tiny));
+            __m128 scaleR = _mm_div_ps(sum, _mm_max_ps(ampR, tiny));
+            __m128 flre = _mm_mul_ps(lre, scaleL);
+            __m128 flim = _mm_mul_ps(lim, scaleL);
+            __m128 frre = _mm_mul_ps(rre, scaleR);
+            __m128 frim = _mm_mul_ps(rim, scaleR);
+            store(&m_frontL[f], flre, flim);
+            store(&m_frontR[f], frre, frim);
+            store(&m_avg[f], _mm_add_ps(flre, frre), _mm_add_ps(flim, frim));
+            store(&m_surL[f], _mm_sub_ps(_mm_mul_ps(flre, rotLr), _mm_mul_ps(flim, rotLi)),
+                              _mm_add_ps(_mm_mul_ps(flre, rotLi), _mm_mul_ps(flim, rotLr)));
+            store(&m_surR[f], _mm_sub_ps(_mm_mul_ps(frre, rotRr), _mm_mul_ps(frim, rotRi)),
+                              _mm_add_ps(_mm_mul_ps(frre, rotRi), _mm_mul_ps(frim, rotRr)));
+            store(&m_trueavg[f], _mm_add_ps(lre, rre), _mm_add_ps(lim, rim));
+        }
+#elif HAVE_INTRINSICS_NEON
+        const float32x4_t zero  = vdupq_n_f32(0.0F);
+        const float32x4_t one   = vdupq_n_f32(1.0F);
+        const float32x4_t tiny  = vdupq_n_f32(1e-30F);
+        const float32x4_t eps   = vdupq_n_f32(epsilon);
+        const float32x4_t pi    = vdupq_n_f32(PI);
+        const float32x4_t pi2   = vdupq_n_f32(PI / 2);
+        const float32x4_t c0    = vdupq_n_f32(-0.0464964749F);
+        const float32x4_t c1    = vdupq_n_f32(0.15931422F);
+        const float32x4_t c2    = vdupq_n_f32(-0.327622764F);
+        const float32x4_t rotLr = vdupq_n_f32(m_rotateL.real());
+        const float32x4_t rotLi = vdupq_n_f32(m_rotateL.imag());
+        const float32x4_t rotRr = vdupq_n_f32(m_rotateR.real());
+        const float32x4_t rotRi = vdupq_n_f32(m_rotateR.imag());
+        auto * ptrL = reinterpret_cast<const float*>(m_dftL);
+        auto * ptrR = reinterpret_cast<const float*>(m_dftR);
+
+        // there is no vector divide on 32bit ARM, so refine the reciprocal estimate
+        auto divide = [](float32x4_t n, float32x4_t d) {
+            float32x4_t inv = vrecpeq_f32(d);
+            inv = vmulq_f32(vrecpsq_f32(d, inv), inv);
+            inv = vmulq_f32(vrecpsq_f32(d, inv), inv);
+            return vmulq_f32(n, inv);
+        };
+        auto sqrt = [](float32x4_t v) {
+            float32x4_t safe = vmaxq_f32(v, vdupq_n_f32(1e-30F));
+            float32x4_t inv = vrsqrteq_f32(safe);
+            inv = vmulq_f32(vrsqrtsq_f32(vmulq_f32(safe, inv), inv), inv);
+            inv = vmulq_f32(vrsqrtsq_f32(vmulq_f32(safe, inv), inv), inv);
+            return vmulq_f32(v, inv);
+        };
+        auto store = [](cfloat *dest, float32x4_t re, float32x4_t im) {
+            float32x4x2_t v { re, im };
+            vst2q_f32(reinterpret_cast<float*>(dest), v);
+        };
+
+        for (unsigned f = 0; f < count; f += 4) {
+            float32x4x2_t l = vld2q_f32(ptrL + (2 * f));
+            float32x4x2_t r = vld2q_f32(ptrR + (2 * f));
+            float32x4_t lre = l.val[0];
+            float32x4_t lim = l.val[1];
+            float32x4_t rre = r.val[0];
+            float32x4_t rim = r.val[1];
+
+            float32x4_t ampL = sqrt(vmlaq_f32(vmulq_f32(lre, lre), lim, lim));
+            float32x4_t ampR = sqrt(vmlaq_f32(vmulq_f32(rre, rre), rim, rim));
+            float32x4_t sum  = vaddq_f32(ampL, ampR);
+
+            // amplitude difference
+            float32x4_t diff = divide(vsubq_f32(ampR, ampL), vmaxq_f32(sum, tiny));
+            diff = vbslq_f32(vcgeq_f32(sum, eps), diff, zero);
+            diff = vmaxq_f32(vminq_f32(diff, one), vnegq_f32(one));
+            vst1q_f32(&m_ampDiff[f], diff);
+
+            // phase difference
+            float32x4_t y  = vabsq_f32(vmlsq_f32(vmulq_f32(lim, rre), lre, rim));
+            float32x4_t x  = vmlaq_f32(vmulq_f32(lre, rre), lim, rim);
+            float32x4_t ax = vabsq_f32(x);
+            float32x4_t ratio = divide(vminq_f32(ax, y), vmaxq_f32(vmaxq_f32(ax, y), tiny));
+            float32x4_t s  = vmulq_f32(ratio, ratio);
+            float32x4_t p  = vmlaq_f32(c2, vmlaq_f32(c1, c0, s), s);
+            float32x4_t res = vmlaq_f32(ratio, vmulq_f32(p, s), ratio);
+            res = vbslq_f32(vcgtq_f32(y, ax), vsubq_f32(pi2, res), res);
+            res = vbslq_f32(vcltq_f32(x, zero), vsubq_f32(pi, res), res);
+            vst1q_f32(&m_phaseDiff[f], res);
+
+            // the signals to be positioned
+            float32x4_t scaleL = divide(sum, vmaxq_f32(ampL, tiny));
+            float32x4_t scaleR = divide(sum, vmaxq_f32(ampR, tiny));
+            float32x4_t flre = vmulq_f32(lre, scaleL);
+            float32x4_t flim = vmulq_f32(lim, scaleL);
+            float32x4_t frre = vmulq_f32(rre, scaleR);
+            float32x4_t frim = vmulq_f32(rim, scaleR);
+            store(&m_frontL[f], flre, flim);
+            store(&m_frontR[f], frre, frim);
+            store(&m_avg[f], vaddq_f32(flre, frre), vaddq_f32(flim, frim));
+            store(&m_surL[f], vmlsq_f32(vmulq_f32(flre, rotLr), flim, rotLi),
+                              vmlaq_f32(vmulq_f32(flre, rotLi), flim, rotLr));
+            store(&m_surR[f], vmlsq_f32(vmulq_f32(frre, rotRr), frim, rotRi),
+                              vmlaq_f32(vmulq_f32(frre, rotRi), frim, rotRr));
+            store(&m_trueavg[f], vaddq_f32(lre, rre), vaddq_f32(lim, rim));
+        }
+#else
+        count = 0;
+#endif
+        return count;
+    }
+
+    // yfs and xfs (for a positive amplitude difference) over the amplitude
+    // difference [0..1] and phase difference [0..PI], for linear steering
+    static const std::array<std::vector<float>,2>& steering_table() {
+        static const std::array<std::vector<float>,2> s_table = [] {
+            std::array<std::vector<float>,2> table;
+            table[0].resize(static_cast<size_t>(kSteeringWidth) * kSteeringWidth);
+            table[1].resize(static_cast<size_t>(kSteeringWidth) * kSteeringWidth);
+            for (unsigned p = 0; p < kSteeringWidth; p++) {
+                for (unsigned a = 0; a < kSteeringWidth; a++) {
+                    double ampDiff = static_cast<double>(a) / kSteeringSize;
+                    double phaseDiff = M_PI * p / kSteeringSize;
+                    double yfs = get_yfs(ampDiff, phaseDiff);
+                    table[0][(p * kSteeringWidth) + a] = static_cast<float>(yfs);
+                    table[1][(p * kSteeringWidth) + a] = static_cast<float>(get_xfs(ampDiff, yfs));
+                }
+            }
+            return table;
+        }();
+        return s_table;
     }
 
 #define FASTER_CALC
@@ -432,6 +761,7 @@ private:
     std::vector<cfloat> m_frontL,m_frontR,m_avg,m_surL,m_surR; // the signal (phase-corrected) in the frequency domain
     std::vector<cfloat> m_trueavg;       // for lfe generation
     std::vector<float> m_xFs,m_yFs;      // the feature space positions for each frequency bin
+    std::vector<float> m_ampDiff,m_phaseDiff; // per bin differences, fast mode only
     std::vector<float> m_wnd;            // the window function, precalculated
     std::array<std::vector<float>,6> m_filter;      // a frequency filter for each output channel
     std::array<std::vector<float>,2> m_inbuf;       // the sliding input buffers
@@ -443,9 +773,11 @@ private:
     float m_surroundLevel   {0.0F};      // gain for the surround channels (follows from the coeffs
     float m_phaseOffsetL    {0.0F};      // phase shifts to be applied to the rear channels
     float m_phaseOffsetR    {0.0F};      // phase shifts to be applied to the rear channels
+    cfloat m_rotateL, m_rotateR;         // the same phase shifts as unit vectors
     float m_frontSeparation {0.0F};      // front stereo separation
     float m_rearSeparation  {0.0F};      // rear stereo separation
     bool  m_linearSteering  {false};     // whether the steering should be linear or not
+    bool  m_fast            {false};     // whether to use the approximating decode
     cfloat m_a,m_b,m_c,m_d,m_e,m_f,m_g,m_h; // coefficients for the linear steering
     int m_currentBuf;                    // specifies which buffer is 2nd half of input sliding buffer
     InputBufs  m_inbufs     {};          // for passing back to driver
@@ -471,6 +803,8 @@ void fsurround_decoder::phase_mode(unsigned mode) { m_impl->phase_mode(mode); }
 
 void fsurround_decoder::steering_mode(bool mode) { m_impl->steering_mode(mode); }
 
+void fsurround_decoder::fast_mode(bool fast) { m_impl->fast_mode(fast); }
+
 void fsurround_decoder::separation(float front, float rear) { m_impl->separation(front,rear); }
 
 float ** fsurround_decoder::getInputBuffers()
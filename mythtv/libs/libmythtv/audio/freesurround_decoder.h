@@ -19,8 +19,10 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 #ifndef FREESURROUND_DECODER_H
 #define FREESURROUND_DECODER_H
 
+#include "libmythtv/mythtvexp.h"
+
 // the Free Surround decoder
-class fsurround_decoder {
+class MTV_PUBLIC fsurround_decoder {
 public:
     // create an instance of the decoder
     //  blocksize is fixed over the lifetime of this object for performance reasons
@@ -59,6 +61,11 @@ public:
     //  true  = advanced linear steering (new)
     void steering_mode(bool mode);
 
+    // use the fast decode
+    //  false = exact per bin decode (default)
+    //  true  = SIMD per bin decode with table/polynomial approximations of the steering math
+    void fast_mode(bool fast);
+
     // set front/rear stereo separation
     //  1.0 is default, 0.0 is mono
     void separation(float front,float rear);
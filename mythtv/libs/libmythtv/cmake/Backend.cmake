@@ -102,6 +102,7 @@ target_sources(
           recorders/rtp/rtpdatapacket.h
           recorders/rtp/rtpfecpacket.h
           recorders/rtp/rtcpdatapacket.h
+          recorders/rtp/udpreceiver.h
           recorders/cetonrtsp.cpp
           recorders/iptvchannel.cpp
           recorders/iptvrecorder.cpp
@@ -111,6 +112,7 @@ target_sources(
           recorders/rtp/packetbuffer.cpp
           recorders/rtp/rtpdatapacket.cpp
           recorders/rtp/rtppacketbuffer.cpp
+          recorders/rtp/udpreceiver.cpp
           # Support for HTTP TS streams
           recorders/httptsstreamhandler.h
           recorders/httptsstreamhandler.cpp
@@ -120,11 +122,13 @@ target_sources(
           recorders/HLS/HLSPlaylistWorker.h
           recorders/HLS/HLSReader.h
           recorders/HLS/HLSSegment.h
+          recorders/HLS/HLSSegmentPrefetch.h
           recorders/HLS/HLSStream.h
           recorders/HLS/HLSStreamWorker.h
           recorders/HLS/HLSPlaylistWorker.cpp
           recorders/HLS/HLSReader.cpp
           recorders/HLS/HLSSegment.cpp
+          recorders/HLS/HLSSegmentPrefetch.cpp
           recorders/HLS/HLSStream.cpp
           recorders/HLS/HLSStreamWorker.cpp
           recorders/HLS/m3u.cpp
@@ -117,6 +117,7 @@ target_sources(
           mythvideooutgpu.h
           mythvideogpu.h
           videobuffers.h
+          mythvideoframepool.h
           jitterometer.h
           mythvideoprofile.h
           mythcodecid.h
@@ -134,6 +135,7 @@ target_sources(
           mythvideooutgpu.cpp
           mythvideogpu.cpp
           videobuffers.cpp
+          mythvideoframepool.cpp
           jitterometer.cpp
           mythvideoprofile.cpp
           mythcodecid.cpp
@@ -0,0 +1,366 @@
+// C++
+#include <algorithm>
+#include <limits>
+
+// Qt
+#include <QtGlobal>
+#if QT_VERSION >= QT_VERSION_CHECK(6,5,0)
+#include <QTimeZone>
+#endif
+
+// MythTV
+#include "libmythbase/mythdate.h"
+#include "libmythbase/mythsorthelper.h"
+
+#include "compactprogramlist.h"
+
+static constexpr int64_t  kInvalidTime     { std::numeric_limits<int64_t>::min() };
+static constexpr int32_t  kInvalidDate     { std::numeric_limits<int32_t>::min() };
+static constexpr uint32_t kNoSortForm      { std::numeric_limits<uint32_t>::max() };
+
+static int64_t ToColumn(const QDateTime &Time)
+{
+    return Time.isValid() ? Time.toMSecsSinceEpoch() : kInvalidTime;
+}
+
+static int32_t ToColumn(QDate Date)
+{
+    return Date.isValid() ? static_cast<int32_t>(Date.toJulianDay()) : kInvalidDate;
+}
+
+uint32_t CompactProgramList::Intern(const QString &Value)
+{
+    if (Value.isEmpty())
+        return 0;
+
+    auto it = m_stringIds.constFind(Value);
+    if (it != m_stringIds.constEnd())
+        return *it;
+
+    auto id = static_cast<uint32_t>(m_strings.size());
+    m_strings.push_back(Value);
+    m_stringIds.insert(Value, id);
+    return id;
+}
+
+QDateTime CompactProgramList::Time(TimeColumn Column, size_t Index) const
+{
+    int64_t msecs = m_times[Column][Index];
+    if (msecs == kInvalidTime)
+        return {};
+#if QT_VERSION < QT_VERSION_CHECK(6,5,0)
+    return QDateTime::fromMSecsSinceEpoch(msecs, Qt::UTC);
+#else
+    return QDateTime::fromMSecsSinceEpoch(msecs, QTimeZone(QTimeZone::UTC));
+#endif
+}
+
+void CompactProgramList::Append(const ProgramInfo &Program)
+{
+    auto & strings = m_stringColumns;
+    strings[kTitle].push_back(Intern(Program.m_title));
+    strings[kSortTitle].push_back(Intern(Program.m_sortTitle));
+    strings[kSubtitle].push_back(Intern(Program.m_subtitle));
+    strings[kSortSubtitle].push_back(Intern(Program.m_sortSubtitle));
+    strings[kDescription].push_back(Intern(Program.m_description));
+    strings[kSyndicatedEpisode].push_back(Intern(Program.m_syndicatedEpisode));
+    strings[kCategory].push_back(Intern(Program.m_category));
+    strings[kDirector].push_back(Intern(Program.m_director));
+    strings[kChanStr].push_back(Intern(Program.m_chanStr));
+    strings[kChanSign].push_back(Intern(Program.m_chanSign));
+    strings[kChanName].push_back(Intern(Program.m_chanName));
+    strings[kChanPlaybackFilters].push_back(Intern(Program.m_chanPlaybackFilters));
+    strings[kRecGroup].push_back(Intern(Program.m_recGroup));
+    strings[kPlayGroup].push_back(Intern(Program.m_playGroup));
+    strings[kHostname].push_back(Intern(Program.m_hostname));
+    strings[kStorageGroup].push_back(Intern(Program.m_storageGroup));
+    strings[kSeriesId].push_back(Intern(Program.m_seriesId));
+    strings[kProgramId].push_back(Intern(Program.m_programId));
+    strings[kInetRef].push_back(Intern(Program.m_inetRef));
+    strings[kInputName].push_back(Intern(Program.m_inputName));
+
+    m_times[kStartTs].push_back(ToColumn(Program.m_startTs));
+    m_times[kEndTs].push_back(ToColumn(Program.m_endTs));
+    m_times[kRecStartTs].push_back(ToColumn(Program.m_recStartTs));
+    m_times[kRecEndTs].push_back(ToColumn(Program.m_recEndTs));
+    m_times[kLastModified].push_back(ToColumn(Program.m_lastModified));
+    m_times[kBookmarkUpdate].push_back(ToColumn(Program.m_bookmarkUpdate));
+
+    m_numbers[kSeason].push_back(Program.m_season);
+    m_numbers[kEpisode].push_back(Program.m_episode);
+    m_numbers[kTotalEpisodes].push_back(Program.m_totalEpisodes);
+    m_numbers[kRecPriority].push_back(static_cast<uint32_t>(Program.m_recPriority));
+    m_numbers[kChanId].push_back(Program.m_chanId);
+    m_numbers[kRecPriority2].push_back(static_cast<uint32_t>(Program.m_recPriority2));
+    m_numbers[kRecordId].push_back(Program.m_recordId);
+    m_numbers[kParentId].push_back(Program.m_parentId);
+    m_numbers[kSourceId].push_back(Program.m_sourceId);
+    m_numbers[kInputId].push_back(Program.m_inputId);
+    m_numbers[kFindId].push_back(Program.m_findId);
+    m_numbers[kProgramFlags].push_back(Program.m_programFlags);
+    m_numbers[kRecordedId].push_back(Program.m_recordedId);
+
+    m_shorts[kYear].push_back(Program.m_year);
+    m_shorts[kPartNumber].push_back(Program.m_partNumber);
+    m_shorts[kPartTotal].push_back(Program.m_partTotal);
+    m_shorts[kVideoProperties].push_back(Program.m_videoProperties);
+
+    m_bytes[kCatType].push_back(Program.m_catType);
+    m_bytes[kAudioProperties].push_back(Program.m_audioProperties);
+    m_bytes[kSubtitleProperties].push_back(Program.m_subtitleProperties);
+    m_bytes[kRecStatus].push_back(static_cast<uint8_t>(Program.m_recStatus));
+    m_bytes[kRecType].push_back(Program.m_recType);
+    m_bytes[kDupIn].push_back(Program.m_dupIn);
+    m_bytes[kDupMethod].push_back(Program.m_dupMethod);
+    m_bytes[kAvailableStatus].push_back(Program.m_availableStatus);
+
+    m_pathnames.push_back(Program.m_pathname);
+    m_fileSizes.push_back(Program.m_fileSize);
+    m_stars.push_back(Program.m_stars);
+    m_airDates.push_back(ToColumn(Program.m_originalAirDate));
+
+    m_size++;
+}
+
+/*! \brief Append a row selected as LoadFromProgram() selects listings.
+ *
+ * The columns are filled straight from the query, the same as a
+ * ProgramInfo built from the row would fill them, but without building
+ * one. Listings that the scheduler has information for still need that
+ * ProgramInfo, so use Append() for those.
+ */
+void CompactProgramList::AppendListing(const MSqlQuery &Query)
+{
+    // Start from the ProgramInfo defaults for what the query does not have
+    static const ProgramInfo kDefaults;
+    Append(kDefaults);
+
+    auto setString = [&](StringColumn Column, uint32_t Id)
+        { m_stringColumns[Column].back() = Id; };
+    uint32_t title    = Intern(Query.value(3).toString());
+    uint32_t subtitle = Intern(Query.value(4).toString());
+    setString(kTitle, title);
+    setString(kSortTitle, SortForm(title));
+    setString(kSubtitle, subtitle);
+    setString(kSortSubtitle, SortForm(subtitle));
+    setString(kDescription, Intern(Query.value(5).toString()));
+    setString(kSyndicatedEpisode, Intern(Query.value(26).toString()));
+    setString(kCategory, Intern(Query.value(6).toString()));
+    setString(kChanStr, Intern(Query.value(7).toString()));
+    setString(kChanSign, Intern(Query.value(8).toString()));
+    setString(kChanName, Intern(Query.value(9).toString()));
+    setString(kChanPlaybackFilters, Intern(Query.value(12).toString()));
+    setString(kSeriesId, Intern(Query.value(13).toString()));
+    setString(kProgramId, Intern(Query.value(14).toString()));
+
+    int64_t start = ToColumn(MythDate::as_utc(Query.value(1).toDateTime()));
+    int64_t end   = ToColumn(MythDate::as_utc(Query.value(2).toDateTime()));
+    m_times[kStartTs].back()      = start;
+    m_times[kEndTs].back()        = end;
+    m_times[kRecStartTs].back()   = start;
+    m_times[kRecEndTs].back()     = end;
+    m_times[kLastModified].back() = start;
+
+    uint32_t flags = FL_NONE;
+    if (Query.value(11).toInt() == COMM_DETECT_COMMFREE)
+        flags |= FL_CHANCOMMFREE;
+    if (Query.value(10).toBool())
+        flags |= FL_REPEAT;
+    m_numbers[kChanId].back()        = Query.value(0).toUInt();
+    m_numbers[kRecordId].back()      = Query.value(19).toUInt();
+    m_numbers[kFindId].back()        = Query.value(22).toUInt();
+    m_numbers[kProgramFlags].back()  = flags;
+    m_numbers[kSeason].back()        = Query.value(29).toUInt();
+    m_numbers[kEpisode].back()       = Query.value(30).toUInt();
+    m_numbers[kTotalEpisodes].back() = Query.value(31).toUInt();
+
+    m_shorts[kYear].back()            = Query.value(15).toUInt();
+    m_shorts[kPartNumber].back()      = Query.value(27).toUInt();
+    m_shorts[kPartTotal].back()       = Query.value(28).toUInt();
+    m_shorts[kVideoProperties].back() = Query.value(23).toUInt();
+
+    m_bytes[kCatType].back() = string_to_myth_category_type(Query.value(18).toString());
+    m_bytes[kAudioProperties].back()    = Query.value(24).toUInt();
+    m_bytes[kSubtitleProperties].back() = Query.value(25).toUInt();
+    m_bytes[kRecStatus].back() = static_cast<uint8_t>(Query.value(21).toInt());
+    m_bytes[kRecType].back()   = Query.value(20).toUInt();
+
+    m_stars.back() = std::clamp(Query.value(16).toFloat(), 0.0F, 1.0F);
+    QDate airDate = Query.value(17).toDate();
+    if (airDate.isValid() && airDate < QDate(1895, 12, 28))
+        airDate = QDate();
+    m_airDates.back() = ToColumn(airDate);
+}
+
+void CompactProgramList::Append(const ProgramList &Programs)
+{
+    reserve(m_size + Programs.size());
+    for (const auto *program : Programs)
+        Append(*program);
+}
+
+void CompactProgramList::reserve(size_t Size)
+{
+    for (auto & column : m_stringColumns)
+        column.reserve(Size);
+    for (auto & column : m_times)
+        column.reserve(Size);
+    for (auto & column : m_numbers)
+        column.reserve(Size);
+    for (auto & column : m_shorts)
+        column.reserve(Size);
+    for (auto & column : m_bytes)
+        column.reserve(Size);
+    m_pathnames.reserve(Size);
+    m_fileSizes.reserve(Size);
+    m_stars.reserve(Size);
+    m_airDates.reserve(Size);
+}
+
+void CompactProgramList::clear(void)
+{
+    *this = CompactProgramList();
+}
+
+/// \brief Fill in Program from the entry at Index.
+void CompactProgramList::Materialize(size_t Index, ProgramInfo &Program) const
+{
+    Program.clear();
+
+    Program.m_title               = String(kTitle, Index);
+    Program.m_sortTitle           = String(kSortTitle, Index);
+    Program.m_subtitle            = String(kSubtitle, Index);
+    Program.m_sortSubtitle        = String(kSortSubtitle, Index);
+    Program.m_description         = String(kDescription, Index);
+    Program.m_syndicatedEpisode   = String(kSyndicatedEpisode, Index);
+    Program.m_category            = String(kCategory, Index);
+    Program.m_director            = String(kDirector, Index);
+    Program.m_chanStr             = String(kChanStr, Index);
+    Program.m_chanSign            = String(kChanSign, Index);
+    Program.m_chanName            = String(kChanName, Index);
+    Program.m_chanPlaybackFilters = String(kChanPlaybackFilters, Index);
+    Program.m_recGroup            = String(kRecGroup, Index);
+    Program.m_playGroup           = String(kPlayGroup, Index);
+    Program.m_hostname            = String(kHostname, Index);
+    Program.m_storageGroup        = String(kStorageGroup, Index);
+    Program.m_seriesId            = String(kSeriesId, Index);
+    Program.m_programId           = String(kProgramId, Index);
+    Program.m_inetRef             = String(kInetRef, Index);
+    Program.m_inputName           = String(kInputName, Index);
+
+    Program.m_startTs        = Time(kStartTs, Index);
+    Program.m_endTs          = Time(kEndTs, Index);
+    Program.m_recStartTs     = Time(kRecStartTs, Index);
+    Program.m_recEndTs       = Time(kRecEndTs, Index);
+    Program.m_lastModified   = Time(kLastModified, Index);
+    Program.m_bookmarkUpdate = Time(kBookmarkUpdate, Index);
+
+    Program.m_season        = m_numbers[kSeason][Index];
+    Program.m_episode       = m_numbers[kEpisode][Index];
+    Program.m_totalEpisodes = m_numbers[kTotalEpisodes][Index];
+    Program.m_recPriority   = static_cast<int32_t>(m_numbers[kRecPriority][Index]);
+    Program.m_chanId        = m_numbers[kChanId][Index];
+    Program.m_recPriority2  = static_cast<int32_t>(m_numbers[kRecPriority2][Index]);
+    Program.m_recordId      = m_numbers[kRecordId][Index];
+    Program.m_parentId      = m_numbers[kParentId][Index];
+    Program.m_sourceId      = m_numbers[kSourceId][Index];
+    Program.m_inputId       = m_numbers[kInputId][Index];
+    Program.m_findId        = m_numbers[kFindId][Index];
+    Program.m_programFlags  = m_numbers[kProgramFlags][Index];
+    Program.m_recordedId    = m_numbers[kRecordedId][Index];
+
+    Program.m_year            = m_shorts[kYear][Index];
+    Program.m_partNumber      = m_shorts[kPartNumber][Index];
+    Program.m_partTotal       = m_shorts[kPartTotal][Index];
+    Program.m_videoProperties = m_shorts[kVideoProperties][Index];
+
+    Program.m_catType            = static_cast<ProgramInfo::CategoryType>(m_bytes[kCatType][Index]);
+    Program.m_audioProperties    = m_bytes[kAudioProperties][Index];
+    Program.m_subtitleProperties = m_bytes[kSubtitleProperties][Index];
+    Program.m_recStatus          = static_cast<int8_t>(m_bytes[kRecStatus][Index]);
+    Program.m_recType            = m_bytes[kRecType][Index];
+    Program.m_dupIn              = m_bytes[kDupIn][Index];
+    Program.m_dupMethod          = m_bytes[kDupMethod][Index];
+    Program.m_availableStatus    = m_bytes[kAvailableStatus][Index];
+
+    Program.m_pathname = m_pathnames[Index];
+    Program.m_fileSize = m_fileSizes[Index];
+    Program.m_stars    = m_stars[Index];
+    int32_t airDate    = m_airDates[Index];
+    Program.m_originalAirDate = (airDate == kInvalidDate) ? QDate() : QDate::fromJulianDay(airDate);
+
+    Program.ensureSortFields();
+}
+
+ProgramInfo CompactProgramList::At(size_t Index) const
+{
+    ProgramInfo program;
+    Materialize(Index, program);
+    return program;
+}
+
+void CompactProgramList::ToProgramList(ProgramList &Programs) const
+{
+    for (size_t i = 0; i < m_size; ++i)
+    {
+        auto *program = new ProgramInfo;
+        Materialize(i, *program);
+        Programs.push_back(program);
+    }
+}
+
+/*! \brief Return the sort form of Title, as ProgramInfo::ensureSortFields()
+ *         would make it.
+ *
+ * Each distinct title is only converted once. Pass the result to the
+ * ProgramInfo constructor when loading many programs, the titles repeat.
+ */
+QString CompactProgramList::SortTitle(const QString &Title)
+{
+    return m_strings[SortForm(Intern(Title))];
+}
+
+/// \brief Return the index of the sort form of the string at Id.
+uint32_t CompactProgramList::SortForm(uint32_t Id)
+{
+    if (Id == 0)
+        return 0;
+
+    if (m_sortForms.size() <= Id)
+        m_sortForms.resize(m_strings.size(), kNoSortForm);
+    if (m_sortForms[Id] == kNoSortForm)
+    {
+        // Copied, Intern() may move the strings
+        QString title = m_strings[Id];
+        uint32_t sortForm = Intern(getMythSortHelper()->doTitle(title));
+        m_sortForms[Id] = sortForm;
+    }
+    return m_sortForms[Id];
+}
+
+/// \brief Approximate number of bytes used, including the strings.
+size_t CompactProgramList::MemoryUsage(void) const
+{
+    size_t bytes = sizeof(*this);
+    for (const auto & string : m_strings)
+        bytes += sizeof(QString) + (static_cast<size_t>(string.capacity()) * sizeof(QChar));
+    // Entries, buckets and the key of the hash
+    bytes += static_cast<size_t>(m_stringIds.capacity()) * (sizeof(QString) + sizeof(uint32_t) + 8);
+    bytes += m_sortForms.capacity() * sizeof(uint32_t);
+    for (const auto & column : m_stringColumns)
+        bytes += column.capacity() * sizeof(uint32_t);
+    for (const auto & column : m_times)
+        bytes += column.capacity() * sizeof(int64_t);
+    for (const auto & column : m_numbers)
+        bytes += column.capacity() * sizeof(uint32_t);
+    for (const auto & column : m_shorts)
+        bytes += column.capacity() * sizeof(uint16_t);
+    for (const auto & column : m_bytes)
+        bytes += column.capacity() * sizeof(uint8_t);
+    for (const auto & pathname : m_pathnames)
+        bytes += sizeof(QString) + (static_cast<size_t>(pathname.capacity()) * sizeof(QChar));
+    bytes += m_fileSizes.capacity() * sizeof(uint64_t);
+    bytes += m_stars.capacity() * sizeof(float);
+    bytes += m_airDates.capacity() * sizeof(int32_t);
+    return bytes;
+}
@@ -0,0 +1,137 @@
+#ifndef COMPACTPROGRAMLIST_H
+#define COMPACTPROGRAMLIST_H
+
+// C++
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Qt
+#include <QDateTime>
+#include <QHash>
+#include <QString>
+
+// MythTV
+#include "libmythbase/mythdbcon.h"
+
+#include "mythtvexp.h"
+#include "programinfo.h"
+#include "recordingstatus.h"
+
+/** \class CompactProgramList
+ *  \brief A list of programs, stored by column rather than as ProgramInfos.
+ *
+ *  A ProgramInfo takes around a kilobyte before any of its strings, and a
+ *  list loaded from the database holds a separate copy of every channel
+ *  name, category, host name and storage group. This list instead keeps
+ *  each distinct string once and stores the index of that string. Times
+ *  are kept as milliseconds since the epoch and dates as Julian days.
+ *
+ *  A ProgramInfo is only built when it is asked for, with Materialize() or
+ *  At(). The Get methods read one field without building one, which is
+ *  enough for sorting or filtering.
+ *
+ *  Only the ProgramInfo members are kept, not those of a subclass such as
+ *  RecordingInfo. Like a copy, the time the program was last in use is not
+ *  kept, and neither is the layout state of the program guide.
+ */
+class MTV_PUBLIC CompactProgramList
+{
+  public:
+    void   Append(const ProgramInfo &Program);
+    void   Append(const ProgramList &Programs);
+    void   AppendListing(const MSqlQuery &Query);
+    void   reserve(size_t Size);
+    void   clear(void);
+    size_t size(void) const  { return m_size; }
+    bool   empty(void) const { return m_size == 0; }
+
+    void        Materialize(size_t Index, ProgramInfo &Program) const;
+    ProgramInfo At(size_t Index) const;
+    void        ToProgramList(ProgramList &Programs) const;
+
+    QString GetTitle(size_t Index) const          { return String(kTitle, Index); }
+    QString GetSubtitle(size_t Index) const       { return String(kSubtitle, Index); }
+    QString GetCategory(size_t Index) const       { return String(kCategory, Index); }
+    QString GetChanNum(size_t Index) const        { return String(kChanStr, Index); }
+    QString GetChannelName(size_t Index) const    { return String(kChanName, Index); }
+    QString GetHostname(size_t Index) const       { return String(kHostname, Index); }
+    QString GetStorageGroup(size_t Index) const   { return String(kStorageGroup, Index); }
+    QString GetRecordingGroup(size_t Index) const { return String(kRecGroup, Index); }
+    QString GetProgramID(size_t Index) const      { return String(kProgramId, Index); }
+    uint    GetChanID(size_t Index) const         { return m_numbers[kChanId][Index]; }
+    uint    GetRecordingID(size_t Index) const    { return m_numbers[kRecordedId][Index]; }
+    RecStatus::Type GetRecordingStatus(size_t Index) const
+        { return static_cast<RecStatus::Type>(static_cast<int8_t>(m_bytes[kRecStatus][Index])); }
+    QDateTime GetScheduledStartTime(size_t Index) const { return Time(kStartTs, Index); }
+    QDateTime GetScheduledEndTime(size_t Index) const   { return Time(kEndTs, Index); }
+    QDateTime GetRecordingStartTime(size_t Index) const { return Time(kRecStartTs, Index); }
+
+    QString SortTitle(const QString &Title);
+
+    size_t StringCount(void) const { return m_strings.size(); }
+    size_t MemoryUsage(void) const;
+
+  private:
+    enum StringColumn : std::uint8_t
+    {
+        kTitle, kSortTitle, kSubtitle, kSortSubtitle, kDescription,
+        kSyndicatedEpisode, kCategory, kDirector, kChanStr, kChanSign,
+        kChanName, kChanPlaybackFilters, kRecGroup, kPlayGroup, kHostname,
+        kStorageGroup, kSeriesId, kProgramId, kInetRef, kInputName,
+        kStringColumns
+    };
+    enum TimeColumn : std::uint8_t
+    {
+        kStartTs, kEndTs, kRecStartTs, kRecEndTs, kLastModified,
+        kBookmarkUpdate, kTimeColumns
+    };
+    enum NumberColumn : std::uint8_t
+    {
+        kSeason, kEpisode, kTotalEpisodes, kRecPriority, kChanId,
+        kRecPriority2, kRecordId, kParentId, kSourceId, kInputId, kFindId,
+        kProgramFlags, kRecordedId, kNumberColumns
+    };
+    enum ShortColumn : std::uint8_t
+    {
+        kYear, kPartNumber, kPartTotal, kVideoProperties, kShortColumns
+    };
+    enum ByteColumn : std::uint8_t
+    {
+        kCatType, kAudioProperties, kSubtitleProperties, kRecStatus, kRecType,
+        kDupIn, kDupMethod, kAvailableStatus, kByteColumns
+    };
+
+    uint32_t Intern(const QString &Value);
+    uint32_t SortForm(uint32_t Id);
+    const QString &String(StringColumn Column, size_t Index) const
+        { return m_strings[m_stringColumns[Column][Index]]; }
+    QDateTime Time(TimeColumn Column, size_t Index) const;
+
+    size_t m_size {0};
+
+    // Index 0 is the empty string
+    std::vector<QString>     m_strings { QString() };
+    QHash<QString, uint32_t> m_stringIds;
+    // The index of the sort form of each string, filled in by SortTitle()
+    std::vector<uint32_t>    m_sortForms;
+
+    std::array<std::vector<uint32_t>, kStringColumns> m_stringColumns;
+    std::array<std::vector<int64_t>,  kTimeColumns>   m_times;
+    std::array<std::vector<uint32_t>, kNumberColumns> m_numbers;
+    std::array<std::vector<uint16_t>, kShortColumns>  m_shorts;
+    std::array<std::vector<uint8_t>,  kByteColumns>   m_bytes;
+    std::vector<QString>  m_pathnames; // rarely shared
+    std::vector<uint64_t> m_fileSizes;
+    std::vector<float>    m_stars;
+    std::vector<int32_t>  m_airDates;
+};
+
+MTV_PUBLIC bool LoadFromProgram(
+    CompactProgramList &destination,
+    const QString      &sql,
+    const MSqlBindings &bindings,
+    const ProgramList  &schedList,
+    ProgGroupBy::Type   groupBy = ProgGroupBy::None);
+
+#endif // COMPACTPROGRAMLIST_H
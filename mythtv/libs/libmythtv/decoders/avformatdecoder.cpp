@@ -690,6 +690,9 @@ void AvFormatDecoder::SeekReset(long long newKey, uint skipFrames,
 
     QMutexLocker locker(&m_avCodecLock);
 
+    if (m_trickPlay != m_trickPlayActive)
+        UpdateTrickPlay(false);
+
     // Discard all the queued up decoded frames
     if (discardFrames)
     {
@@ -1892,10 +1895,56 @@ void AvFormatDecoder::ScanDSMCCStreams(AVBufferRef* pmt_section)
     }
 }
 
+/** \brief Apply or remove keyframe-only decoding on the video codec.
+ *
+ *  Called on the decoder thread, from SeekReset when the speed change
+ *  comes with a seek and from GetFrame when it doesn't (pausing and
+ *  resuming after fast forward, for example). Non-key frames are
+ *  discarded before decoding and the loop filter is skipped on the key
+ *  frames that remain. m_avCodecLock must be held.
+ *
+ *  \param flush Flush the video codec when leaving trick play, as the
+ *  frames the next non-key frames refer to were never decoded. SeekReset
+ *  flushes the codec itself.
+ *
+ *  \note lowres decoding would need the codec and the video buffers to
+ *  be reopened at the smaller size, which is too slow to toggle on a
+ *  speed change, so it is not used here.
+ */
+void AvFormatDecoder::UpdateTrickPlay(bool flush)
+{
+    m_trickPlayActive = m_trickPlay;
+
+    int index = m_selectedTrack[kTrackTypeVideo].m_av_stream_index;
+    if (!m_ic || index < 0 || index >= static_cast<int>(m_ic->nb_streams))
+        return;
+    AVCodecContext *ctx = m_codecMap.FindCodecContext(m_ic->streams[index]);
+    if (!ctx)
+        return;
+
+    if (m_trickPlayActive)
+    {
+        m_trickPlaySkipLoopFilter = ctx->skip_loop_filter;
+        ctx->skip_frame       = AVDISCARD_NONKEY;
+        ctx->skip_loop_filter = AVDISCARD_ALL;
+    }
+    else
+    {
+        ctx->skip_frame       = AVDISCARD_DEFAULT;
+        ctx->skip_loop_filter = m_trickPlaySkipLoopFilter;
+        if (flush && avcodec_is_open(ctx))
+            avcodec_flush_buffers(ctx);
+    }
+
+    LOG(VB_PLAYBACK, LOG_INFO, LOC + QString("Keyframe-only trick play %1")
+        .arg(m_trickPlayActive ? "enabled" : "disabled"));
+}
+
 int AvFormatDecoder::autoSelectVideoTrack(int& scanerror)
 {
     m_tracks[kTrackTypeVideo].clear();
     m_selectedTrack[kTrackTypeVideo].m_av_stream_index = -1;
+    m_trickPlayActive = false;
     m_currentTrack[kTrackTypeVideo] = -1;
     m_fps = 0;
 
@@ -4607,6 +4656,13 @@ bool AvFormatDecoder::GetFrame(DecodeType decodetype, bool &Retry)
         m_skipAudio = false;
     }
 
+    // Speed changes without a seek never reach SeekReset
+    if (m_trickPlay != m_trickPlayActive)
+    {
+        QMutexLocker locker(&m_avCodecLock);
+        UpdateTrickPlay(true);
+    }
+
     m_allowedQuit = m_audio->IsBufferAlmostFull();
 
     while (!m_allowedQuit)
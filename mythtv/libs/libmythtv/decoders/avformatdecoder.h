@@ -160,6 +160,7 @@ class AvFormatDecoder : public DecoderBase
     void ScanTeletextCaptions(int av_index);
     void ScanRawTextCaptions(int av_stream_index);
     void ScanDSMCCStreams(AVBufferRef* pmt_section);
+    void UpdateTrickPlay(bool flush);
     int  AutoSelectAudioTrack(void);
     int  filter_max_ch(const AVFormatContext *ic,
                        const sinfo_vec_t     &tracks,
@@ -244,6 +245,9 @@ class AvFormatDecoder : public DecoderBase
 
     struct SwsContext *m_swsCtx                       {nullptr};
     bool               m_directRendering              {false};
+    /// Trick play state currently applied to the video codec context
+    bool               m_trickPlayActive              {false};
+    AVDiscard          m_trickPlaySkipLoopFilter      {AVDISCARD_DEFAULT};
 
     bool               m_gopSet                       {false};
     /// A flag to indicate that we've seen a GOP frame.  Used in junction with seq_count.
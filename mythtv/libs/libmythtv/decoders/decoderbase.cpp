@@ -571,7 +571,9 @@ bool DecoderBase::DoRewind(long long desiredFrame, bool discardFrames)
 
     // Do any Extra frame-by-frame seeking for exactseeks mode
     // And flush pre-seek frame if we are allowed to and need to..
-    int normalframes = (uint64_t)(desiredFrame - (m_framesPlayed - 1)) > m_seekSnap
+    // In trick play the keyframe is shown as is, never decode through the GOP.
+    int normalframes = !m_trickPlay &&
+        (uint64_t)(desiredFrame - (m_framesPlayed - 1)) > m_seekSnap
         ? desiredFrame - m_framesPlayed : 0;
     normalframes = std::max(normalframes, 0);
     SeekReset(m_lastKey, normalframes, true, discardFrames);
@@ -794,7 +796,9 @@ bool DecoderBase::DoFastForward(long long desiredFrame, bool discardFrames)
 
     // Do any Extra frame-by-frame seeking for exactseeks mode
     // And flush pre-seek frame if we are allowed to and need to..
-    int normalframes = (uint64_t)(desiredFrame - (m_framesPlayed - 1)) > m_seekSnap
+    // In trick play the keyframe is shown as is, never decode through the GOP.
+    int normalframes = !m_trickPlay &&
+        (uint64_t)(desiredFrame - (m_framesPlayed - 1)) > m_seekSnap
         ? desiredFrame - m_framesPlayed : 0;
     normalframes = std::max(normalframes, 0);
     SeekReset(m_lastKey, normalframes, needflush, discardFrames);
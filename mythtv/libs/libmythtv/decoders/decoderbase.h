@@ -2,6 +2,7 @@
 #define DECODERBASE_H_
 
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <vector>
 
@@ -158,6 +159,10 @@ class DecoderBase
     virtual bool DoRewind(long long desiredFrame, bool discardFrames = true);
     virtual bool DoFastForward(long long desiredFrame, bool discardFrames = true);
     virtual void SetIdrOnlyKeyframes(bool /*value*/) { }
+    /// Keyframe-only fast forward/rewind. Seeks snap to the nearest
+    /// keyframe and subclasses may stop decoding non-key frames.
+    void SetTrickPlay(bool enable)   { m_trickPlay = enable; }
+    bool GetTrickPlay(void) const    { return m_trickPlay;   }
 
     static uint64_t
         TranslatePositionAbsToRel(const frm_dir_map_t &deleteMap,
@@ -319,6 +324,8 @@ class DecoderBase
     mutable QDateTime    m_lastPositionMapUpdate; // guarded by m_positionMapLock
 
     uint64_t             m_seekSnap                {UINT64_MAX};
+    /// Set by the player thread, read by the decoder thread
+    std::atomic<bool>    m_trickPlay               {false};
     bool                 m_dontSyncPositionMap     {false};
     bool                 m_livetv                  {false};
     bool                 m_watchingRecording       {false};
@@ -1,4 +1,5 @@
 
+#include <algorithm>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -37,6 +38,7 @@ static constexpr int PTHREAD_NULL { 0 };
 #include "libmythbase/mythsystemlegacy.h"
 
 #include "jobqueue.h"
+#include "jobresourcemonitor.h"
 #include "previewgenerator.h"
 #include "programinfo.h"
 #include "recordinginfo.h"
@@ -46,12 +48,15 @@ static constexpr int PTHREAD_NULL { 0 };
 
 // Consider anything less than 4 hours as a "recent" job.
 static constexpr int64_t kRecentInterval {4LL * 60 * 60};
+// How soon to look again at jobs held back because the host is busy.
+static constexpr std::chrono::seconds kResourceRetry {15s};
 
 JobQueue::JobQueue(bool master) :
     m_hostname(gCoreContext->GetHostName()),
     m_runningJobsLock(new QRecursiveMutex()),
     m_isMaster(master),
-    m_queueThread(new MThread("JobQueue", this))
+    m_queueThread(new MThread("JobQueue", this)),
+    m_resources(new JobResourceMonitor(m_hostname))
 {
     m_jobQueueCPU = gCoreContext->GetNumSetting("JobQueueCPU", 0);
 
@@ -82,6 +87,7 @@ JobQueue::~JobQueue(void)
 
     gCoreContext->removeListener(this);
 
+    delete m_resources;
     delete m_runningJobsLock;
 }
 
@@ -150,9 +156,24 @@ void JobQueue::customEvent(QEvent *e)
                 m_runningJobsLock->unlock();
             }
         }
+        else if (message.startsWith("JOB_QUEUED") ||
+                 message.startsWith("SYSTEM_EVENT REC_FINISHED"))
+        {
+            // Something new to run, or a recorder has stopped competing
+            // with the jobs for the disks and CPU
+            WakeQueue();
+        }
     }
 }
 
+/// Make the queue thread look at the queue again now
+void JobQueue::WakeQueue(void)
+{
+    QMutexLocker locker(&m_queueThreadCondLock);
+    m_queueWake = true;
+    m_queueThreadCond.wakeAll();
+}
+
 void JobQueue::run(void)
 {
     m_queueThreadCondLock.lock();
@@ -188,8 +209,12 @@ void JobQueue::ProcessQueue(void)
         locker.unlock();
 
         bool startedJobAlready = false;
-        auto sleepTime = gCoreContext->GetDurSetting<std::chrono::seconds>("JobQueueCheckFrequency", 30s);
-        int maxJobs = gCoreContext->GetNumSetting("JobQueueMaxSimultaneousJobs", 3);
+        bool heldForResources = false;
+        bool checkedResources = false;
+        QString resourceReason;
+        QDateTime nextScheduled;
+        auto sleepTime = std::chrono::seconds(m_checkFrequency.Get());
+        int maxJobs = m_maxJobs.Get();
         LOG(VB_JOBQUEUE, LOG_INFO, LOC +
             QString("Currently set to run up to %1 job(s) max.")
                         .arg(maxJobs));
@@ -317,6 +342,9 @@ void JobQueue::ProcessQueue(void)
                 // Is this job scheduled for the future
                 if (jobs[x].schedruntime > MythDate::current())
                 {
+                    if (!nextScheduled.isValid() ||
+                        jobs[x].schedruntime < nextScheduled)
+                        nextScheduled = jobs[x].schedruntime;
                     message = QString("Skipping '%1' job for %2, this job is "
                                       "not scheduled to run until %3.")
                                       .arg(JobText(jobs[x].type), logInfo,
@@ -430,6 +458,26 @@ void JobQueue::ProcessQueue(void)
                 if (startedJobAlready)
                     continue;
 
+                // Is there room on this host for another job? Metadata
+                // lookups cost next to nothing locally, so always run.
+                if (inTimeWindow && (jobs[x].type != JOB_METADATA))
+                {
+                    if (!checkedResources)
+                    {
+                        heldForResources =
+                            !m_resources->CanStartJob(resourceReason);
+                        checkedResources = true;
+                    }
+                    if (heldForResources)
+                    {
+                        message = QString("Holding '%1' job for %2, %3")
+                                          .arg(JobText(jobs[x].type), logInfo,
+                                               resourceReason);
+                        LOG(VB_JOBQUEUE, LOG_INFO, LOC + message);
+                        continue;
+                    }
+                }
+
                 if (inTimeWindow &&
                     (hostname.isEmpty()) &&
                     (!ChangeJobHost(jobID, m_hostname)))
@@ -486,12 +534,23 @@ void JobQueue::ProcessQueue(void)
 
 
         locker.relock();
-        if (m_processQueue)
+        if (m_processQueue && !m_queueWake)
         {
             std::chrono::milliseconds st = startedJobAlready ? 5s : sleepTime;
+            if (heldForResources)
+                st = std::min<std::chrono::milliseconds>(st, kResourceRetry);
+            if (nextScheduled.isValid())
+            {
+                auto untilNext = std::chrono::milliseconds(
+                    MythDate::current().msecsTo(nextScheduled));
+                // A check frequency below 1s would make an invalid range
+                std::chrono::milliseconds hi = std::max<std::chrono::milliseconds>(st, 1s);
+                st = std::clamp<std::chrono::milliseconds>(untilNext, 1s, hi);
+            }
             if (st > 0ms)
                 m_queueThreadCond.wait(locker.mutex(), st.count());
         }
+        m_queueWake = false;
     }
 }
 
@@ -598,6 +657,11 @@ bool JobQueue::QueueJob(int jobType, uint chanid, const QDateTime &recstartts,
         return false;
     }
 
+    // Let the job queues know there is work, rather than waiting for
+    // their next check.
+    if (status == JOB_QUEUED)
+        gCoreContext->SendMessage(QString("JOB_QUEUED %1").arg(jobType));
+
     return true;
 }
 
@@ -1884,6 +1948,8 @@ void JobQueue::RemoveRunningJob(int id)
     }
 
     m_runningJobsLock->unlock();
+
+    WakeQueue();
 }
 
 QString JobQueue::PrettyPrint(off_t bytes)
@@ -14,7 +14,9 @@
 
 #include "mythtvexp.h"
 #include "libmythbase/mythchrono.h"
+#include "libmythbase/mythsettinghandle.h"
 
+class JobResourceMonitor;
 class MThread;
 class ProgramInfo;
 class RecordingInfo;
@@ -230,6 +232,7 @@ class MTV_PUBLIC JobQueue : public QObject, public QRunnable
     };
 
     void ProcessQueue(void);
+    void WakeQueue(void);
 
     void ProcessJob(const JobQueueEntry& job);
 
@@ -261,6 +264,9 @@ class MTV_PUBLIC JobQueue : public QObject, public QRunnable
 
     int                        m_jobsRunning         {0};
     int                        m_jobQueueCPU         {0};
+    // Read on every pass of the queue
+    MythSettingHandle<int>     m_checkFrequency      {"JobQueueCheckFrequency", 30};
+    MythSettingHandle<int>     m_maxJobs             {"JobQueueMaxSimultaneousJobs", 3};
 
     ProgramInfo               *m_pginfo              {nullptr};
 
@@ -276,6 +282,9 @@ class MTV_PUBLIC JobQueue : public QObject, public QRunnable
     QWaitCondition             m_queueThreadCond;
     QMutex                     m_queueThreadCondLock;
     bool                       m_processQueue        {false};
+    bool                       m_queueWake           {false};
+
+    JobResourceMonitor        *m_resources           {nullptr};
 };
 
 #endif
@@ -0,0 +1,213 @@
+// C++
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <utility>
+
+// Qt
+#include <QtGlobal>
+#include <QFile>
+
+// POSIX
+#include <sys/stat.h>
+#ifdef Q_OS_LINUX
+#include <sys/sysmacros.h>
+#endif
+
+// MythTV
+#include "libmythbase/mythchrono.h"
+#include "libmythbase/mythcorecontext.h"
+#include "libmythbase/mythdate.h"
+#include "libmythbase/mythdb.h"
+#include "libmythbase/mythlogging.h"
+#include "libmythbase/mythmiscutil.h"
+
+#include "jobresourcemonitor.h"
+#include "programtypes.h"
+
+#define LOC QString("JobResources: ")
+
+// How often the storage group directories are mapped to devices again
+static constexpr std::chrono::minutes kDeviceRefresh { 10min };
+// Disk utilisation is only resampled after this long
+static constexpr std::chrono::seconds kMinSampleTime { 2s };
+
+JobResourceMonitor::JobResourceMonitor(QString hostname)
+  : m_hostname(std::move(hostname))
+{
+}
+
+/** \brief Decide whether there is room to start another job now.
+ *  \param reason Set to a description of the limit that was hit.
+ */
+bool JobResourceMonitor::CanStartJob(QString &reason)
+{
+    int maxRecordings = gCoreContext->GetNumSetting("JobQueueMaxRecordings", -1);
+    if (maxRecordings >= 0)
+    {
+        int recordings = ActiveRecordings();
+        if (recordings > maxRecordings)
+        {
+            reason = QString("%1 recordings in progress, the limit is %2")
+                .arg(recordings).arg(maxRecordings);
+            return false;
+        }
+    }
+
+    int maxLoad = gCoreContext->GetNumSetting("JobQueueMaxCPULoad", -1);
+    if (maxLoad > 0)
+    {
+        double load = CPULoad();
+        if (load * 100 > maxLoad)
+        {
+            reason = QString("CPU load is %1%, the limit is %2%")
+                .arg(static_cast<int>(load * 100)).arg(maxLoad);
+            return false;
+        }
+    }
+
+    int maxBusy = gCoreContext->GetNumSetting("JobQueueMaxDiskBusy", 0);
+    if (maxBusy > 0)
+    {
+        int busy = DiskBusy();
+        if (busy > maxBusy)
+        {
+            reason = QString("storage is %1% busy (%2 MB/s), the limit is %3%")
+                .arg(busy).arg(m_lastMBps, 0, 'f', 1).arg(maxBusy);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// The one minute load average per CPU, or 0 if it is not available.
+double JobResourceMonitor::CPULoad(void) const
+{
+    loadArray loads = getLoadAvgs();
+    if (loads[0] < 0)
+        return 0.0;
+    unsigned int cpus = std::max(std::thread::hardware_concurrency(), 1U);
+    return loads[0] / cpus;
+}
+
+/// The number of recordings currently being made on this host.
+int JobResourceMonitor::ActiveRecordings(void) const
+{
+    MSqlQuery query(MSqlQuery::InitCon());
+    query.prepare("SELECT COUNT(*) FROM inuseprograms "
+                  "WHERE hostname = :HOSTNAME "
+                  "  AND recusage IN (:RECORDER, :IMPORT) "
+                  "  AND lastupdatetime > :ONEHOURAGO");
+    query.bindValue(":HOSTNAME", m_hostname);
+    query.bindValue(":RECORDER", kRecorderInUseID);
+    query.bindValue(":IMPORT", kImportRecorderInUseID);
+    query.bindValue(":ONEHOURAGO", MythDate::current().addSecs(-3600));
+
+    if (!query.exec() || !query.next())
+    {
+        MythDB::DBError("JobResourceMonitor::ActiveRecordings", query);
+        return 0;
+    }
+    return query.value(0).toInt();
+}
+
+/** \brief The utilisation, in percent, of the busiest device that holds a
+ *         storage group directory on this host.
+ *  \return 0 when the utilisation can't be measured.
+ */
+int JobResourceMonitor::DiskBusy(void)
+{
+#ifdef Q_OS_LINUX
+    if (m_sampleTime.isValid() &&
+        std::chrono::milliseconds(m_sampleTime.elapsed()) < kMinSampleTime)
+        return m_lastBusy;
+
+    if (!m_devicesAge.isValid() ||
+        std::chrono::milliseconds(m_devicesAge.elapsed()) > kDeviceRefresh)
+        UpdateDevices();
+    if (m_devices.isEmpty())
+        return 0;
+
+    QFile stats("/proc/diskstats");
+    if (!stats.open(QIODevice::ReadOnly))
+        return 0;
+
+    // major minor name reads merged sectors ms writes merged sectors ms
+    // in-flight io-ms ...
+    QHash<QString,DiskSample> sample;
+    for (const auto & line : stats.readAll().split('\n'))
+    {
+        QList<QByteArray> fields = line.simplified().split(' ');
+        if (fields.size() < 13)
+            continue;
+        QString device = QString("%1:%2").arg(fields[0].constData(),
+                                              fields[1].constData());
+        if (!m_devices.contains(device))
+            continue;
+        sample[device] = { fields[12].toULongLong(),
+                           fields[5].toULongLong() + fields[9].toULongLong() };
+    }
+
+    qint64 elapsed = m_sampleTime.isValid() ? m_sampleTime.restart() : 0;
+    if (!m_sampleTime.isValid())
+        m_sampleTime.start();
+
+    int busy = 0;
+    uint64_t sectors = 0;
+    if (elapsed > 0)
+    {
+        for (auto it = sample.cbegin(); it != sample.cend(); ++it)
+        {
+            auto last = m_lastSample.constFind(it.key());
+            if (last == m_lastSample.cend())
+                continue;
+            uint64_t ticks = it->m_ioTicks - last->m_ioTicks;
+            busy = std::max(busy, static_cast<int>(std::min<uint64_t>(
+                                     (ticks * 100) / static_cast<uint64_t>(elapsed), 100)));
+            sectors += it->m_sectors - last->m_sectors;
+        }
+        m_lastMBps = (sectors * 512.0) / (elapsed * 1000.0);
+    }
+
+    m_lastSample = sample;
+    m_lastBusy = busy;
+    return busy;
+#else
+    return 0;
+#endif
+}
+
+/// Find the devices holding this host's storage group directories.
+void JobResourceMonitor::UpdateDevices(void)
+{
+    m_devicesAge.start();
+    m_devices.clear();
+
+    MSqlQuery query(MSqlQuery::InitCon());
+    query.prepare("SELECT DISTINCT dirname FROM storagegroup "
+                  "WHERE hostname = :HOSTNAME");
+    query.bindValue(":HOSTNAME", m_hostname);
+    if (!query.exec())
+    {
+        MythDB::DBError("JobResourceMonitor::UpdateDevices", query);
+        return;
+    }
+
+#ifdef Q_OS_LINUX
+    while (query.next())
+    {
+        QByteArray dir = query.value(0).toString().toLocal8Bit();
+        struct stat st {};
+        if (stat(dir.constData(), &st) != 0)
+            continue;
+        QString device = QString("%1:%2").arg(major(st.st_dev))
+                                         .arg(minor(st.st_dev));
+        if (!m_devices.contains(device))
+            m_devices << device;
+    }
+#endif
+
+    LOG(VB_JOBQUEUE, LOG_DEBUG, LOC + QString("Storage devices: %1")
+        .arg(m_devices.join(", ")));
+}
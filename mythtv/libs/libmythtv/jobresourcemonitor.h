@@ -0,0 +1,58 @@
+#ifndef JOBRESOURCEMONITOR_H
+#define JOBRESOURCEMONITOR_H
+
+// C++
+#include <cstdint>
+
+// Qt
+#include <QElapsedTimer>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+/** \class JobResourceMonitor
+ *  \brief Measures the resources on this host that queued jobs compete
+ *         with recordings for, so the JobQueue can hold jobs back when
+ *         the host is busy.
+ *
+ *  Three things are measured: the load average relative to the number of
+ *  CPUs, the busiest disk holding a local storage group directory (from
+ *  /proc/diskstats, so only on Linux) and the number of recordings being
+ *  made on this host. Limits come from the JobQueueMaxCPULoad,
+ *  JobQueueMaxDiskBusy and JobQueueMaxRecordings host settings, which are
+ *  all off unless a host turns them on.
+ *
+ *  Disk utilisation is the fraction of time the device had I/O in flight
+ *  between two samples, so the first call after construction only primes
+ *  the counters.
+ */
+class JobResourceMonitor
+{
+  public:
+    explicit JobResourceMonitor(QString hostname);
+
+    bool    CanStartJob(QString &reason);
+
+    double  CPULoad(void) const;
+    int     DiskBusy(void);
+    int     ActiveRecordings(void) const;
+
+  private:
+    struct DiskSample
+    {
+        uint64_t m_ioTicks { 0 };
+        uint64_t m_sectors { 0 };
+    };
+
+    void    UpdateDevices(void);
+
+    QString                 m_hostname;
+    QStringList             m_devices;
+    QElapsedTimer           m_devicesAge;
+    QHash<QString,DiskSample> m_lastSample;
+    QElapsedTimer           m_sampleTime;
+    int                     m_lastBusy      { 0 };
+    double                  m_lastMBps      { 0.0 };
+};
+
+#endif // JOBRESOURCEMONITOR_H
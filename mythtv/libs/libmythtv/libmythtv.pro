@@ -85,7 +85,7 @@ HEADERS += recordinginfo.h
 HEADERS += dbcheck.h
 HEADERS += videodbcheck.h
 HEADERS += tvremoteutil.h           tv.h
-HEADERS += jobqueue.h
+HEADERS += jobqueue.h               jobresourcemonitor.h
 HEADERS += recordingprofile.h
 HEADERS += remoteencoder.h          videosource.h
 HEADERS += cardutil.h               sourceutil.h
@@ -101,6 +101,8 @@ HEADERS += signalmonitorvalue.h     signalmonitorlistener.h
 HEADERS += livetvchain.h            playgroup.h
 HEADERS += channelsettings.h
 HEADERS += previewgenerator.h       previewgeneratorqueue.h
+HEADERS += previewworkerpool.h
+HEADERS += thumbstrip.h
 HEADERS += transporteditor.h        listingsources.h
 HEADERS += restoredata.h
 HEADERS += channelgroup.h
@@ -118,6 +120,7 @@ HEADERS += mythaverror.h
 HEADERS += mythavframe.h
 HEADERS += mythavrational.h
 HEADERS += mythavutil.h
+HEADERS += compactprogramlist.h
 HEADERS += programinfo.h
 HEADERS += programinforemoteutil.h
 HEADERS += programinfoupdater.h
@@ -136,7 +139,7 @@ SOURCES += recordinginfo.cpp
 SOURCES += dbcheck.cpp
 SOURCES += videodbcheck.cpp
 SOURCES += tvremoteutil.cpp         tv.cpp
-SOURCES += jobqueue.cpp
+SOURCES += jobqueue.cpp             jobresourcemonitor.cpp
 SOURCES += recordingprofile.cpp
 SOURCES += remoteencoder.cpp        videosource.cpp
 SOURCES += cardutil.cpp             sourceutil.cpp
@@ -152,6 +155,8 @@ SOURCES += signalmonitorvalue.cpp
 SOURCES += livetvchain.cpp          playgroup.cpp
 SOURCES += channelsettings.cpp
 SOURCES += previewgenerator.cpp     previewgeneratorqueue.cpp
+SOURCES += previewworkerpool.cpp
+SOURCES += thumbstrip.cpp
 SOURCES += transporteditor.cpp
 SOURCES += restoredata.cpp
 SOURCES += channelgroup.cpp
@@ -168,6 +173,7 @@ SOURCES += mythframe.cpp
 SOURCES += mythavbufferref.cpp
 SOURCES += mythaverror.cpp
 SOURCES += mythavutil.cpp
+SOURCES += compactprogramlist.cpp
 SOURCES += programinfo.cpp
 SOURCES += programinforemoteutil.cpp
 SOURCES += programinfoupdater.cpp
@@ -351,6 +357,7 @@ inc.files += mythtvexp.h            metadataimagehelper.h
 inc.files += mythavutil.h           mythframe.h
 inc.files += mythaverror.h
 inc.files += mythavframe.h
+inc.files += compactprogramlist.h
 inc.files += programinfo.h
 inc.files += programinforemoteutil.h
 inc.files += programtypes.h
@@ -553,7 +560,7 @@ using_frontend {
     HEADERS += mythvideooutnull.h
     HEADERS += mythvideooutgpu.h
     HEADERS += mythvideogpu.h
-    HEADERS += videobuffers.h
+    HEADERS += videobuffers.h           mythvideoframepool.h
     HEADERS += jitterometer.h
     HEADERS += mythvideoprofile.h mythcodecid.h
     HEADERS += videoouttypes.h
@@ -569,7 +576,7 @@ using_frontend {
     SOURCES += mythvideooutnull.cpp
     SOURCES += mythvideooutgpu.cpp
     SOURCES += mythvideogpu.cpp
-    SOURCES += videobuffers.cpp
+    SOURCES += videobuffers.cpp         mythvideoframepool.cpp
     SOURCES += jitterometer.cpp
     SOURCES += mythvideoprofile.cpp mythcodecid.cpp
     SOURCES += mythvideobounds.cpp
@@ -969,6 +976,7 @@ using_backend {
     HEADERS += recorders/rtp/rtpdatapacket.h
     HEADERS += recorders/rtp/rtpfecpacket.h
     HEADERS += recorders/rtp/rtcpdatapacket.h
+    HEADERS += recorders/rtp/udpreceiver.h
 
     SOURCES += recorders/cetonrtsp.cpp
     SOURCES += recorders/iptvchannel.cpp
@@ -980,6 +988,7 @@ using_backend {
     SOURCES += recorders/rtp/packetbuffer.cpp
     SOURCES += recorders/rtp/rtpdatapacket.cpp
     SOURCES += recorders/rtp/rtppacketbuffer.cpp
+    SOURCES += recorders/rtp/udpreceiver.cpp
 
     # Support for HTTP TS streams
     HEADERS += recorders/httptsstreamhandler.h
@@ -992,12 +1001,14 @@ using_backend {
     HEADERS += recorders/HLS/HLSPlaylistWorker.h
     HEADERS += recorders/HLS/HLSReader.h
     HEADERS += recorders/HLS/HLSSegment.h
+    HEADERS += recorders/HLS/HLSSegmentPrefetch.h
     HEADERS += recorders/HLS/HLSStream.h
     HEADERS += recorders/HLS/HLSStreamWorker.h
 
     SOURCES += recorders/HLS/HLSPlaylistWorker.cpp
     SOURCES += recorders/HLS/HLSReader.cpp
     SOURCES += recorders/HLS/HLSSegment.cpp
+    SOURCES += recorders/HLS/HLSSegmentPrefetch.cpp
     SOURCES += recorders/HLS/HLSStream.cpp
     SOURCES += recorders/HLS/HLSStreamWorker.cpp
 
@@ -38,6 +38,7 @@
 #include "livetvchain.h"
 #include "mythavutil.h"
 #include "mythplayer.h"
+#include "mythvideoframepool.h"
 #include "mythvideooutnull.h"
 #include "programinfo.h"
 #include "remoteencoder.h"
@@ -112,6 +113,9 @@ MythPlayer::~MythPlayer(void)
 
     delete m_videoOutput;
     m_videoOutput = nullptr;
+
+    // Do not hold on to idle frame buffers once playback is over
+    MythVideoFramePool::GetPool()->Trim();
 }
 
 void MythPlayer::SetWatchingRecording(bool mode)
@@ -1344,6 +1348,8 @@ bool MythPlayer::UpdateFFRewSkip(float ffrewScale)
         m_frameInterval = microsecondsFromFloat((1000000.0 / m_videoFrameRate / static_cast<double>(temp_speed))
            / m_fpsMultiplier);
         m_ffrewSkip = static_cast<int>(m_playSpeed != 0.0F);
+        if (m_decoder)
+            m_decoder->SetTrickPlay(false);
         LOG(VB_PLAYBACK, LOG_DEBUG, LOC + "Clearing render one");
     }
     else
@@ -1361,6 +1367,9 @@ bool MythPlayer::UpdateFFRewSkip(float ffrewScale)
         float dis_fps = 1000000.0F / m_frameInterval.count();
         m_ffrewSkip = (int)ceil(ffw_fps / dis_fps);
         m_ffrewSkip = m_playSpeed < 0.0F ? -m_ffrewSkip : m_ffrewSkip;
+        // Only keyframes are shown at these speeds, so don't decode the rest
+        if (m_decoder)
+            m_decoder->SetTrickPlay(true);
         LOG(VB_PLAYBACK, LOG_INFO, LOC +
             QString("new skip %1, interval %2, scale %3")
             .arg(m_ffrewSkip).arg(m_frameInterval.count()).arg(m_ffrewScale));
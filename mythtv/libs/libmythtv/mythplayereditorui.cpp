@@ -1,6 +1,12 @@
 #include <algorithm>
+#include <utility>
+
+// Qt
+#include <QMutex>
+#include <QRunnable>
 
 // MythTV
+#include "libmythbase/mthreadpool.h"
 #include "libmythbase/mythlogging.h"
 #include "libmythui/mythuiactions.h"
 #include "tv_actions.h"
@@ -9,6 +15,35 @@
 
 #define LOC QString("Editor: ")
 
+/// A thumbnail strip being loaded for the editor
+struct ThumbStripLoad
+{
+    QMutex     m_lock;
+    ThumbStrip m_strip;
+    bool       m_done { false };
+};
+
+/// Loads the strip off the UI thread, it may be fetched from a backend
+class ThumbStripLoader : public QRunnable
+{
+  public:
+    ThumbStripLoader(std::shared_ptr<ThumbStripLoad> Load, QString Filename)
+      : m_load(std::move(Load)), m_filename(std::move(Filename)) {}
+
+    void run() override
+    {
+        ThumbStrip strip;
+        strip.Load(m_filename);
+        QMutexLocker locker(&m_load->m_lock);
+        m_load->m_strip = strip;
+        m_load->m_done = true;
+    }
+
+  private:
+    std::shared_ptr<ThumbStripLoad> m_load;
+    QString m_filename;
+};
+
 MythPlayerEditorUI::MythPlayerEditorUI(MythMainWindow* MainWindow, TV* Tv, PlayerContext* Context, PlayerFlags Flags)
   : MythPlayerVisualiserUI(MainWindow, Tv, Context, Flags)
 {
@@ -78,8 +113,20 @@ void MythPlayerEditorUI::EnableEdit()
     if (loadedAutoSave)
         UpdateOSDMessage(tr("Using previously auto-saved cuts"), kOSDTimeout_Short);
 
+    // Thumbnails made when the recording finished, if there are any. They
+    // are shown once loaded, see CheckSeekPreviewLoaded().
+    if (!m_thumbStrip.IsValid() && !m_thumbStripLoad && m_playerCtx->m_buffer)
+    {
+        m_thumbStripLoad = std::make_shared<ThumbStripLoad>();
+        MThreadPool::globalInstance()->start(
+            new ThumbStripLoader(m_thumbStripLoad,
+                ThumbStrip::GetFilename(m_playerCtx->m_buffer->GetFilename())),
+            "ThumbStripLoad");
+    }
+
     m_deleteMap.UpdateSeekAmount(0);
     m_deleteMap.UpdateOSD(m_framesPlayed, m_videoFrameRate, &m_osd);
+    UpdateSeekPreview();
     m_deleteMap.SetFileEditing(true);
     m_playerCtx->LockPlayingInfo(__FILE__, __LINE__);
     if (m_playerCtx->m_playingInfo)
@@ -276,12 +323,45 @@ bool MythPlayerEditorUI::HandleProgramEditorActions(const QStringList& Actions)
     {
         m_osdLock.lock();
         m_deleteMap.UpdateOSD(m_framesPlayed, m_videoFrameRate, &m_osd);
+        UpdateSeekPreview();
         m_osdLock.unlock();
     }
 
     return handled;
 }
 
+/*! \brief Show the thumbnail for the current position in the editor OSD.
+ *
+ * Themes that have a "seekpreview" image in the program editor window get
+ * the keyframe thumbnail nearest the cursor, taken from the strip that was
+ * made when the recording finished. Caller must hold m_osdLock.
+ */
+void MythPlayerEditorUI::UpdateSeekPreview()
+{
+    if (!m_thumbStrip.IsValid() || m_videoFrameRate <= 0.0)
+        return;
+    auto position = millisecondsFromFloat(m_framesPlayed * 1000.0 / m_videoFrameRate);
+    m_osd.SetImage(OSD_WIN_PROGEDIT, "seekpreview", m_thumbStrip.GetThumbnail(position));
+}
+
+/// Show the seek preview once the thumbnail strip has loaded.
+void MythPlayerEditorUI::CheckSeekPreviewLoaded()
+{
+    if (!m_thumbStripLoad)
+        return;
+
+    {
+        QMutexLocker locker(&m_thumbStripLoad->m_lock);
+        if (!m_thumbStripLoad->m_done)
+            return;
+        m_thumbStrip = m_thumbStripLoad->m_strip;
+    }
+    m_thumbStripLoad.reset();
+
+    QMutexLocker locker(&m_osdLock);
+    UpdateSeekPreview();
+}
+
 bool MythPlayerEditorUI::DoFastForwardSecs(float Seconds, double Inaccuracy, bool UseCutlist)
 {
     float current = ComputeSecs(m_framesPlayed, UseCutlist);
@@ -1,8 +1,14 @@
 #ifndef MYTHPLAYEREDITORUI_H
 #define MYTHPLAYEREDITORUI_H
 
+// Std
+#include <memory>
+
 // MythtTV
 #include "mythplayervisualiserui.h"
+#include "thumbstrip.h"
+
+struct ThumbStripLoad;
 
 class MythPlayerEditorUI : public MythPlayerVisualiserUI
 {
@@ -24,12 +30,16 @@ class MythPlayerEditorUI : public MythPlayerVisualiserUI
 
   protected:
     void    HandleArbSeek(bool Direction);
+    void    UpdateSeekPreview();
+    void    CheckSeekPreviewLoaded();
     bool    DoFastForwardSecs(float Seconds, double Inaccuracy, bool UseCutlist);
     bool    DoRewindSecs     (float Seconds, double Inaccuracy, bool UseCutlist);
 
     QElapsedTimer m_editUpdateTimer;
     float   m_speedBeforeEdit  { 1.0   };
     bool    m_pausedBeforeEdit { false };
+    ThumbStrip m_thumbStrip;
+    std::shared_ptr<ThumbStripLoad> m_thumbStripLoad;
 
   private:
     Q_DISABLE_COPY(MythPlayerEditorUI)
@@ -140,6 +140,10 @@ void MythPlayerUI::EventLoop()
     // reset the scan (and hence deinterlacers) if triggered by the decoder
     CheckScanUpdate(m_videoOutput, m_frameInterval);
 
+    // show the seek preview when its thumbnails have loaded
+    if (m_thumbStripLoad && m_deleteMap.IsEditing())
+        CheckSeekPreviewLoaded();
+
     // refresh the position map for an in-progress recording while editing
     if (m_hasFullPositionMap && IsWatchingInprogress() && m_deleteMap.IsEditing())
     {
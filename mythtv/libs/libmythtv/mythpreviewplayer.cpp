@@ -1,5 +1,9 @@
 #include <thread>
 
+extern "C" {
+#include "libavutil/mem.h"
+}
+
 // MythTV
 #include "mythpreviewplayer.h"
 
@@ -146,6 +150,91 @@ uint8_t *MythPreviewPlayer::GetScreenGrabAtFrame(uint64_t FrameNum, bool Absolut
     return result;
 }
 
+/*! \brief Returns a thumbnail for every Interval of the video
+ *
+ *   Only keyframes are decoded, each thumbnail is the keyframe nearest
+ *   to its position. Thumbnails are TileWidth wide and keep the video
+ *   aspect ratio.
+ *
+ *  \param Interval  [in,out] Distance between thumbnails, increased when
+ *                   the video would need more than MaxTiles of them
+ *  \param TileWidth [in]  Width of each thumbnail
+ *  \param MaxTiles  [in]  Maximum number of thumbnails to return
+ */
+QList<QImage> MythPreviewPlayer::GetThumbnails(std::chrono::seconds& Interval, int TileWidth, int MaxTiles)
+{
+    QList<QImage> result;
+
+    if (OpenFile(0) < 0)
+    {
+        LOG(VB_GENERAL, LOG_ERR, LOC + "Could not open file for thumbnails.");
+        return result;
+    }
+
+    if ((m_videoDim.width() <= 0) || (m_videoDim.height() <= 0) ||
+        m_playerCtx->m_buffer->IsBD() || m_playerCtx->m_buffer->IsDVD())
+    {
+        LOG(VB_GENERAL, LOG_WARNING, LOC + QString("Cannot generate thumbnails for '%1'")
+            .arg(m_playerCtx->m_buffer->GetSafeFilename()));
+        return result;
+    }
+
+    if (!InitVideo())
+    {
+        LOG(VB_GENERAL, LOG_ERR, LOC + "Unable to initialize video for thumbnails.");
+        return result;
+    }
+
+    double fps = m_videoFrameRate > 0.0 ? m_videoFrameRate : 25.0;
+    auto duration = std::chrono::seconds(static_cast<int64_t>(m_totalFrames / fps));
+    if (MaxTiles > 0 && duration / Interval >= MaxTiles)
+        Interval = duration / MaxTiles + 1s;
+    auto step = std::max(static_cast<uint64_t>(Interval.count() * fps), UINT64_C(1));
+
+    float aspect = m_videoAspect > 0.0F ? m_videoAspect : 16.0F / 9.0F;
+    int height = static_cast<int>(TileWidth / aspect) & ~1;
+    QSize tile(TileWidth, std::clamp(height, TileWidth / 4, TileWidth));
+
+    ClearAfterSeek();
+    if (!m_decoderThread)
+        DecoderStart(true /*start paused*/);
+    // Nothing between the keyframes is wanted
+    m_decoder->SetTrickPlay(true);
+
+    for (uint64_t number = 0; number < m_totalFrames; number += step)
+    {
+        DiscardVideoFrame(m_videoOutput->GetLastDecodedFrame());
+        DoJumpToFrame(number, kInaccuracyFull);
+        int tries = 0;
+        while (!m_videoOutput->ValidVideoFrames() && (tries < 500))
+        {
+            tries += 1;
+            m_decodeOneFrame = true;
+            std::this_thread::sleep_for(10ms);
+        }
+
+        MythVideoFrame *frame = m_videoOutput->GetLastDecodedFrame();
+        if (!frame || !frame->m_buffer)
+        {
+            LOG(VB_GENERAL, LOG_WARNING, LOC + QString("No frame at %1, stopping").arg(number));
+            break;
+        }
+
+        uint8_t* buffer = MythVideoFrame::CreateBuffer(FMT_RGB32, m_videoDim.width(), m_videoDim.height());
+        MythAVCopy copyCtx;
+        AVFrame retbuf;
+        memset(&retbuf, 0, sizeof(AVFrame));
+        copyCtx.Copy(&retbuf, frame, buffer, AV_PIX_FMT_RGB32);
+        QImage image(buffer, m_videoDim.width(), m_videoDim.height(), retbuf.linesize[0],
+                     QImage::Format_RGB32, [](void* Buffer) { av_free(Buffer); }, buffer);
+        result.append(image.scaled(tile, Qt::IgnoreAspectRatio, Qt::SmoothTransformation));
+    }
+
+    m_decoder->SetTrickPlay(false);
+    DiscardVideoFrame(m_videoOutput->GetLastDecodedFrame());
+    return result;
+}
+
 void MythPreviewPlayer::SeekForScreenGrab(uint64_t& Number, uint64_t FrameNum, bool Absolute)
 {
     Number = FrameNum;
@@ -193,6 +282,8 @@ void MythPreviewPlayer::SeekForScreenGrab(uint64_t& Number, uint64_t FrameNum, b
         }
     }
 
+    // A preview doesn't need the exact frame, stopping at the nearest
+    // keyframe in the seek table saves decoding up to a GOP per preview.
     DiscardVideoFrame(m_videoOutput->GetLastDecodedFrame());
-    DoJumpToFrame(Number, kInaccuracyNone);
+    DoJumpToFrame(Number, Absolute ? kInaccuracyNone : kInaccuracyFull);
 }
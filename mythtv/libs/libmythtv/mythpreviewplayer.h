@@ -4,6 +4,10 @@
 // MythTV
 #include "mythplayer.h"
 
+// Qt
+#include <QImage>
+#include <QList>
+
 class MythPreviewPlayer : public MythPlayer
 {
   public:
@@ -12,6 +16,7 @@ class MythPreviewPlayer : public MythPlayer
                                   int& FrameWidth, int& FrameHeight, float& AspectRatio);
     uint8_t* GetScreenGrab       (std::chrono::seconds SecondsIn, int& BufferSize, int& FrameWidth,
                                   int& FrameHeight, float& AspectRatio);
+    QList<QImage> GetThumbnails(std::chrono::seconds& Interval, int TileWidth, int MaxTiles);
 
   private:
     void  SeekForScreenGrab(uint64_t& Number, uint64_t FrameNum, bool Absolute);
@@ -0,0 +1,130 @@
+// Std
+#include <bit>
+
+// MythTV
+#include "mythvideoframepool.h"
+
+// FFmpeg
+extern "C" {
+#include "libavutil/mem.h"
+}
+
+// Enough to hold on to a full set of 1080p software frames plus a set of SD
+// frames, which covers the common live TV channel change case.
+static constexpr size_t MAX_FREE_BYTES { 256ULL * 1024 * 1024 };
+
+/*! \class MythVideoFramePool
+ * \brief A process wide pool of aligned software video frame buffers.
+ *
+ * VideoBuffers draws its software frame buffers from the pool and returns them
+ * when the buffers are torn down, so that switching between e.g. SD and HD
+ * channels in live TV reuses buffers of a matching size class rather than
+ * freeing and reallocating them. MythPlayer calls Trim() when it is deleted,
+ * so idle buffers do not outlive playback.
+ *
+ * Requests are rounded up to a size class (at most 1/8th larger than the
+ * request) so that buffers for similar frame sizes are interchangeable. Up to
+ * MAX_FREE_BYTES of idle buffers are retained - anything beyond that is freed
+ * immediately.
+ *
+ * \note Buffers are allocated with the same padding as
+ * MythVideoFrame::GetAlignedBuffer but must always be handed back with
+ * ReleaseBuffer. A buffer freed with av_free leaves a stale record of its
+ * address and, if the allocator reuses it, a later buffer would be filed under
+ * the wrong size class.
+*/
+MythVideoFramePool* MythVideoFramePool::GetPool()
+{
+    static auto* s_pool = new MythVideoFramePool();
+    return s_pool;
+}
+
+MythVideoFramePool::~MythVideoFramePool()
+{
+    Trim();
+}
+
+size_t MythVideoFramePool::SizeClass(size_t Size)
+{
+    size_t step = std::max(std::bit_floor(Size) / 8, static_cast<size_t>(4096));
+    return (Size + step - 1) & ~(step - 1);
+}
+
+uint8_t* MythVideoFramePool::GetBuffer(size_t Size)
+{
+    if (!Size)
+        return nullptr;
+
+    size_t size = SizeClass(Size);
+    QMutexLocker locker(&m_lock);
+
+    auto it = m_free.find(size);
+    if (it != m_free.end() && !it->second.empty())
+    {
+        uint8_t* buffer = it->second.back();
+        it->second.pop_back();
+        m_freeBytes -= size;
+        m_inUse.emplace(buffer, size);
+        m_reuses++;
+        return buffer;
+    }
+
+    // Match MythVideoFrame::GetAlignedBuffer padding
+    auto* buffer = static_cast<uint8_t*>(av_malloc(size + 64));
+    if (buffer)
+    {
+        m_inUse.emplace(buffer, size);
+        m_allocations++;
+    }
+    return buffer;
+}
+
+void MythVideoFramePool::ReleaseBuffer(uint8_t* Buffer)
+{
+    if (!Buffer)
+        return;
+
+    QMutexLocker locker(&m_lock);
+    auto it = m_inUse.find(Buffer);
+    if (it == m_inUse.end())
+    {
+        // Not one of ours
+        av_free(Buffer);
+        return;
+    }
+
+    size_t size = it->second;
+    m_inUse.erase(it);
+
+    if (m_freeBytes + size > MAX_FREE_BYTES)
+    {
+        av_free(Buffer);
+        m_frees++;
+        return;
+    }
+
+    m_free[size].push_back(Buffer);
+    m_freeBytes += size;
+}
+
+/// \brief Free all idle buffers.
+void MythVideoFramePool::Trim()
+{
+    QMutexLocker locker(&m_lock);
+    for (auto & [size, buffers] : m_free)
+    {
+        for (auto * buffer : buffers)
+            av_free(buffer);
+        m_frees += buffers.size();
+    }
+    m_free.clear();
+    m_freeBytes = 0;
+}
+
+QString MythVideoFramePool::GetStats()
+{
+    QMutexLocker locker(&m_lock);
+    return QString("allocated:%1 reused:%2 freed:%3 in use:%4 idle:%5MB")
+        .arg(m_allocations).arg(m_reuses).arg(m_frees)
+        .arg(m_inUse.size()).arg(m_freeBytes / (1024 * 1024));
+}
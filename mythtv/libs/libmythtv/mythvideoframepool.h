@@ -0,0 +1,45 @@
+#ifndef MYTHVIDEOFRAMEPOOL_H
+#define MYTHVIDEOFRAMEPOOL_H
+
+// Std
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+// Qt
+#include <QMutex>
+#include <QString>
+
+// MythTV
+#include "libmythtv/mythtvexp.h"
+
+class MTV_PUBLIC MythVideoFramePool
+{
+  public:
+    static MythVideoFramePool* GetPool();
+
+    uint8_t* GetBuffer(size_t Size);
+    void     ReleaseBuffer(uint8_t* Buffer);
+    void     Trim();
+    QString  GetStats();
+
+    // Deleted functions should be public.
+    MythVideoFramePool(const MythVideoFramePool &) = delete;            // not copyable
+    MythVideoFramePool &operator=(const MythVideoFramePool &) = delete; // not copyable
+
+  private:
+    MythVideoFramePool() = default;
+   ~MythVideoFramePool();
+
+    static size_t SizeClass(size_t Size);
+
+    QMutex   m_lock;
+    std::map<size_t, std::vector<uint8_t*>> m_free;
+    std::unordered_map<uint8_t*, size_t>    m_inUse;
+    size_t   m_freeBytes   { 0 };
+    uint64_t m_allocations { 0 };
+    uint64_t m_reuses      { 0 };
+    uint64_t m_frees       { 0 };
+};
+
+#endif
@@ -451,6 +451,28 @@ void OSD::SetGraph(const QString &Window, const QString &Graph, std::chrono::mil
         image->SetImage(mi);
 }
 
+void OSD::SetImage(const QString &Window, const QString &Name, const QImage &Image)
+{
+    MythScreenType *win = GetWindow(Window);
+    if (!win)
+        return;
+
+    auto *uiimage = dynamic_cast<MythUIImage* >(win->GetChild(Name));
+    if (!uiimage)
+        return;
+
+    if (Image.isNull())
+    {
+        uiimage->Reset();
+        return;
+    }
+
+    MythImage* mi = m_painter->GetFormatImage();
+    mi->Assign(Image);
+    uiimage->SetImage(mi);
+    mi->DecrRef();
+}
+
 void OSD::Draw()
 {
     if (m_embedded)
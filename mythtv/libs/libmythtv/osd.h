@@ -36,6 +36,7 @@ static constexpr const char* OSD_WIN_PROGEDIT { "osd_program_editor" };
 
 static constexpr std::chrono::milliseconds kOSDFadeTime { 1s };
 
+class QImage;
 class TV;
 class MythMainWindow;
 class MythPlayerUI;
@@ -123,6 +124,7 @@ class OSD : public MythMediaOverlay
     void SetValues(const QString &Window, const QHash<QString,float> &Map, OSDTimeout Timeout);
     void SetRegions(const QString &Window, frm_dir_map_t &Map, long long Total);
     void SetGraph(const QString &Window, const QString &Graph, std::chrono::milliseconds Timecode);
+    void SetImage(const QString &Window, const QString &Name, const QImage &Image);
     bool IsWindowVisible(const QString &Window);
 
     bool DialogVisible(const QString& Window = QString());
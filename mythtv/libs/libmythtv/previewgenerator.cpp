@@ -34,6 +34,7 @@
 #include "mythpreviewplayer.h"
 #include "playercontext.h"
 #include "previewgenerator.h"
+#include "previewworkerpool.h"
 #include "tv_rec.h"
 
 #define LOC QString("Preview: ")
@@ -237,7 +238,7 @@ bool PreviewGenerator::Run(void)
     }
     else
     {
-        // This is where we fork and run mythpreviewgen to actually make preview
+        // This is where we run mythpreviewgen to actually make preview
         QStringList cmdargs;
 
         cmdargs << "--size"
@@ -254,6 +255,14 @@ bool PreviewGenerator::Run(void)
         if (!m_outFileName.isEmpty())
             cmdargs << "--outfile" << m_outFileName;
 
+#ifndef _WIN32
+        // Hand the preview to one of the persistent mythpreviewgen workers,
+        // this avoids process and player start up for every preview.
+        bool pool_ok = PreviewWorkerPool::GetPool()->Generate(
+            m_programInfo, m_outSize, m_captureTime, m_captureFrame,
+            m_outFileName);
+        uint ret = pool_ok ? GENERIC_EXIT_OK : GENERIC_EXIT_NOT_OK;
+#else
         // Timeout in 30s
         auto *ms = new MythSystemLegacy(command, cmdargs,
                                         kMSDontBlockInputDevs |
@@ -267,6 +276,7 @@ bool PreviewGenerator::Run(void)
         ms->Run(30s);
         uint ret = ms->Wait();
         delete ms;
+#endif
 
         if (ret != GENERIC_EXIT_OK)
         {
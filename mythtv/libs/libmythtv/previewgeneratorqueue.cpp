@@ -16,6 +16,7 @@
 
 // libmythtv
 #include "previewgenerator.h"
+#include "previewworkerpool.h"
 #include "programinforemoteutil.h"
 
 #define LOC QString("PreviewQueue: ")
@@ -55,6 +56,10 @@ void PreviewGeneratorQueue::TeardownPreviewGeneratorQueue()
     s_pgq->wait();
     delete s_pgq;
     s_pgq = nullptr;
+
+#ifndef _WIN32
+    PreviewWorkerPool::Shutdown();
+#endif
 }
 
 /*
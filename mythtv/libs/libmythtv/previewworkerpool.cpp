@@ -0,0 +1,277 @@
+// C++
+#include <algorithm>
+
+// Qt
+#include <QDeadlineTimer>
+#include <QFileInfo>
+#include <QProcess>
+#include <QThread>
+
+// MythTV
+#include "libmythbase/mthread.h"
+#include "libmythbase/mythdate.h"
+#include "libmythbase/mythdirs.h"
+#include "libmythbase/mythlogging.h"
+
+#include "previewworkerpool.h"
+#include "programinfo.h"
+
+#define LOC QString("PreviewWorkers: ")
+
+// The backend waits this long for a preview, as it did for mythpreviewgen
+static constexpr std::chrono::seconds kRequestTimeout { 30s };
+// Workers exit after 5 minutes idle, replace them before that
+static constexpr std::chrono::seconds kMaxIdle        { 4min };
+
+PreviewWorkerPool *PreviewWorkerPool::s_pool = nullptr;
+QMutex             PreviewWorkerPool::s_poolLock;
+
+PreviewWorkerPool *PreviewWorkerPool::GetPool(void)
+{
+    QMutexLocker locker(&s_poolLock);
+    if (!s_pool)
+        s_pool = new PreviewWorkerPool();
+    return s_pool;
+}
+
+void PreviewWorkerPool::Shutdown(void)
+{
+    QMutexLocker locker(&s_poolLock);
+    if (!s_pool)
+        return;
+
+    QMetaObject::invokeMethod(s_pool, [](){ s_pool->StopWorkers(); },
+                              Qt::BlockingQueuedConnection);
+
+    // The pool and its QProcess children belong to the pool thread, so
+    // they must be deleted there. Deferred deletes are run when the
+    // thread finishes.
+    MThread *thread = s_pool->m_thread;
+    s_pool->deleteLater();
+    s_pool = nullptr;
+    thread->quit();
+    thread->wait();
+    delete thread;
+}
+
+PreviewWorkerPool::PreviewWorkerPool()
+  : m_thread(new MThread("PreviewWorkers")),
+    m_maxWorkers(std::clamp(QThread::idealThreadCount() / 2, 1, 4))
+{
+    moveToThread(m_thread->qthread());
+    m_thread->start();
+}
+
+/** \brief Generate a preview, blocking until it is done.
+ *
+ *  Takes the same parameters as mythpreviewgen. The recording is found by
+ *  the worker from its chanid and start time. The timeout starts when a
+ *  worker is given the request, not while it waits for a free worker.
+ *  \return true if the worker reported that the preview was saved.
+ */
+bool PreviewWorkerPool::Generate(const ProgramInfo &pginfo, QSize size,
+                                 std::chrono::seconds time, long long frame,
+                                 const QString &outfile)
+{
+    auto request = std::make_shared<Request>();
+    {
+        QMutexLocker locker(&m_lock);
+        request->m_id = ++m_nextId;
+        request->m_line = QString("%1\t%2\t%3\t%4\t%5\t%6x%7\t%8\n")
+            .arg(request->m_id)
+            .arg(pginfo.GetChanID())
+            .arg(pginfo.GetRecordingStartTime(MythDate::ISODate))
+            .arg(time.count())
+            .arg(frame)
+            .arg(size.width()).arg(size.height())
+            .arg(outfile).toUtf8();
+        m_pending.push_back(request);
+    }
+    QMetaObject::invokeMethod(this, [this](){ Dispatch(); },
+                              Qt::QueuedConnection);
+
+    // A queued request fails or is handed to a worker when one frees up,
+    // or is killed for taking too long.
+    QMutexLocker locker(&m_lock);
+    while (!request->m_done && !request->m_started)
+        m_done.wait(&m_lock);
+
+    QDeadlineTimer deadline(kRequestTimeout);
+    while (!request->m_done)
+    {
+        if (!m_done.wait(&m_lock, deadline))
+            break;
+    }
+
+    if (!request->m_done)
+    {
+        LOG(VB_GENERAL, LOG_ERR, LOC +
+            QString("Timed out generating preview for %1")
+            .arg(pginfo.toString(ProgramInfo::kRecordingKey)));
+        QMetaObject::invokeMethod(this, [this, request](){ Cancel(request); },
+                                  Qt::QueuedConnection);
+        return false;
+    }
+    return request->m_ok;
+}
+
+/// Hand pending requests to idle workers, starting workers as needed.
+void PreviewWorkerPool::Dispatch(void)
+{
+    QMutexLocker locker(&m_lock);
+    while (!m_pending.isEmpty())
+    {
+        QProcess *worker = nullptr;
+        while (!worker && !m_idle.isEmpty())
+        {
+            worker = m_idle.takeLast();
+            if (m_idleSince.take(worker).secsTo(MythDate::current()) >
+                kMaxIdle.count())
+            {
+                // It may be about to exit, let it go
+                worker->closeWriteChannel();
+                worker = nullptr;
+            }
+        }
+        if (!worker && (m_workers.size() < m_maxWorkers))
+        {
+            worker = StartWorker();
+            if (!worker && m_workers.isEmpty())
+            {
+                FailPending();
+                return;
+            }
+        }
+        if (!worker)
+            return;
+
+        RequestPtr request = m_pending.takeFirst();
+        m_busy[worker] = request;
+        worker->write(request->m_line);
+        request->m_started = true;
+        m_done.wakeAll();
+    }
+}
+
+/// Start a worker process, m_lock must be held.
+QProcess *PreviewWorkerPool::StartWorker(void)
+{
+    QString command = GetAppBinDir() + "mythpreviewgen";
+    if (!QFileInfo(command).isExecutable())
+    {
+        LOG(VB_GENERAL, LOG_ERR, LOC + QString("Cannot run '%1'").arg(command));
+        return nullptr;
+    }
+
+    QStringList args { "--server" };
+    args << logPropagateArgList;
+    if (!logPropagateQuiet())
+        args << "--quiet";
+
+    auto *worker = new QProcess(this);
+    worker->setStandardErrorFile(QProcess::nullDevice());
+    connect(worker, &QProcess::readyReadStandardOutput, this,
+            [this, worker](){ ReadResponses(worker); });
+    connect(worker, qOverload<int,QProcess::ExitStatus>(&QProcess::finished), this,
+            [this, worker](){ WorkerFinished(worker); });
+    worker->start(command, args);
+    if (!worker->waitForStarted(5000))
+    {
+        LOG(VB_GENERAL, LOG_ERR, LOC + QString("Failed to start '%1': %2")
+            .arg(command, worker->errorString()));
+        worker->disconnect(this);
+        delete worker;
+        return nullptr;
+    }
+
+    m_workers.push_back(worker);
+    LOG(VB_GENERAL, LOG_INFO, LOC + QString("Started worker %1, %2 running")
+        .arg(worker->processId()).arg(m_workers.size()));
+    return worker;
+}
+
+/// Read "PREVIEW <id> <ok>" lines, anything else is ignored.
+void PreviewWorkerPool::ReadResponses(QProcess *worker)
+{
+    {
+        QMutexLocker locker(&m_lock);
+        while (worker->canReadLine())
+        {
+            QList<QByteArray> fields = worker->readLine().trimmed().split('\t');
+            if (fields.size() != 3 || fields[0] != "PREVIEW")
+                continue;
+
+            RequestPtr request = m_busy.take(worker);
+            if (request && request->m_id == fields[1].toUInt())
+            {
+                request->m_ok = (fields[2] == "1");
+                request->m_done = true;
+                m_done.wakeAll();
+            }
+            m_idle.push_back(worker);
+            m_idleSince[worker] = MythDate::current();
+        }
+    }
+    Dispatch();
+}
+
+void PreviewWorkerPool::WorkerFinished(QProcess *worker)
+{
+    {
+        QMutexLocker locker(&m_lock);
+        LOG(VB_GENERAL, LOG_INFO, LOC + QString("Worker exited with %1")
+            .arg(worker->exitCode()));
+        m_workers.removeOne(worker);
+        m_idle.removeOne(worker);
+        m_idleSince.remove(worker);
+        RequestPtr request = m_busy.take(worker);
+        if (request)
+        {
+            request->m_done = true;
+            m_done.wakeAll();
+        }
+        worker->deleteLater();
+    }
+    Dispatch();
+}
+
+/// Kill the worker making a preview that has been given up on.
+void PreviewWorkerPool::Cancel(const RequestPtr &request)
+{
+    QMutexLocker locker(&m_lock);
+    for (auto it = m_busy.cbegin(); it != m_busy.cend(); ++it)
+    {
+        if (it.value() == request)
+        {
+            it.key()->kill();
+            break;
+        }
+    }
+}
+
+/// Fail every pending request, m_lock must be held.
+void PreviewWorkerPool::FailPending(void)
+{
+    for (const auto & request : std::as_const(m_pending))
+        request->m_done = true;
+    m_pending.clear();
+    m_done.wakeAll();
+}
+
+void PreviewWorkerPool::StopWorkers(void)
+{
+    QList<QProcess*> workers;
+    {
+        QMutexLocker locker(&m_lock);
+        FailPending();
+        workers = m_workers;
+    }
+    for (auto *worker : workers)
+    {
+        worker->closeWriteChannel();
+        if (!worker->waitForFinished(2000))
+            worker->kill();
+    }
+}
+
+#include "moc_previewworkerpool.cpp"
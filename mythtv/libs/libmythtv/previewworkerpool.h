@@ -0,0 +1,88 @@
+// -*- Mode: c++ -*-
+#ifndef PREVIEW_WORKER_POOL_H_
+#define PREVIEW_WORKER_POOL_H_
+
+// C++
+#include <chrono>
+#include <memory>
+
+// Qt
+#include <QDateTime>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QObject>
+#include <QSize>
+#include <QWaitCondition>
+
+class MThread;
+class ProgramInfo;
+class QProcess;
+
+/** \class PreviewWorkerPool
+ *  \brief Generates previews in long lived mythpreviewgen processes.
+ *
+ *  Starting mythpreviewgen for every preview pays for process start up,
+ *  a new database connection, player setup and codec probing each time.
+ *  This keeps a few "mythpreviewgen --server" processes running, feeds
+ *  them one request per line on stdin and reads the results back from
+ *  stdout. Previews are still made out of process, so a recording that
+ *  crashes the decoder only takes down one worker, which is replaced on
+ *  the next request.
+ *
+ *  The processes are owned by a dedicated thread with its own event loop.
+ *  Generate() may be called from any thread and blocks until the preview
+ *  is made, the worker fails or the request times out. Idle workers exit
+ *  on their own after a few minutes.
+ */
+class PreviewWorkerPool : public QObject
+{
+    Q_OBJECT
+
+  public:
+    static PreviewWorkerPool *GetPool(void);
+    static void Shutdown(void);
+
+    bool Generate(const ProgramInfo &pginfo, QSize size,
+                  std::chrono::seconds time, long long frame,
+                  const QString &outfile);
+
+  private:
+    struct Request
+    {
+        uint       m_id        { 0 };
+        QByteArray m_line;
+        bool       m_started   { false };
+        bool       m_done      { false };
+        bool       m_ok        { false };
+    };
+    using RequestPtr = std::shared_ptr<Request>;
+
+    PreviewWorkerPool();
+    ~PreviewWorkerPool() override = default;
+
+    void      Dispatch(void);
+    void      ReadResponses(QProcess *worker);
+    void      WorkerFinished(QProcess *worker);
+    void      Cancel(const RequestPtr &request);
+    void      StopWorkers(void);
+    QProcess *StartWorker(void);
+    void      FailPending(void);
+
+    static PreviewWorkerPool *s_pool;
+    static QMutex             s_poolLock;
+
+    MThread                   *m_thread     { nullptr };
+    int                        m_maxWorkers { 2 };
+
+    QMutex                     m_lock;
+    QWaitCondition             m_done;
+    uint                       m_nextId     { 0 };
+    QList<RequestPtr>          m_pending;
+    QList<QProcess*>           m_workers;
+    QList<QProcess*>           m_idle;
+    QHash<QProcess*,QDateTime> m_idleSince;
+    QHash<QProcess*,RequestPtr> m_busy;
+};
+
+#endif // PREVIEW_WORKER_POOL_H_
@@ -5,10 +5,12 @@
 
 // C++ headers
 #include <algorithm>
+#include <memory>
 #include <mutex>
 
 // Qt headers
 #include <QMap>
+#include <QSet>
 #include <QUrl>
 #include <QFile>
 #include <QFileInfo>
@@ -28,6 +30,7 @@
 #include "libmythbase/storagegroup.h"
 #include "libmythbase/stringutil.h"
 
+#include "compactprogramlist.h"
 #include "programinfo.h"
 #include "programinfoupdater.h"
 
@@ -5832,6 +5835,58 @@ static bool FromProgramQuery(const QString &sql, const MSqlBindings &bindings,
     return true;
 }
 
+/// \brief Create a ProgramInfo from a row selected by FromProgramQuery()
+static ProgramInfo *NewProgramFromQuery(const MSqlQuery &query,
+                                        const QString &sortTitle,
+                                        const QString &sortSubtitle,
+                                        const ProgramList &schedList)
+{
+    return new ProgramInfo(
+        query.value(3).toString(), // title
+        sortTitle,
+        query.value(4).toString(), // subtitle
+        sortSubtitle,
+        query.value(5).toString(), // description
+        query.value(26).toString(), // syndicatedepisodenumber
+        query.value(6).toString(), // category
+
+        query.value(0).toUInt(), // chanid
+        query.value(7).toString(), // channum
+        query.value(8).toString(), // chansign
+        query.value(9).toString(), // channame
+        query.value(12).toString(), // chanplaybackfilters
+
+        MythDate::as_utc(query.value(1).toDateTime()), // startts
+        MythDate::as_utc(query.value(2).toDateTime()), // endts
+        MythDate::as_utc(query.value(1).toDateTime()), // recstartts
+        MythDate::as_utc(query.value(2).toDateTime()), // recendts
+
+        query.value(13).toString(), // seriesid
+        query.value(14).toString(), // programid
+        string_to_myth_category_type(query.value(18).toString()), // catType
+
+        query.value(16).toFloat(), // stars
+        query.value(15).toUInt(), // year
+        query.value(27).toUInt(), // partnumber
+        query.value(28).toUInt(), // parttotal
+        query.value(17).toDate(), // originalAirDate
+        RecStatus::Type(query.value(21).toInt()), // recstatus
+        query.value(19).toUInt(), // recordid
+        RecordingType(query.value(20).toInt()), // rectype
+        query.value(22).toUInt(), // findid
+
+        query.value(11).toInt() == COMM_DETECT_COMMFREE, // commfree
+        query.value(10).toBool(), // repeat
+        query.value(23).toInt(), // videoprop
+        query.value(24).toInt(), // audioprop
+        query.value(25).toInt(), // subtitletypes
+        query.value(29).toUInt(), // season
+        query.value(30).toUInt(), // episode
+        query.value(31).toUInt(), // totalepisodes
+
+        schedList);
+}
+
 bool LoadFromProgram(ProgramList &destination, const QString &where,
                      const QString &groupBy, const QString &orderBy,
                      const MSqlBindings &bindings, const ProgramList &schedList)
@@ -5855,12 +5910,9 @@ bool LoadFromProgram(ProgramList &destination, const QString &where,
                            count);
 }
 
-bool LoadFromProgram(ProgramList &destination,
-                     const QString &sql, const MSqlBindings &bindings,
-                     const ProgramList &schedList, ProgGroupBy::Type groupBy)
+/// \brief Add the default WHERE and ORDER BY clauses if sql has none
+static QString ProgramQueryWithDefaults(const QString &sql)
 {
-    uint count = 0;
-
     QString queryStr = sql;
     // ------------------------------------------------------------------------
     // FIXME: Remove the following. These all make assumptions about the content
@@ -5889,10 +5941,17 @@ bool LoadFromProgram(ProgramList &destination,
             queryStr += "atsc_major_chan,atsc_minor_chan,channum,callsign ";
     }
 
-    // ------------------------------------------------------------------------
+    return queryStr;
+}
 
-    return LoadFromProgram(destination, queryStr, bindings, schedList, 0, 0,
-                           count, groupBy);
+bool LoadFromProgram(ProgramList &destination,
+                     const QString &sql, const MSqlBindings &bindings,
+                     const ProgramList &schedList, ProgGroupBy::Type groupBy)
+{
+    uint count = 0;
+
+    return LoadFromProgram(destination, ProgramQueryWithDefaults(sql),
+                           bindings, schedList, 0, 0, count, groupBy);
 }
 
 bool LoadFromProgram( ProgramList &destination,
@@ -5928,50 +5987,55 @@ bool LoadFromProgram( ProgramList &destination,
     while (query.next())
     {
         destination.push_back(
-            new ProgramInfo(
-                query.value(3).toString(), // title
-                QString(),                 // sortTitle
-                query.value(4).toString(), // subtitle
-                QString(),                 // sortSubtitle
-                query.value(5).toString(), // description
-                query.value(26).toString(), // syndicatedepisodenumber
-                query.value(6).toString(), // category
-
-                query.value(0).toUInt(), // chanid
-                query.value(7).toString(), // channum
-                query.value(8).toString(), // chansign
-                query.value(9).toString(), // channame
-                query.value(12).toString(), // chanplaybackfilters
-
-                MythDate::as_utc(query.value(1).toDateTime()), // startts
-                MythDate::as_utc(query.value(2).toDateTime()), // endts
-                MythDate::as_utc(query.value(1).toDateTime()), // recstartts
-                MythDate::as_utc(query.value(2).toDateTime()), // recendts
-
-                query.value(13).toString(), // seriesid
-                query.value(14).toString(), // programid
-                string_to_myth_category_type(query.value(18).toString()), // catType
-
-                query.value(16).toFloat(), // stars
-                query.value(15).toUInt(), // year
-                query.value(27).toUInt(), // partnumber
-                query.value(28).toUInt(), // parttotal
-                query.value(17).toDate(), // originalAirDate
-                RecStatus::Type(query.value(21).toInt()), // recstatus
-                query.value(19).toUInt(), // recordid
-                RecordingType(query.value(20).toInt()), // rectype
-                query.value(22).toUInt(), // findid
-
-                query.value(11).toInt() == COMM_DETECT_COMMFREE, // commfree
-                query.value(10).toBool(), // repeat
-                query.value(23).toInt(), // videoprop
-                query.value(24).toInt(), // audioprop
-                query.value(25).toInt(), // subtitletypes
-                query.value(29).toUInt(), // season
-                query.value(30).toUInt(), // episode
-                query.value(31).toUInt(), // totalepisodes
-
-                schedList));
+            NewProgramFromQuery(query, QString(), QString(), schedList));
+    }
+
+    return true;
+}
+
+/** \brief Load listings into a CompactProgramList.
+ *
+ *  The same as the ProgramList version, but each distinct title and
+ *  subtitle is only converted to its sort form once. Only the listings
+ *  that start when something in schedList does are built as a ProgramInfo,
+ *  to take what the scheduler has for them. The rest go straight into the
+ *  columns.
+ */
+bool LoadFromProgram(CompactProgramList &destination,
+                     const QString &sql, const MSqlBindings &bindings,
+                     const ProgramList &schedList, ProgGroupBy::Type groupBy)
+{
+    destination.clear();
+
+    uint count = 0;
+    MSqlQuery query(MSqlQuery::InitCon());
+    query.setForwardOnly(true);
+    if (!FromProgramQuery(ProgramQueryWithDefaults(sql), bindings, query,
+                          0, 0, count, groupBy))
+        return false;
+
+    if (query.size() > 0)
+        destination.reserve(query.size());
+
+    QSet<qint64> scheduled;
+    for (const auto *program : schedList)
+        scheduled.insert(program->GetScheduledStartTime().toMSecsSinceEpoch());
+
+    while (query.next())
+    {
+        QDateTime start = MythDate::as_utc(query.value(1).toDateTime());
+        if (!scheduled.contains(start.toMSecsSinceEpoch()))
+        {
+            destination.AppendListing(query);
+            continue;
+        }
+
+        std::unique_ptr<ProgramInfo> program {
+            NewProgramFromQuery(query,
+                                destination.SortTitle(query.value(3).toString()),
+                                destination.SortTitle(query.value(4).toString()),
+                                schedList) };
+        destination.Append(*program);
     }
 
     return true;
@@ -75,6 +75,7 @@ class MTV_PUBLIC ProgramInfo
 {
     friend int pginfo_init_statics(void);
     friend class TestRecordingExtender;
+    friend class CompactProgramList;
   private:
     // Must match the number of items in CategoryType below
     static const std::array<const QString,5> kCatName;
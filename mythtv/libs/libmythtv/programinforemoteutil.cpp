@@ -61,6 +61,61 @@ std::vector<ProgramInfo *> *RemoteGetRecordedList(int sort)
     return info;
 }
 
+/** \brief Get the recordings changed since a previous call.
+ *
+ *  Pass an epoch of 0 to start. On return epoch and generation identify the
+ *  state of the backend's recording list, to be passed in on the next call.
+ *
+ *  \return true if changed and deleted hold everything that has changed
+ *           since the given epoch and generation, false if the caller must
+ *           reload the whole list with RemoteGetRecordedList(). If the
+ *           backend could not be reached epoch is reset to 0.
+ */
+bool RemoteGetRecordedListChanges(qint64 &epoch, uint64_t &generation,
+                                  std::vector<ProgramInfo *> &changed,
+                                  std::vector<uint> &deleted)
+{
+    QStringList strlist(QString("QUERY_RECORDINGS_CHANGED %1 %2")
+                        .arg(epoch).arg(generation));
+
+    if (!gCoreContext->SendReceiveStringList(strlist) || strlist.size() < 3)
+    {
+        epoch = 0;
+        return false;
+    }
+
+    epoch = strlist[0].toLongLong();
+    generation = strlist[1].toULongLong();
+    if (strlist[2] != "DELTA")
+        return false;
+
+    QStringList::const_iterator it = strlist.cbegin() + 3;
+    if (it == strlist.cend())
+        return false;
+    int numdeleted = (it++)->toInt();
+    if (numdeleted < 0 || numdeleted >= strlist.cend() - it)
+    {
+        LOG(VB_GENERAL, LOG_ERR,
+            "RemoteGetRecordedListChanges() list size appears to be incorrect.");
+        return false;
+    }
+    for (int i = 0; i < numdeleted; i++)
+        deleted.push_back((it++)->toUInt());
+
+    int numchanged = (it++)->toInt();
+    if (numchanged < 0 ||
+        (numchanged * NUMPROGRAMLINES) > strlist.cend() - it)
+    {
+        LOG(VB_GENERAL, LOG_ERR,
+            "RemoteGetRecordedListChanges() list size appears to be incorrect.");
+        return false;
+    }
+    for (int i = 0; i < numchanged; i++)
+        changed.push_back(new ProgramInfo(it, strlist.cend()));
+
+    return true;
+}
+
 bool RemoteDeleteRecording(uint recordingID, bool forceMetadataDelete,
     bool forgetHistory)
 {
@@ -1,6 +1,7 @@
 #ifndef PROGRAMINFO_REMOTEUTIL_H
 #define PROGRAMINFO_REMOTEUTIL_H
 
+#include <cstdint>
 #include <vector>
 
 #include <QDateTime>
@@ -16,6 +17,9 @@ MTV_PUBLIC bool RemoteDeleteRecording( uint recordingID, bool forceMetadataDelet
 MTV_PUBLIC bool RemoteUndeleteRecording(uint recordingID);
 
 MTV_PUBLIC std::vector<ProgramInfo *> *RemoteGetRecordedList(int sort);
+MTV_PUBLIC bool RemoteGetRecordedListChanges(qint64 &epoch, uint64_t &generation,
+                                             std::vector<ProgramInfo *> &changed,
+                                             std::vector<uint> &deleted);
 MTV_PUBLIC void RemoteGetAllScheduledRecordings(std::vector<ProgramInfo *> &scheduledlist);
 MTV_PUBLIC void RemoteGetAllExpiringRecordings(std::vector<ProgramInfo *> &expiringlist);
 MTV_PUBLIC std::vector<ProgramInfo *> *RemoteGetConflictList(const ProgramInfo *pginfo);
@@ -8,6 +8,7 @@
 // POSIX headers
 #include <thread>
 #include <iostream>
+#include <cstring>
 #include <fcntl.h>
 #include <unistd.h>
 #include <algorithm>
@@ -120,6 +121,29 @@ bool ExternIO::Ready([[maybe_unused]] int fd,
 }
 
 int ExternIO::Read(QByteArray & buffer, int maxlen, std::chrono::milliseconds timeout)
+{
+    if (m_bufSize < maxlen)
+    {
+        m_bufSize = maxlen;
+        delete [] m_buffer;
+        m_buffer = new char[m_bufSize];
+    }
+
+    int len = Read(reinterpret_cast<uint8_t *>(m_buffer), maxlen, timeout);
+    if (len <= 0)
+        return 0;
+
+    buffer.append(m_buffer, len);
+
+    LOG(VB_RECORD, LOG_DEBUG,
+        QString("ExternIO::Read '%1' bytes, buffer size %2")
+        .arg(len).arg(buffer.size()));
+
+    return len;
+}
+
+/// Wait up to timeout for data and read it straight into buffer.
+int ExternIO::Read(uint8_t * buffer, int maxlen, std::chrono::milliseconds timeout)
 {
     if (Error())
     {
@@ -132,14 +156,7 @@ int ExternIO::Read(QByteArray & buffer, int maxlen, std::chrono::milliseconds ti
     if (!Ready(m_appOut, timeout, "data"))
         return 0;
 
-    if (m_bufSize < maxlen)
-    {
-        m_bufSize = maxlen;
-        delete [] m_buffer;
-        m_buffer = new char[m_bufSize];
-    }
-
-    int len = read(m_appOut, m_buffer, maxlen);
+    int len = read(m_appOut, buffer, maxlen);
 
     if (len < 0)
     {
@@ -164,21 +181,10 @@ int ExternIO::Read(QByteArray & buffer, int maxlen, std::chrono::milliseconds ti
             m_error = "Failed to read from External Recorder: " + ENO;
             LOG(VB_RECORD, LOG_ERR, m_error);
         }
-    }
-    else
-    {
-        m_errCnt = 0;
-    }
-
-    if (len == 0)
         return 0;
+    }
 
-    buffer.append(m_buffer, len);
-
-    LOG(VB_RECORD, LOG_DEBUG,
-        QString("ExternIO::Read '%1' bytes, buffer size %2")
-        .arg(len).arg(buffer.size()));
-
+    m_errCnt = 0;
     return len;
 }
 
@@ -389,6 +395,14 @@ void ExternIO::Fork(void)
             _exit(GENERIC_EXIT_PIPE_FAILURE);
         }
 
+#ifdef F_SETPIPE_SZ
+        if (fcntl(m_appOut, F_SETPIPE_SZ, kPipeSize) == -1)
+        {
+            LOG(VB_RECORD, LOG_INFO,
+                "ExternIO::Fork(): Unable to enlarge the data pipe: " + ENO);
+        }
+#endif
+
         LOG(VB_RECORD, LOG_INFO, "Spawned");
         return;
     }
@@ -589,22 +603,47 @@ int ExternalStreamHandler::StreamingCount(void) const
     return m_streamingCnt.loadAcquire();
 }
 
+QString ExternalStreamHandler::GetStatsString(const ExternalStreamStats & stats,
+                                              std::chrono::milliseconds elapsed)
+{
+    uint64_t rate = elapsed > 0ms ? stats.m_bytes * 1000 / elapsed.count() : 0;
+    uint64_t passes = std::max(stats.m_delivered, static_cast<uint64_t>(1));
+    return QString("%1 bytes (%2 kB/s) in %3 reads (max %4), "
+                   "%5 idle waits, %6 full ring, %7 bytes dropped, "
+                   "latency avg %8 us max %9 us, listeners avg %10 us, "
+                   "max gap %11 ms")
+        .arg(stats.m_bytes).arg(rate / 1024).arg(stats.m_reads)
+        .arg(stats.m_maxRead).arg(stats.m_idleWaits).arg(stats.m_fullWaits)
+        .arg(stats.m_dropped)
+        .arg(stats.m_totalDelay.count() / static_cast<int64_t>(passes))
+        .arg(stats.m_maxDelay.count())
+        .arg(stats.m_procTime.count() / static_cast<int64_t>(passes))
+        .arg(std::chrono::duration_cast<std::chrono::milliseconds>(stats.m_maxGap).count());
+}
+
 void ExternalStreamHandler::run(void)
 {
     QString    result;
     QString    ready_cmd;
-    QByteArray buffer;
-    int        sz = 0;
-    uint       len = 0;
-    uint       read_len = 0;
     uint       restart_cnt = 0;
     MythTimer  status_timer;
     MythTimer  nodata_timer;
+    MythTimer  stats_timer;
+    MythTimer  run_timer;
 
     bool       good_data = false;
     uint       data_proc_err = 0;
     uint       data_short_err = 0;
 
+    // Data is read straight into the ring and handed to the listeners from
+    // there. Only the partial TS packet left at the end is ever moved.
+    std::vector<uint8_t> ring(TOO_FAST_SIZE);
+    int        used = 0;
+
+    ExternalStreamStats stats;
+    std::chrono::microseconds last_data    { 0us };
+    std::chrono::microseconds pending_since { 0us };
+
     if (!m_io)
     {
         LOG(VB_GENERAL, LOG_ERR, LOC +
@@ -612,6 +651,8 @@ void ExternalStreamHandler::run(void)
     }
 
     status_timer.start();
+    stats_timer.start();
+    run_timer.start();
 
     RunProlog();
 
@@ -624,7 +665,6 @@ void ExternalStreamHandler::run(void)
     else
         ready_cmd = "XON";
 
-    uint remainder = 0;
     while (m_runningDesired && !m_bError)
     {
         if (!IsTSOpen())
@@ -642,106 +682,99 @@ void ExternalStreamHandler::run(void)
 
         UpdateFiltersFromStreamData();
 
-        if (!m_xon || m_pollMode)
+        if (stats_timer.elapsed() >= 5min)
         {
-            if (buffer.size() > TOO_FAST_SIZE)
-            {
-                LOG(VB_RECORD, LOG_WARNING, LOC +
-                    "Internal buffer too full to accept more data from "
-                    "external application.");
-            }
-            else
-            {
-                if (!ProcessCommand(ready_cmd, result))
-                {
-                    if (result.startsWith("ERR"))
-                    {
-                        LOG(VB_GENERAL, LOG_ERR, LOC +
-                            QString("Aborting: %1 -> %2")
-                            .arg(ready_cmd, result));
-                        m_bError = true;
-                        continue;
-                    }
-
-                    if (restart_cnt++)
-                        std::this_thread::sleep_for(20s);
-                    if (!RestartStream())
-                    {
-                        LOG(VB_RECORD, LOG_ERR, LOC +
-                            "Failed to restart stream.");
-                        m_bError = true;
-                    }
-                    continue;
-                }
-                m_xon = true;
-            }
+            LOG(VB_RECORD, LOG_DEBUG, LOC +
+                GetStatsString(stats, run_timer.elapsed()));
+            stats_timer.restart();
         }
 
-        if (m_xon)
+        // A full ring is not read from. The data backs up in the pipe and
+        // once that is full too, the recorder blocks on its write until
+        // the listeners catch up, so XON only has to be sent once.
+        int room = std::min(static_cast<int>(PACKET_SIZE),
+                            static_cast<int>(TOO_FAST_SIZE) - used);
+
+        if (room > 0 && (!m_xon || m_pollMode))
         {
-            if (status_timer.elapsed() >= 2s)
+            if (!ProcessCommand(ready_cmd, result))
             {
-                // Since we may never need to send the XOFF
-                // command, occationally check to see if the
-                // External recorder needs to report an issue.
-                if (Monitor())
+                if (result.startsWith("ERR"))
                 {
-                    if (restart_cnt++)
-                        std::this_thread::sleep_for(20s);
-                    if (!RestartStream())
-                    {
-                        LOG(VB_RECORD, LOG_ERR, LOC +
-                            "Failed to restart stream.");
-                        m_bError = true;
-                    }
+                    LOG(VB_GENERAL, LOG_ERR, LOC +
+                        QString("Aborting: %1 -> %2")
+                        .arg(ready_cmd, result));
+                    m_bError = true;
                     continue;
                 }
 
-                status_timer.restart();
+                if (restart_cnt++)
+                    std::this_thread::sleep_for(20s);
+                if (!RestartStream())
+                {
+                    LOG(VB_RECORD, LOG_ERR, LOC +
+                        "Failed to restart stream.");
+                    m_bError = true;
+                }
+                continue;
             }
+            m_xon = true;
+        }
 
-            if (buffer.size() > TOO_FAST_SIZE)
+        if (m_xon && status_timer.elapsed() >= 2s)
+        {
+            // Since XOFF is never sent, occasionally check to see if
+            // the External recorder needs to report an issue.
+            if (Monitor())
             {
-                if (!m_pollMode)
+                if (restart_cnt++)
+                    std::this_thread::sleep_for(20s);
+                if (!RestartStream())
                 {
-                    // Data is comming a little too fast, so XOFF
-                    // to give us time to process it.
-                    if (!ProcessCommand(QString("XOFF"), result))
-                    {
-                        if (result.startsWith("ERR"))
-                        {
-                            LOG(VB_GENERAL, LOG_ERR, LOC +
-                                QString("Aborting: XOFF -> %2")
-                                .arg(result));
-                            m_bError = true;
-                        }
-                    }
-                    m_xon = false;
+                    LOG(VB_RECORD, LOG_ERR, LOC +
+                        "Failed to restart stream.");
+                    m_bError = true;
                 }
+                continue;
             }
 
-            read_len = 0;
-            if (m_io != nullptr)
-            {
-                sz = PACKET_SIZE - remainder;
-                if (sz > 0)
-                    read_len = m_io->Read(buffer, sz, 100ms);
-            }
+            status_timer.restart();
         }
-        else
+
+        if (room <= 0)
         {
-            read_len = 0;
+            ++stats.m_fullWaits;
         }
-
-        if (read_len == 0)
+        else if (m_xon && m_io != nullptr)
         {
-            if (!nodata_timer.isRunning())
+            // Wakes as soon as there is data, the timeout only bounds how
+            // long a stop request or a silent recorder goes unnoticed
+            int read_len = m_io->Read(ring.data() + used, room, 100ms);
+            if (read_len > 0)
             {
-                nodata_timer.start();
+                auto now = nowAsDuration<std::chrono::microseconds>();
+                if (last_data > 0us)
+                    stats.m_maxGap = std::max(stats.m_maxGap, now - last_data);
+                last_data = now;
+                if (pending_since == 0us)
+                    pending_since = now;
+
+                used += read_len;
+                stats.m_bytes += read_len;
+                ++stats.m_reads;
+                stats.m_maxRead = std::max(stats.m_maxRead, read_len);
+
+                nodata_timer.stop();
+                restart_cnt = 0;
             }
             else
             {
-                if (nodata_timer.elapsed() >= 50s)
+                ++stats.m_idleWaits;
+                if (!nodata_timer.isRunning())
+                {
+                    nodata_timer.start();
+                }
+                else if (nodata_timer.elapsed() >= 50s)
                 {
                     LOG(VB_GENERAL, LOG_WARNING, LOC +
                         "No data for 50 seconds, Restarting stream.");
@@ -754,18 +787,11 @@ void ExternalStreamHandler::run(void)
                     nodata_timer.stop();
                     continue;
                 }
-            }
 
-            std::this_thread::sleep_for(50ms);
-
-            // HLS type streams may only produce data every ~10 seconds
-            if (nodata_timer.elapsed() < 12s && buffer.size() < TS_PACKET_SIZE)
-                continue;
-        }
-        else
-        {
-            nodata_timer.stop();
-            restart_cnt = 0;
+                // HLS type streams may only produce data every ~10 seconds
+                if (nodata_timer.elapsed() < 12s && used < TS_PACKET_SIZE)
+                    continue;
+            }
         }
 
         if (m_io == nullptr)
@@ -784,16 +810,13 @@ void ExternalStreamHandler::run(void)
             break;
         }
 
-        len = remainder = buffer.size();
-
-        if (len == 0)
+        if (used == 0)
             continue;
 
-        if (len < TS_PACKET_SIZE)
+        if (used < TS_PACKET_SIZE)
         {
             if (m_xon && data_short_err++ == 0)
                 LOG(VB_RECORD, LOG_INFO, LOC + "Waiting for a full TS packet.");
-            std::this_thread::sleep_for(50us);
             continue;
         }
         if (data_short_err)
@@ -807,28 +830,42 @@ void ExternalStreamHandler::run(void)
             data_short_err = 0;
         }
 
-        if (!m_streamLock.tryLock())
-            continue;
-
-        if (!m_listenerLock.tryLock())
-            continue;
+        // While there is room, keep reading when the listeners are busy.
+        // Once the ring is full, wait for them.
+        if (room > 0)
+        {
+            if (!m_streamLock.tryLock())
+                continue;
+            if (!m_listenerLock.tryLock())
+            {
+                m_streamLock.unlock();
+                continue;
+            }
+        }
+        else
+        {
+            m_streamLock.lock();
+            m_listenerLock.lock();
+        }
 
+        auto proc_start = nowAsDuration<std::chrono::microseconds>();
+        int remainder = used;
         for (auto sit = m_streamDataList.cbegin();
              sit != m_streamDataList.cend(); ++sit)
         {
-            remainder = sit.key()->ProcessData
-                        (reinterpret_cast<const uint8_t *>
-                         (buffer.constData()), buffer.size());
+            remainder = sit.key()->ProcessData(ring.data(), used);
         }
 
         m_listenerLock.unlock();
 
-        if (m_replay)
+        int consumed = used - remainder;
+        if (m_replay && consumed > 0)
         {
-            m_replayBuffer += buffer.left(len - remainder);
+            m_replayBuffer.append(reinterpret_cast<const char *>(ring.data()),
+                                  consumed);
             if (m_replayBuffer.size() > (50 * PACKET_SIZE))
             {
-                m_replayBuffer.remove(0, len - remainder);
+                m_replayBuffer.remove(0, consumed);
                 LOG(VB_RECORD, LOG_WARNING, LOC +
                     QString("Replay size truncated to %1 bytes")
                     .arg(m_replayBuffer.size()));
@@ -837,19 +874,36 @@ void ExternalStreamHandler::run(void)
 
         m_streamLock.unlock();
 
-        if (remainder == 0)
-        {
-            buffer.clear();
-            good_data = (len != 0U);
-        }
-        else if (len > remainder) // leftover bytes
+        auto proc_end = nowAsDuration<std::chrono::microseconds>();
+        stats.m_procTime += proc_end - proc_start;
+
+        if (consumed > 0)
         {
-            buffer.remove(0, len - remainder);
-            good_data = (len != 0U);
+            ++stats.m_delivered;
+            stats.m_totalDelay += proc_end - pending_since;
+            stats.m_maxDelay = std::max(stats.m_maxDelay,
+                                        proc_end - pending_since);
+            pending_since = 0us;
+
+            if (remainder > 0)
+                memmove(ring.data(), ring.data() + consumed, remainder);
+            used = remainder;
+            good_data = true;
         }
-        else if (len == remainder)
+        else
         {
             good_data = false;
+            if (room <= 0)
+            {
+                // Nothing takes this data, so drop it instead of stalling
+                // the recorder for good
+                LOG(VB_RECORD, LOG_WARNING, LOC +
+                    QString("Dropping %1 bytes no listener would take")
+                    .arg(used));
+                stats.m_dropped += used;
+                used = 0;
+                pending_since = 0us;
+            }
         }
 
         if (good_data)
@@ -877,6 +931,11 @@ void ExternalStreamHandler::run(void)
 
     LOG(VB_RECORD, LOG_INFO, LOC + "run(): " +
         QString("%1 shutdown").arg(m_bError ? "Error" : "Normal"));
+    if (stats.m_reads)
+    {
+        LOG(VB_RECORD, LOG_INFO, LOC + "run(): " +
+            GetStatsString(stats, run_timer.elapsed()));
+    }
 
     RemoveAllPIDFilters();
     SetRunning(false, true, false);
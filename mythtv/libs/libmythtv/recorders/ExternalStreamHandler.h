@@ -29,6 +29,9 @@ class ExternalChannel;
 class ExternIO
 {
     static constexpr uint8_t kMaxErrorCnt { 20 };
+    /// Data pipe capacity to ask for, bursts wait here while the stream
+    /// handler is busy and the recorder blocks when it is full
+    static constexpr int     kPipeSize    { 1024 * 1024 };
 
   public:
     ExternIO(const QString & app, const QStringList & args);
@@ -36,6 +39,7 @@ class ExternIO
 
     bool Ready(int fd, std::chrono::milliseconds timeout, const QString & what);
     int Read(QByteArray & buffer, int maxlen, std::chrono::milliseconds timeout = 2500ms);
+    int Read(uint8_t * buffer, int maxlen, std::chrono::milliseconds timeout);
     QByteArray GetStatus(std::chrono::milliseconds timeout = 2500ms);
     int Write(const QByteArray & buffer);
     bool Run(void);
@@ -64,6 +68,24 @@ class ExternIO
     int         m_errCnt  {0};
 };
 
+struct ExternalStreamStats
+{
+    uint64_t m_bytes      { 0 }; ///< Bytes read from the recorder
+    uint64_t m_reads      { 0 }; ///< Reads returning data
+    uint64_t m_idleWaits  { 0 }; ///< Waits for data that timed out
+    uint64_t m_fullWaits  { 0 }; ///< Passes with the ring full, not reading
+    uint64_t m_dropped    { 0 }; ///< Bytes no listener would take
+    uint64_t m_delivered  { 0 }; ///< Passes handing data to the listeners
+    int      m_maxRead    { 0 }; ///< Most bytes returned by one read
+    /// Time from reading data to the listeners having processed it
+    std::chrono::microseconds m_totalDelay { 0us };
+    std::chrono::microseconds m_maxDelay   { 0us };
+    /// Time spent in the listeners
+    std::chrono::microseconds m_procTime   { 0us };
+    /// Longest time between two reads returning data
+    std::chrono::microseconds m_maxGap     { 0us };
+};
+
 // Note : This class always uses a TS reader.
 
 class ExternalStreamHandler : public StreamHandler
@@ -126,6 +148,8 @@ class ExternalStreamHandler : public StreamHandler
 
   private:
     int  StreamingCount(void) const;
+    static QString GetStatsString(const ExternalStreamStats & stats,
+                                  std::chrono::milliseconds elapsed);
     bool SetAPIVersion(void);
     bool OpenApp(void);
     void CloseApp(void);
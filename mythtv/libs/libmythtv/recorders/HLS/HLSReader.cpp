@@ -1,7 +1,9 @@
 #include "HLSReader.h"
 
+#include <algorithm>
 #include <cstring>
 #include <thread>
+#include <utility>
 
 #include <QtGlobal>
 #include <QRegularExpression>
@@ -14,6 +16,7 @@
 #include "libmythbase/mythchrono.h"
 #include "libmythbase/mythlogging.h"
 
+#include "HLSSegmentPrefetch.h"
 #include "m3u.h"
 
 #define LOC QString("HLSReader[%1]: ").arg(m_inputId)
@@ -235,19 +238,25 @@ qint64 HLSReader::Read(uint8_t* buffer, qint64 maxlen)
 
     QMutexLocker lock(&m_bufLock);
 
-    qint64 len = m_buffer.size() < maxlen ? m_buffer.size() : maxlen;
+    qint64 len = std::min(m_bufferSize, maxlen);
     LOG(VB_RECORD, LOG_DEBUG, LOC + QString("Reading %1 of %2 bytes")
-        .arg(len).arg(m_buffer.size()));
+        .arg(len).arg(m_bufferSize));
 
-    memcpy(buffer, m_buffer.constData(), len);
-    if (len < m_buffer.size())
+    qint64 copied = 0;
+    while (copied < len)
     {
-        m_buffer.remove(0, len);
-    }
-    else
-    {
-        m_buffer.clear();
+        const QByteArray &segment = m_buffer.front();
+        qint64 count = std::min(len - copied, segment.size() - m_bufferOffset);
+        memcpy(buffer + copied, segment.constData() + m_bufferOffset, count);
+        copied += count;
+        m_bufferOffset += count;
+        if (m_bufferOffset >= segment.size())
+        {
+            m_buffer.pop_front();
+            m_bufferOffset = 0;
+        }
     }
+    m_bufferSize -= len;
 
     return len;
 }
@@ -722,13 +731,18 @@ bool HLSReader::ParseM3U8(const QByteArray& buffer, HLSRecStream* stream)
                         "playlist size: %3, queued: %4")
                 .arg(behind).arg(behind - max_behind)
                 .arg(m_playlistSize).arg(m_segments.size()));
+            EnableDebugging();
+            Iseg = m_segments.begin() + (behind - max_behind);
+
+            // Only the skipped segments, later ones are still needed
+            QList<QUrl> skipped_urls;
+            for (auto It = m_segments.begin(); It != Iseg; ++It)
+                skipped_urls.push_back((*It).Url());
             m_workerLock.lock();
             if (m_streamWorker)
-                m_streamWorker->CancelCurrentDownload();
+                m_streamWorker->CancelDownloads(skipped_urls);
             m_workerLock.unlock();
 
-            EnableDebugging();
-            Iseg = m_segments.begin() + (behind - max_behind);
             m_segments.erase(m_segments.begin(), Iseg);
             m_bandwidthCheck = (m_bitrateIndex == 0);
         }
@@ -897,7 +911,8 @@ void HLSReader::IncreaseBitrate(int progid)
     }
 }
 
-bool HLSReader::LoadSegments(MythSingleDownload& downloader)
+bool HLSReader::LoadSegments(MythSingleDownload& downloader,
+                             HLSSegmentPrefetch& prefetch)
 {
     LOG(VB_RECORD, LOG_DEBUG, LOC + "LoadSegment -- start");
 
@@ -919,6 +934,17 @@ bool HLSReader::LoadSegments(MythSingleDownload& downloader)
         }
 
         seg = m_segments.front();
+
+        // Fetch the next few segments in parallel, but only this one
+        // while throttled.
+        QList<QUrl> upcoming;
+        int depth = m_throttle ? 1 : prefetch.Depth();
+        for (int i = 0; i < depth && i < m_segments.size(); ++i)
+            upcoming.append(m_segments.at(i).Url());
+        prefetch.Retain(upcoming);
+        for (const auto & url : std::as_const(upcoming))
+            prefetch.Fetch(url);
+
         if (m_segments.size() > m_playlistSize)
         {
             LOG(VB_RECORD, (m_debug ? LOG_INFO : LOG_DEBUG), LOC +
@@ -946,7 +972,8 @@ bool HLSReader::LoadSegments(MythSingleDownload& downloader)
             return false;
         }
 
-        long throttle = DownloadSegmentData(downloader, hls, seg, m_playlistSize);
+        long throttle = DownloadSegmentData(downloader, prefetch, hls, seg,
+                                            m_playlistSize);
 
         m_seqLock.lock();
         if (throttle < 0)
@@ -1011,6 +1038,7 @@ uint HLSReader::PercentBuffered(void) const
 }
 
 int HLSReader::DownloadSegmentData(MythSingleDownload& downloader,
+                                   HLSSegmentPrefetch& prefetch,
                                    HLSRecStream* hls,
                                    HLSRecSegment& segment, int playlist_size)
 {
@@ -1044,7 +1072,7 @@ int HLSReader::DownloadSegmentData(MythSingleDownload& downloader,
     }
 
     QByteArray buffer;
-    auto start = nowAsDuration<std::chrono::milliseconds>();
+    std::chrono::milliseconds downloadduration { 0ms };
 
 #ifdef HLS_USE_MYTHDOWNLOADMANAGER // MythDownloadManager leaks memory
                                    // and can only handle six download at a time
@@ -1065,16 +1093,15 @@ int HLSReader::DownloadSegmentData(MythSingleDownload& downloader,
             return 0;
     }
 #else
-    if (!downloader.DownloadURL(segment.Url(), &buffer))
+    QString error;
+    if (!prefetch.Take(segment.Url(), buffer, downloadduration, error))
     {
         LOG(VB_RECORD, LOG_ERR, LOC + QString("%1 failed: %2")
-            .arg(segment.Sequence()).arg(downloader.ErrorString()));
+            .arg(segment.Sequence()).arg(error));
         return -1;
     }
 #endif
 
-    auto downloadduration = nowAsDuration<std::chrono::milliseconds>() - start;
-
     LOG(VB_RECORD, LOG_DEBUG, LOC +
         QString("Downloaded segment %1 %2").arg(segment.Sequence()).arg(segment.Url().toString()));
 
@@ -1096,16 +1123,17 @@ int HLSReader::DownloadSegmentData(MythSingleDownload& downloader,
     int64_t segment_len = buffer.size();
 
     m_bufLock.lock();
-    if (m_buffer.size() > segment_len * playlist_size)
+    if (m_bufferSize > segment_len * playlist_size)
     {
         LOG(VB_RECORD, LOG_WARNING, LOC +
             QString("streambuffer is not reading fast enough. "
-                    "buffer size %1").arg(m_buffer.size()));
+                    "buffer size %1").arg(m_bufferSize));
         EnableDebugging();
         if (++m_slowCnt > 15)
         {
             m_slowCnt = 15;
             m_fatal = true;
+            m_bufLock.unlock();
             return -1;
         }
     }
@@ -1114,16 +1142,25 @@ int HLSReader::DownloadSegmentData(MythSingleDownload& downloader,
         --m_slowCnt;
     }
 
-    if (m_buffer.size() >= segment_len * playlist_size * 2)
+    if (m_bufferSize >= segment_len * playlist_size * 2)
     {
+        // Drop the oldest whole segments
+        qint64 dropped = 0;
+        while (dropped < segment_len && !m_buffer.empty())
+        {
+            dropped += m_buffer.front().size() - m_bufferOffset;
+            m_buffer.pop_front();
+            m_bufferOffset = 0;
+        }
+        m_bufferSize -= dropped;
         LOG(VB_RECORD, LOG_WARNING, LOC +
             QString("streambuffer is not reading fast enough. "
-                    "buffer size %1.  Dropping %2 bytes")
-            .arg(m_buffer.size()).arg(segment_len));
-        m_buffer.remove(0, segment_len);
+                    "buffer size %1.  Dropped %2 bytes")
+            .arg(m_bufferSize + dropped).arg(dropped));
     }
 
-    m_buffer += buffer;
+    m_buffer.push_back(buffer);
+    m_bufferSize += segment_len;
     m_bufLock.unlock();
 
     if (hls->Bitrate() == 0 && segment.Duration() > 0s)
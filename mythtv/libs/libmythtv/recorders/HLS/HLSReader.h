@@ -1,6 +1,8 @@
 #ifndef HLS_READER_H
 #define HLS_READER_H
 
+#include <deque>
+
 #include <QByteArray>
 #include <QMap>
 #include <QMutex>
@@ -38,6 +40,7 @@
 #include "HLSStreamWorker.h"
 #include "HLSPlaylistWorker.h"
 
+class HLSSegmentPrefetch;
 
 class MTV_PUBLIC  HLSReader
 {
@@ -78,7 +81,8 @@ class MTV_PUBLIC  HLSReader
 
   protected:
     void Cancel(bool quiet = false);
-    bool LoadSegments(MythSingleDownload& downloader);
+    bool LoadSegments(MythSingleDownload& downloader,
+                      HLSSegmentPrefetch& prefetch);
     uint PercentBuffered(void) const;
     std::chrono::seconds TargetDuration(void) const
     { return (m_curstream ? m_curstream->TargetDuration() : 0s); }
@@ -95,8 +99,9 @@ class MTV_PUBLIC  HLSReader
     void IncreaseBitrate(int progid);
 
     // Downloading
-    int DownloadSegmentData(MythSingleDownload& downloader, HLSRecStream* hls,
-			    HLSRecSegment& segment, int playlist_size);
+    int DownloadSegmentData(MythSingleDownload& downloader,
+                            HLSSegmentPrefetch& prefetch, HLSRecStream* hls,
+                            HLSRecSegment& segment, int playlist_size);
 
     // Debug
     void EnableDebugging(void);
@@ -137,7 +142,11 @@ class MTV_PUBLIC  HLSReader
 
     // Downloading
     int                m_slowCnt        {0};
-    QByteArray         m_buffer;
+    // Downloaded segments waiting to be read. Read() copies straight out
+    // of them, so the remaining data is never moved.
+    std::deque<QByteArray> m_buffer;
+    qint64             m_bufferOffset   {0}; // already read from front()
+    qint64             m_bufferSize     {0}; // unread bytes
     QMutex             m_bufLock;
 
     // Log message
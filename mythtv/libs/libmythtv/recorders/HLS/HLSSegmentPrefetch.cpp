@@ -0,0 +1,257 @@
+#include "HLSSegmentPrefetch.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "libmythbase/mythlogging.h"
+#include "libmythbase/mythsingledownload.h"
+
+#define LOC QString("HLSPrefetch[%1]: ").arg(m_inputId)
+
+HLSSegmentFetchWorker::HLSSegmentFetchWorker(HLSSegmentPrefetch *parent)
+    : MThread("HLSFetch"),
+      m_parent(parent)
+{
+}
+
+HLSSegmentFetchWorker::~HLSSegmentFetchWorker(void)
+{
+    wait();
+}
+
+void HLSSegmentFetchWorker::CancelCurrentDownload(void)
+{
+    QMutexLocker locker(&m_downloaderLock);
+    if (m_downloader)
+        m_downloader->Cancel();
+}
+
+/// Cancel the download in progress if it is for \p url.
+void HLSSegmentFetchWorker::CancelDownload(const QUrl &url)
+{
+    QMutexLocker locker(&m_downloaderLock);
+    if (m_downloader && m_url == url)
+        m_downloader->Cancel();
+}
+
+void HLSSegmentFetchWorker::run(void)
+{
+    RunProlog();
+
+    m_downloaderLock.lock();
+    m_downloader = new MythSingleDownload;
+    m_downloaderLock.unlock();
+
+    while (HLSSegmentPrefetch::JobPtr job = m_parent->NextJob())
+    {
+        m_downloaderLock.lock();
+        m_url = job->m_url;
+        m_downloaderLock.unlock();
+
+        auto start = nowAsDuration<std::chrono::milliseconds>();
+        job->m_ok = m_downloader->DownloadURL(job->m_url, &job->m_data);
+        job->m_duration = nowAsDuration<std::chrono::milliseconds>() - start;
+
+        if (!job->m_ok)
+        {
+            job->m_error = m_downloader->ErrorString();
+
+            // Asking QNetworkAccessManager to redownload after a
+            // failure seems to result in another failure, even if the
+            // segment is now available.  So, create a new instance.
+            m_downloaderLock.lock();
+            delete m_downloader;
+            m_downloader = new MythSingleDownload;
+            m_downloaderLock.unlock();
+        }
+
+        m_downloaderLock.lock();
+        m_url.clear();
+        m_downloaderLock.unlock();
+
+        m_parent->Finished(job);
+    }
+
+    m_downloaderLock.lock();
+    delete m_downloader;
+    m_downloader = nullptr;
+    m_downloaderLock.unlock();
+
+    RunEpilog();
+}
+
+HLSSegmentPrefetch::HLSSegmentPrefetch(int inputId, int workers)
+    : m_inputId(inputId)
+{
+    for (int i = 0; i < std::max(workers, 1); ++i)
+    {
+        auto *worker = new HLSSegmentFetchWorker(this);
+        m_workers.push_back(worker);
+        worker->start();
+    }
+}
+
+HLSSegmentPrefetch::~HLSSegmentPrefetch(void)
+{
+    {
+        QMutexLocker locker(&m_lock);
+        m_stop = true;
+        m_jobCond.wakeAll();
+        m_doneCond.wakeAll();
+    }
+    CancelDownloads();
+    for (auto *worker : m_workers)
+        delete worker;
+    m_workers.clear();
+}
+
+/// Queue a segment to be downloaded, unless it already is.
+void HLSSegmentPrefetch::Fetch(const QUrl &url)
+{
+    QMutexLocker locker(&m_lock);
+    if (m_stop || FindJob(url))
+        return;
+
+    auto job = std::make_shared<Job>();
+    job->m_url = url;
+    m_jobs.push_back(job);
+    m_jobCond.wakeOne();
+}
+
+/** \brief Wait for a segment and remove it from the queue.
+ *
+ *  The segment is queued first if Fetch() wasn't called for it.
+ *  \param duration set to how long the download itself took.
+ *  \return false if the download failed or the prefetcher is stopping.
+ */
+bool HLSSegmentPrefetch::Take(const QUrl &url, QByteArray &buffer,
+                              std::chrono::milliseconds &duration,
+                              QString &error)
+{
+    QMutexLocker locker(&m_lock);
+
+    JobPtr job = FindJob(url);
+    if (!job && !m_stop)
+    {
+        job = std::make_shared<Job>();
+        job->m_url = url;
+        m_jobs.push_front(job);
+        m_jobCond.wakeOne();
+    }
+
+    while (job && !m_stop && !job->m_done)
+        m_doneCond.wait(&m_lock);
+
+    if (!job || !job->m_done)
+    {
+        error = "canceled";
+        return false;
+    }
+
+    m_jobs.removeOne(job);
+    buffer = job->m_data;
+    duration = job->m_duration;
+    error = job->m_error;
+    return job->m_ok;
+}
+
+/// Forget about any segment that isn't in \p urls.
+void HLSSegmentPrefetch::Retain(const QList<QUrl> &urls)
+{
+    QMutexLocker locker(&m_lock);
+    for (auto it = m_jobs.begin(); it != m_jobs.end(); )
+    {
+        if (urls.contains((*it)->m_url))
+        {
+            ++it;
+            continue;
+        }
+        LOG(VB_RECORD, LOG_DEBUG, LOC + QString("Dropping %1")
+            .arg((*it)->m_url.toString()));
+        it = m_jobs.erase(it);
+    }
+}
+
+/// Fail every segment that is queued or downloading.
+void HLSSegmentPrefetch::CancelDownloads(void)
+{
+    {
+        QMutexLocker locker(&m_lock);
+        for (const auto & job : std::as_const(m_jobs))
+        {
+            if (!job->m_started)
+            {
+                job->m_started = true;
+                job->m_done = true;
+                job->m_error = "canceled";
+            }
+        }
+        m_doneCond.wakeAll();
+    }
+    for (auto *worker : m_workers)
+        worker->CancelCurrentDownload();
+}
+
+/// Fail only the segments in \p urls, whether queued or downloading.
+void HLSSegmentPrefetch::CancelDownloads(const QList<QUrl> &urls)
+{
+    QList<QUrl> downloading;
+    {
+        QMutexLocker locker(&m_lock);
+        for (const auto & job : std::as_const(m_jobs))
+        {
+            if (job->m_done || !urls.contains(job->m_url))
+                continue;
+            if (job->m_started)
+            {
+                downloading.push_back(job->m_url);
+                continue;
+            }
+            job->m_started = true;
+            job->m_done = true;
+            job->m_error = "canceled";
+        }
+        m_doneCond.wakeAll();
+    }
+    for (const auto & url : std::as_const(downloading))
+    {
+        for (auto *worker : m_workers)
+            worker->CancelDownload(url);
+    }
+}
+
+HLSSegmentPrefetch::JobPtr HLSSegmentPrefetch::FindJob(const QUrl &url) const
+{
+    for (const auto & job : std::as_const(m_jobs))
+    {
+        if (job->m_url == url)
+            return job;
+    }
+    return nullptr;
+}
+
+/// Wait for the next segment to download, nullptr when stopping.
+HLSSegmentPrefetch::JobPtr HLSSegmentPrefetch::NextJob(void)
+{
+    QMutexLocker locker(&m_lock);
+    while (!m_stop)
+    {
+        for (const auto & job : std::as_const(m_jobs))
+        {
+            if (!job->m_started)
+            {
+                job->m_started = true;
+                return job;
+            }
+        }
+        m_jobCond.wait(&m_lock);
+    }
+    return nullptr;
+}
+
+void HLSSegmentPrefetch::Finished(const JobPtr &job)
+{
+    QMutexLocker locker(&m_lock);
+    job->m_done = true;
+    m_doneCond.wakeAll();
+}
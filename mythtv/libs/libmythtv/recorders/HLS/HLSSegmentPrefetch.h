@@ -0,0 +1,93 @@
+#ifndef HLS_SEGMENT_PREFETCH_H
+#define HLS_SEGMENT_PREFETCH_H
+
+#include <memory>
+#include <vector>
+
+#include <QByteArray>
+#include <QList>
+#include <QMutex>
+#include <QString>
+#include <QUrl>
+#include <QWaitCondition>
+
+#include "libmythbase/mthread.h"
+#include "libmythbase/mythchrono.h"
+
+class HLSSegmentPrefetch;
+class MythSingleDownload;
+
+/*
+  Downloads segments for HLSSegmentPrefetch. Each worker keeps its
+  MythSingleDownload, and so its QNetworkAccessManager, between
+  segments so that the HTTP connection to the server is kept alive.
+*/
+class HLSSegmentFetchWorker : public MThread
+{
+  public:
+    explicit HLSSegmentFetchWorker(HLSSegmentPrefetch *parent);
+    ~HLSSegmentFetchWorker(void) override;
+
+    void CancelCurrentDownload(void);
+    void CancelDownload(const QUrl &url);
+
+  protected:
+    void run() override; // MThread
+
+  private:
+    HLSSegmentPrefetch *m_parent     {nullptr};
+    MythSingleDownload *m_downloader {nullptr};
+    QUrl                m_url;
+    QMutex              m_downloaderLock;
+};
+
+/*
+  Fetches the next few segments of a stream in parallel, so that a slow
+  response for one segment doesn't hold up the ones after it. Segments
+  are handed back in the order HLSReader asks for them.
+*/
+class HLSSegmentPrefetch
+{
+    friend class HLSSegmentFetchWorker;
+
+  public:
+    explicit HLSSegmentPrefetch(int inputId, int workers = kDefaultWorkers);
+    ~HLSSegmentPrefetch(void);
+
+    int  Depth(void) const { return static_cast<int>(m_workers.size()); }
+    void Fetch(const QUrl &url);
+    bool Take(const QUrl &url, QByteArray &buffer,
+              std::chrono::milliseconds &duration, QString &error);
+    void Retain(const QList<QUrl> &urls);
+    void CancelDownloads(void);
+    void CancelDownloads(const QList<QUrl> &urls);
+
+    static constexpr int kDefaultWorkers { 3 };
+
+  private:
+    struct Job
+    {
+        QUrl                      m_url;
+        bool                      m_started  {false};
+        bool                      m_done     {false};
+        bool                      m_ok       {false};
+        QByteArray                m_data;
+        QString                   m_error;
+        std::chrono::milliseconds m_duration {0ms};
+    };
+    using JobPtr = std::shared_ptr<Job>;
+
+    JobPtr FindJob(const QUrl &url) const;
+    JobPtr NextJob(void);
+    void   Finished(const JobPtr &job);
+
+    int                                 m_inputId   {0};
+    bool                                m_stop      {false};
+    mutable QMutex                      m_lock;
+    QWaitCondition                      m_jobCond;
+    QWaitCondition                      m_doneCond;
+    QList<JobPtr>                       m_jobs;
+    std::vector<HLSSegmentFetchWorker*> m_workers;
+};
+
+#endif // HLS_SEGMENT_PREFETCH_H
@@ -4,6 +4,7 @@
 #include "libmythbase/mythsingledownload.h"
 
 #include "HLSReader.h"
+#include "HLSSegmentPrefetch.h"
 
 #define LOC QString("%1 worker: ").arg(m_parent->StreamURL().isEmpty() ? "Stream" : m_parent->StreamURL())
 
@@ -34,6 +35,16 @@ void HLSStreamWorker::CancelCurrentDownload(void)
     QMutexLocker locker(&m_downloaderLock);
     if (m_downloader)
         m_downloader->Cancel();
+    if (m_prefetch)
+        m_prefetch->CancelDownloads();
+}
+
+/// Cancel the segments in \p urls, leaving other segments downloading.
+void HLSStreamWorker::CancelDownloads(const QList<QUrl> &urls)
+{
+    QMutexLocker locker(&m_downloaderLock);
+    if (m_prefetch)
+        m_prefetch->CancelDownloads(urls);
 }
 
 void HLSStreamWorker::run(void)
@@ -43,6 +54,7 @@ void HLSStreamWorker::run(void)
 
     m_downloaderLock.lock();
     m_downloader = new MythSingleDownload;
+    m_prefetch = new HLSSegmentPrefetch(m_parent->m_inputId);
     m_downloaderLock.unlock();
 
     std::chrono::milliseconds delay = 0ms;
@@ -54,7 +66,7 @@ void HLSStreamWorker::run(void)
             LOG(VB_GENERAL, LOG_CRIT, LOC + "Fatal error detected");
             break;
         }
-        if (!m_parent->LoadSegments(*m_downloader))
+        if (!m_parent->LoadSegments(*m_downloader, *m_prefetch))
         {
             LOG(VB_RECORD, LOG_WARNING, LOC +
                 QString("download failed, retry #%1").arg(++retries));
@@ -97,9 +109,13 @@ void HLSStreamWorker::run(void)
         m_lock.unlock();
     }
 
+    m_downloaderLock.lock();
     m_downloader->Cancel();
     delete m_downloader;
     m_downloader = nullptr;
+    delete m_prefetch;
+    m_prefetch = nullptr;
+    m_downloaderLock.unlock();
 
     LOG(VB_RECORD, LOG_INFO, LOC + "run -- end");
     RunEpilog();
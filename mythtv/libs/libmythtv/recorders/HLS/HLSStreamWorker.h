@@ -1,12 +1,15 @@
 #ifndef HLS_SEGMENT_WORKER_H
 #define HLS_SEGMENT_WORKER_H
 
-#include <QWaitCondition>
+#include <QList>
 #include <QMutex>
+#include <QUrl>
+#include <QWaitCondition>
 
 #include "libmythbase/mthread.h"
 
 class HLSReader;
+class HLSSegmentPrefetch;
 class MythSingleDownload;
 
 class HLSStreamWorker : public MThread
@@ -17,6 +20,7 @@ class HLSStreamWorker : public MThread
 
     void Cancel(void);
     void CancelCurrentDownload(void);
+    void CancelDownloads(const QList<QUrl> &urls);
     void Wakeup(void) { QMutexLocker lock(&m_lock); m_waitCond.wakeAll(); }
 
   protected:
@@ -28,6 +32,7 @@ class HLSStreamWorker : public MThread
     // Class vars
     HLSReader          *m_parent     {nullptr};
     MythSingleDownload *m_downloader {nullptr};
+    HLSSegmentPrefetch *m_prefetch   {nullptr};
     bool                m_cancel     {false};
     bool                m_wokenup    {false};
     mutable QMutex      m_lock;
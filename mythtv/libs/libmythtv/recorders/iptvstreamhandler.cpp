@@ -20,6 +20,9 @@
 #include <QByteArray>
 #include <QHostInfo>
 
+// C++ headers
+#include <cstring>
+
 // MythTV headers
 #include "libmythbase/mythlogging.h"
 
@@ -329,19 +332,25 @@ void IPTVStreamHandler::run(void)
 
     if (!error)
     {
+        for (auto *helper : m_readHelpers)
+        {
+            if (helper)
+                helper->StartReceiver();
+        }
+
         // Enter event loop
         exec();
     }
 
-    // Clean up
+    // Clean up, the read helpers stop any receive threads first
     for (size_t i = 0; i < IPTV_SOCKET_COUNT; i++)
     {
         if (m_sockets[i])
         {
-            delete m_sockets[i];
-            m_sockets[i] = nullptr;
             delete m_readHelpers[i];
             m_readHelpers[i] = nullptr;
+            delete m_sockets[i];
+            m_sockets[i] = nullptr;
         }
     }
     delete m_buffer;
@@ -364,8 +373,51 @@ IPTVStreamHandlerReadHelper::IPTVStreamHandlerReadHelper(
     m_parent(p), m_socket(s), m_sender(p->m_sender[stream]),
     m_stream(stream)
 {
-    connect(m_socket, &QIODevice::readyRead,
-            this,     &IPTVStreamHandlerReadHelper::ReadPending);
+    // Where possible the socket is read in batches by a UDPReceiver
+    // thread, started with StartReceiver(), instead of from readyRead.
+    if (!UDPReceiver::IsAvailable())
+    {
+        connect(m_socket, &QIODevice::readyRead,
+                this,     &IPTVStreamHandlerReadHelper::ReadPending);
+    }
+}
+
+IPTVStreamHandlerReadHelper::~IPTVStreamHandlerReadHelper()
+{
+    delete m_receiver;
+    m_receiver = nullptr;
+}
+
+void IPTVStreamHandlerReadHelper::StartReceiver(void)
+{
+    if (!UDPReceiver::IsAvailable() || m_receiver ||
+        m_socket->socketDescriptor() < 0)
+    {
+        return;
+    }
+
+    m_receiver = new UDPReceiver(
+        QString("IPTVRecv%1").arg(m_stream), m_socket->socketDescriptor(),
+        m_stream, this, VERBOSE_LEVEL_CHECK(VB_RECORD, LOG_DEBUG));
+    m_receiver->SetExpectedSender(m_sender);
+    m_receiver->start();
+}
+
+void IPTVStreamHandlerReadHelper::DatagramsReceived(
+    uint stream, const UDPDatagram *datagrams, uint count)
+{
+    QMutexLocker locker(&m_parent->m_bufferLock);
+    for (uint i = 0; i < count; ++i)
+    {
+        UDPPacket packet(m_parent->m_buffer->GetEmptyPacket());
+        QByteArray &data = packet.GetDataReference();
+        data.resize(datagrams[i].m_size);
+        memcpy(data.data(), datagrams[i].m_data, datagrams[i].m_size);
+        if (0 == stream)
+            m_parent->m_buffer->PushDataPacket(packet);
+        else
+            m_parent->m_buffer->PushFECPacket(packet, stream - 1);
+    }
 }
 
 #define LOC_WH QString("IPTVSH(%1): ").arg(m_parent->m_device)
@@ -376,6 +428,7 @@ void IPTVStreamHandlerReadHelper::ReadPending(void)
     quint16 senderPort = 0;
     bool sender_null = m_sender.isNull();
 
+    QMutexLocker locker(&m_parent->m_bufferLock);
     if (0 == m_stream)
     {
         while (m_socket->hasPendingDatagrams())
@@ -447,15 +500,26 @@ void IPTVStreamHandlerWriteHelper::timerEvent(QTimerEvent* event)
         return;
     }
 
-    if (!m_parent->m_buffer->HasAvailablePacket())
+    // Take everything that is ready in one go, so the receive threads
+    // aren't held up while the listeners process the data.
+    QList<UDPPacket> packets;
+    {
+        QMutexLocker locker(&m_parent->m_bufferLock);
+        while (m_parent->m_buffer->HasAvailablePacket())
+            packets.push_back(m_parent->m_buffer->PopDataPacket());
+    }
+    if (packets.isEmpty())
         return;
 
-    while (!m_parent->m_useRtpStreaming)
+    for (const auto & udp_packet : std::as_const(packets))
     {
-        UDPPacket packet(m_parent->m_buffer->PopDataPacket());
+        if (m_parent->m_useRtpStreaming)
+            break;
+
+        UDPPacket packet(udp_packet);
 
         if (packet.GetDataReference().isEmpty())
-            break;
+            continue;
 
         int remainder = 0;
         {
@@ -476,26 +540,24 @@ void IPTVStreamHandlerWriteHelper::timerEvent(QTimerEvent* event)
                 QString("data_length = %1 remainder = %2")
                 .arg(packet.GetDataReference().size()).arg(remainder));
         }
-
-        m_parent->m_buffer->FreePacket(packet);
     }
 
-    while (m_parent->m_useRtpStreaming)
+    for (const auto & udp_packet : std::as_const(packets))
     {
-        RTPDataPacket packet(m_parent->m_buffer->PopDataPacket());
+        if (!m_parent->m_useRtpStreaming)
+            break;
+
+        RTPDataPacket packet(udp_packet);
 
         if (!packet.IsValid())
-            break;
+            continue;
 
         if (packet.GetPayloadType() == RTPDataPacket::kPayLoadTypeTS)
         {
             RTPTSDataPacket ts_packet(packet);
 
             if (!ts_packet.IsValid())
-            {
-                m_parent->m_buffer->FreePacket(packet);
                 continue;
-            }
 
             uint exp_seq_num = m_lastSequenceNumber + 1;
             uint seq_num = ts_packet.GetSequenceNumber();
@@ -536,8 +598,11 @@ void IPTVStreamHandlerWriteHelper::timerEvent(QTimerEvent* event)
                     .arg(ts_packet.GetTSDataSize()).arg(remainder));
             }
         }
-        m_parent->m_buffer->FreePacket(packet);
     }
+
+    QMutexLocker locker(&m_parent->m_bufferLock);
+    for (const auto & packet : std::as_const(packets))
+        m_parent->m_buffer->FreePacket(packet);
 }
 
 void IPTVStreamHandlerWriteHelper::SendRTCPReport(void)
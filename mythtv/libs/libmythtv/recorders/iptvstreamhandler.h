@@ -14,6 +14,7 @@
 #include <QNetworkAccessManager>
 
 #include "channelutil.h"
+#include "rtp/udpreceiver.h"
 #include "streamhandler.h"
 
 static constexpr size_t IPTV_SOCKET_COUNT   { 3 };
@@ -25,19 +26,27 @@ class MPEGStreamData;
 class PacketBuffer;
 class IPTVChannel;
 
-class IPTVStreamHandlerReadHelper : public QObject
+class IPTVStreamHandlerReadHelper : public QObject, public UDPReceiverCB
 {
     Q_OBJECT
 
   public:
     IPTVStreamHandlerReadHelper(IPTVStreamHandler *p, QUdpSocket *s, uint stream);
+    ~IPTVStreamHandlerReadHelper() override;
+
+    void StartReceiver(void);
+
+    // UDPReceiverCB
+    void DatagramsReceived(uint stream, const UDPDatagram *datagrams,
+                           uint count) override;
 
   public slots:
     void ReadPending(void);
 
   private:
-    IPTVStreamHandler *m_parent {nullptr};
-    QUdpSocket        *m_socket {nullptr};
+    IPTVStreamHandler *m_parent   {nullptr};
+    QUdpSocket        *m_socket   {nullptr};
+    UDPReceiver       *m_receiver {nullptr};
     QHostAddress       m_sender;
     uint               m_stream;
 };
@@ -104,6 +113,8 @@ class IPTVStreamHandler : public StreamHandler
     std::array<IPTVStreamHandlerReadHelper*,IPTV_SOCKET_COUNT> m_readHelpers {};
     std::array<QHostAddress,IPTV_SOCKET_COUNT>                 m_sender;
     IPTVStreamHandlerWriteHelper *m_writeHelper       {nullptr};
+    /// Protects m_buffer when it is filled from UDPReceiver threads
+    QMutex                        m_bufferLock;
     PacketBuffer                 *m_buffer            {nullptr};
 
     bool                          m_useRtpStreaming;
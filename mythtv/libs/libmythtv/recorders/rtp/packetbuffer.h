@@ -10,9 +10,11 @@
 #include <QList>
 #include <QMap>
 
+#include "libmythtv/mythtvexp.h"
+
 #include "udppacket.h"
 
-class PacketBuffer
+class MTV_PUBLIC PacketBuffer
 {
   public:
     explicit PacketBuffer(unsigned int bitrate);
@@ -3,21 +3,72 @@
  * Distributed as part of MythTV under GPL v2 and later.
  */
 
-#include "udppacket.h"
+#include "rtpdatapacket.h"
 
 #ifndef RTP_FEC_PACKET_H
 #define RTP_FEC_PACKET_H
 
 /** \brief RTP FEC Packet
+ *
+ *  SMPTE 2022-1 Forward Error Correction packet. After the RTP header
+ *  comes a 16 byte FEC header followed by the XOR of the payloads of
+ *  the protected media packets. The protected packets are the NA
+ *  packets with sequence numbers SNBase + (i * Offset). Column FEC
+ *  has Offset L and NA D, row FEC has Offset 1 and NA L.
  */
-class RTPFECPacket : public UDPPacket
+class RTPFECPacket : public RTPDataPacket
 {
   public:
-    explicit RTPFECPacket(const UDPPacket &o) : UDPPacket(o) { }
-    explicit RTPFECPacket(uint64_t key) : UDPPacket(key) { }
-    RTPFECPacket(void) : UDPPacket(0ULL) { }
+    explicit RTPFECPacket(const UDPPacket &o) : RTPDataPacket(o) { }
+    explicit RTPFECPacket(uint64_t key) : RTPDataPacket(key) { }
+    RTPFECPacket(void) : RTPDataPacket(0ULL) { }
 
-    // TODO
+    static constexpr int kFECHeaderSize { 16 };
+
+    bool IsValid(void) const override // UDPPacket
+    {
+        return RTPDataPacket::IsValid() &&
+            (m_data.size() >= static_cast<int>(m_off) + kFECHeaderSize);
+    }
+
+    /// Low 16 bits of the first protected sequence number
+    uint GetSNBase(void) const
+    {
+        return qFromBigEndian(*reinterpret_cast<const uint16_t*>(FECHeader()));
+    }
+
+    uint GetLengthRecovery(void) const
+    {
+        return qFromBigEndian(*reinterpret_cast<const uint16_t*>(FECHeader()+2));
+    }
+
+    uint GetPTRecovery(void) const { return FECHeader()[4] & 0x7f; }
+
+    uint GetTSRecovery(void) const
+    {
+        return qFromBigEndian(*reinterpret_cast<const uint32_t*>(FECHeader()+8));
+    }
+
+    /// True for row FEC, false for column FEC
+    bool IsRow(void) const { return ((FECHeader()[12] >> 6) & 0x1) != 0; }
+    uint GetOffset(void) const { return FECHeader()[13]; }
+    uint GetNA(void) const { return FECHeader()[14]; }
+
+    const unsigned char *GetFECPayload(void) const
+    {
+        return FECHeader() + kFECHeaderSize;
+    }
+
+    int GetFECPayloadSize(void) const
+    {
+        return m_data.size() - m_off - kFECHeaderSize;
+    }
+
+  private:
+    const unsigned char *FECHeader(void) const
+    {
+        return reinterpret_cast<const unsigned char*>(m_data.data()) + m_off;
+    }
 };
 
 #endif // RTP_FEC_PACKET_H
@@ -5,67 +5,340 @@
  */
 
 #include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "libmythbase/mythlogging.h"
 
 #include "rtppacketbuffer.h"
 #include "rtpdatapacket.h"
 #include "rtpfecpacket.h"
 
+#define LOC QString("RTPPacketBuffer: ")
+
+/// How many packets to release before the reorder depth is reconsidered
+static constexpr uint kAdaptInterval { 4096 };
+/// Size of an RTP header without CSRCs or extensions, as SMPTE 2022-1 uses
+static constexpr int  kRTPHeaderSize { 12 };
+
+RTPPacketBuffer::~RTPPacketBuffer()
+{
+    if (m_stats.m_received)
+        LOG(VB_RECORD, LOG_INFO, LOC + GetStatsString());
+}
+
+QString RTPPacketBuffer::GetStatsString(void) const
+{
+    return QString("%1 packets, %2 duplicate, %3 late, %4 recovered, "
+                   "%5 unrecoverable, %6 FEC packets, max reorder %7, "
+                   "max depth %8")
+        .arg(m_stats.m_received).arg(m_stats.m_duplicates)
+        .arg(m_stats.m_late).arg(m_stats.m_recovered)
+        .arg(m_stats.m_unrecoverable).arg(m_stats.m_fecReceived)
+        .arg(m_stats.m_maxReorder).arg(m_stats.m_maxDepth);
+}
+
+/// Extends a 16 bit sequence number to the one closest to the newest packet
+uint64_t RTPPacketBuffer::ExtendSequence(uint seq) const
+{
+    // Start one cycle in so that packets from before the first can be placed
+    if (!m_started)
+        return (1ULL << 16) + (seq & 0xFFFF);
+
+    uint64_t ext = (m_highestSequence & ~0xFFFFULL) | (seq & 0xFFFF);
+    if (ext + (1ULL << 15) < m_highestSequence)
+        ext += 1ULL << 16;
+    else if (ext > m_highestSequence + (1ULL << 15) && ext >= (1ULL << 16))
+        ext -= 1ULL << 16;
+    return ext;
+}
+
 void RTPPacketBuffer::PushDataPacket(const UDPPacket &udp_packet)
 {
     RTPDataPacket packet(udp_packet);
 
-    uint key = packet.GetSequenceNumber();
+    if (!packet.IsValid())
+    {
+        FreePacket(packet);
+        return;
+    }
 
-    bool large_was_seen_recently = m_largeSequenceNumberSeenRecently > 0;
-    m_largeSequenceNumberSeenRecently = 
-        (key > (1U<<15)) ? 500 : m_largeSequenceNumberSeenRecently - 1;
-    m_largeSequenceNumberSeenRecently =
-        std::max(m_largeSequenceNumberSeenRecently, 0);
+    m_stats.m_received++;
+    uint64_t seq = ExtendSequence(packet.GetSequenceNumber());
 
-    if (m_largeSequenceNumberSeenRecently > 0)
+    if (!m_started)
     {
-        if (key < 500) 
-            key += 1ULL<<16;
+        m_started = true;
+        m_nextSequence = m_highestSequence = m_retainFrom = seq;
     }
-    else if (large_was_seen_recently)
+    else if ((seq + kRingSize <= m_nextSequence) ||
+             (seq >= m_nextSequence + kRingSize))
     {
-        m_currentSequence += 1ULL<<16;
+        // A jump in the sequence, probably a restarted stream
+        LOG(VB_RECORD, LOG_INFO, LOC +
+            QString("Sequence jumped from %1 to %2, flushing")
+            .arg(m_highestSequence & 0xFFFF).arg(seq & 0xFFFF));
+        Release(true);
+        m_nextSequence = m_highestSequence = m_retainFrom = seq;
+    }
+    else if (seq < m_nextSequence)
+    {
+        m_stats.m_late++;
+        FreePacket(packet);
+        return;
+    }
+    else if (seq >= m_retainFrom + kRingSize)
+    {
+        // Make room in the ring, the oldest released packets go first
+        DropRetained(seq - kRingSize + 1);
     }
 
-    key += m_currentSequence;
-
-/*
-    LOG(VB_RECORD, LOG_DEBUG, QString("Pushing %1 as %2 (lr %3)")
-        .arg(packet.GetSequenceNumber()).arg(key)
-        .arg(m_largeSequenceNumberSeenRecently));
-*/
-
-    m_unorderedPackets[key] = packet;
-
-    // TODO pushing packets onto the ordered list should be based on
-    // the bitrate and the M+N of the FEC.. but for now...
-    const int kHighWaterMark = 500;
-    const int kLowWaterMark  = 100;
-    if (m_unorderedPackets.size() > kHighWaterMark)
+    if (seq > m_highestSequence)
     {
-        while (m_unorderedPackets.size() > kLowWaterMark)
+        m_highestSequence = seq;
+    }
+    else if (seq < m_highestSequence)
+    {
+        uint reorder = m_highestSequence - seq;
+        m_stats.m_maxReorder = std::max(m_stats.m_maxReorder, reorder);
+        if (reorder > m_reorder)
         {
-            uint64_t key2 = m_unorderedPackets.firstKey();
-            RTPDataPacket packet2 = m_unorderedPackets.take(key2);
-/*
-            LOG(VB_RECORD, LOG_DEBUG, QString("Popping %1 as %2")
-                .arg(packet2.GetSequenceNumber()).arg(key2));
-*/
-            m_availablePackets.push_back(packet2);
+            m_reorder = reorder;
+            UpdateDepth();
         }
     }
+
+    Slot &slot = SlotFor(seq);
+    if (slot.m_used)
+    {
+        m_stats.m_duplicates++;
+        FreePacket(packet);
+        return;
+    }
+    slot.m_packet = packet;
+    slot.m_used = true;
+
+    Recover(seq);
+    Release(false);
 }
 
 void RTPPacketBuffer::PushFECPacket(
     const UDPPacket &packet,
     [[maybe_unused]] uint fec_stream_num)
 {
-    // TODO IMPLEMENT
-    // for now just free the packet for immediate reuse
-    FreePacket(packet);
+    RTPFECPacket fec(packet);
+
+    if (!fec.IsValid() || !m_started)
+    {
+        FreePacket(packet);
+        return;
+    }
+    m_stats.m_fecReceived++;
+
+    FECEntry entry;
+    entry.m_packet = fec;
+    entry.m_base   = ExtendSequence(fec.GetSNBase());
+    entry.m_offset = fec.GetOffset();
+    entry.m_count  = fec.GetNA();
+
+    if (!entry.m_offset || !entry.m_count ||
+        entry.Last() - entry.m_base >= kMaxDepth || entry.Last() < m_nextSequence)
+    {
+        FreePacket(packet);
+        return;
+    }
+
+    // Hold back enough packets for a whole matrix plus the time it
+    // takes the FEC for it to arrive.
+    uint span = 2 * static_cast<uint>(entry.Last() - entry.m_base + 1);
+    if (span > m_fecDepth)
+    {
+        m_fecDepth = span;
+        UpdateDepth();
+        LOG(VB_RECORD, LOG_INFO, LOC +
+            QString("%1 FEC protecting %2 packets, buffering %3 packets")
+            .arg(fec.IsRow() ? "Row" : "Column").arg(entry.m_count)
+            .arg(m_depth));
+    }
+
+    m_fecPackets.push_back(entry);
+
+    uint64_t seq = 0;
+    if (RecoverWith(entry, seq))
+        Recover(seq);
+}
+
+void RTPPacketBuffer::UpdateDepth(void)
+{
+    uint depth = std::max({kMinDepth, 2 * m_reorder, 2 * m_lastReorder,
+                           m_fecDepth});
+    m_depth = std::min(depth, kMaxDepth);
+    m_stats.m_maxDepth = std::max(m_stats.m_maxDepth, m_depth);
+}
+
+/// Moves packets that are old enough to m_availablePackets, or all
+/// packets when flushing.
+void RTPPacketBuffer::Release(bool flush)
+{
+    while (m_nextSequence <= m_highestSequence &&
+           (flush || (m_highestSequence - m_nextSequence >= m_depth)))
+    {
+        // Released packets stay in the ring while an FEC packet may
+        // need them to rebuild a later one.
+        Slot &slot = SlotFor(m_nextSequence);
+        if (slot.m_used)
+        {
+            m_availablePackets.push_back(slot.m_packet);
+        }
+        else if (!flush)
+        {
+            m_stats.m_unrecoverable++;
+            LOG(VB_RECORD, LOG_DEBUG, LOC + QString("Lost packet %1")
+                .arg(m_nextSequence & 0xFFFF));
+        }
+        m_nextSequence++;
+
+        // Let the depth shrink again once reordering has calmed down
+        if (++m_sinceAdapt >= kAdaptInterval)
+        {
+            m_lastReorder = m_reorder;
+            m_reorder = 0;
+            m_sinceAdapt = 0;
+            UpdateDepth();
+        }
+    }
+
+    // Drop FEC packets that only protect packets already released, and
+    // the released packets no remaining FEC packet protects.
+    uint64_t retain = m_nextSequence;
+    for (auto it = m_fecPackets.begin(); it != m_fecPackets.end(); )
+    {
+        if (flush || it->Last() < m_nextSequence)
+        {
+            FreePacket(it->m_packet);
+            it = m_fecPackets.erase(it);
+        }
+        else
+        {
+            retain = std::min(retain, it->m_base);
+            ++it;
+        }
+    }
+    DropRetained(retain);
+}
+
+/// Forgets the released packets before \p seq.
+void RTPPacketBuffer::DropRetained(uint64_t seq)
+{
+    for (; m_retainFrom < seq; ++m_retainFrom)
+        SlotFor(m_retainFrom) = Slot();
+}
+
+/** \brief Rebuilds what the FEC packets protecting \p seq can now recover.
+ *
+ *  Called when \p seq arrives or is rebuilt. Every rebuilt packet is
+ *  tried in turn, so a packet missing from both a row and a column can
+ *  be recovered once the other loss in its row or column is repaired.
+ */
+void RTPPacketBuffer::Recover(uint64_t seq)
+{
+    std::vector<uint64_t> present { seq };
+    while (!present.empty())
+    {
+        uint64_t p = present.back();
+        present.pop_back();
+        for (const auto & fec : std::as_const(m_fecPackets))
+        {
+            uint64_t rebuilt = 0;
+            if (fec.Protects(p) && RecoverWith(fec, rebuilt))
+                present.push_back(rebuilt);
+        }
+    }
+}
+
+/** \brief Rebuilds the one packet an FEC packet protects that is missing.
+ *  \param seq Set to the sequence number of the rebuilt packet.
+ *  \return true if a packet was rebuilt.
+ */
+bool RTPPacketBuffer::RecoverWith(const FECEntry &fec, uint64_t &seq)
+{
+    uint missing = 0;
+    for (uint i = 0; i < fec.m_count; ++i)
+    {
+        uint64_t p = fec.m_base + (static_cast<uint64_t>(i) * fec.m_offset);
+        if (p < m_retainFrom)
+            return false;
+        if (!SlotFor(p).m_used)
+        {
+            seq = p;
+            if (++missing > 1)
+                return false;
+        }
+    }
+
+    // Packets beyond the newest one may simply not have been sent yet
+    return (missing == 1) && (seq <= m_highestSequence) && Rebuild(seq, fec);
+}
+
+/// Rebuilds \p seq from an FEC packet when all the others it protects are here.
+bool RTPPacketBuffer::Rebuild(uint64_t seq, const FECEntry &fec)
+{
+    const RTPFECPacket &fec_packet = fec.m_packet;
+    int payload_size = fec_packet.GetFECPayloadSize();
+    uint length = fec_packet.GetLengthRecovery();
+    uint pt     = fec_packet.GetPTRecovery();
+    uint ts     = fec_packet.GetTSRecovery();
+    uint ssrc   = 0;
+
+    UDPPacket recovered(GetEmptyPacket());
+    QByteArray &data = recovered.GetDataReference();
+    data.resize(kRTPHeaderSize + payload_size);
+    auto *out = reinterpret_cast<unsigned char*>(data.data());
+    memcpy(out + kRTPHeaderSize, fec_packet.GetFECPayload(), payload_size);
+
+    for (uint i = 0; i < fec.m_count; ++i)
+    {
+        uint64_t p = fec.m_base + (static_cast<uint64_t>(i) * fec.m_offset);
+        if (p == seq)
+            continue;
+
+        const RTPDataPacket &packet = SlotFor(p).m_packet;
+        const QByteArray &pdata = packet.GetDataReference();
+        const auto *in = reinterpret_cast<const unsigned char*>(pdata.constData());
+        int size = pdata.size() - kRTPHeaderSize;
+        pt   ^= packet.GetPayloadType();
+        ts   ^= packet.GetTimeStamp();
+        ssrc  = packet.GetSynchronizationSource();
+        length ^= static_cast<uint>(size);
+
+        int common = std::min(size, payload_size);
+        for (int j = 0; j < common; ++j)
+            out[kRTPHeaderSize + j] ^= in[kRTPHeaderSize + j];
+    }
+
+    if (static_cast<int>(length) > payload_size)
+    {
+        FreePacket(recovered);
+        return false;
+    }
+
+    data.resize(kRTPHeaderSize + length);
+    out = reinterpret_cast<unsigned char*>(data.data());
+    out[0] = 0x80; // version 2, no padding, extension or CSRCs
+    out[1] = pt & 0x7f;
+    qToBigEndian(static_cast<uint16_t>(seq & 0xFFFF), out + 2);
+    qToBigEndian(static_cast<uint32_t>(ts), out + 4);
+    qToBigEndian(static_cast<uint32_t>(ssrc), out + 8);
+
+    Slot &slot = SlotFor(seq);
+    slot.m_packet = RTPDataPacket(recovered);
+    slot.m_used = true;
+    // A packet already released as lost only helps rebuild others
+    if (seq >= m_nextSequence)
+        m_stats.m_recovered++;
+
+    LOG(VB_RECORD, LOG_DEBUG, LOC + QString("Recovered packet %1 from %2 FEC")
+        .arg(seq & 0xFFFF).arg(fec_packet.IsRow() ? "row" : "column"));
+    return true;
 }
@@ -7,16 +7,35 @@
 #ifndef RTP_PACKET_BUFFER_H
 #define RTP_PACKET_BUFFER_H
 
-#include <QMap>
+#include <array>
+
+#include <QList>
+#include <QString>
+
+#include "libmythtv/mythtvexp.h"
 
 #include "rtpdatapacket.h"
+#include "rtpfecpacket.h"
 #include "packetbuffer.h"
 
-class RTPPacketBuffer : public PacketBuffer
+/** \class RTPPacketBuffer
+ *  \brief Jitter buffer for RTP streams with SMPTE 2022-1 FEC recovery.
+ *
+ *  Packets are held in a ring indexed by their extended sequence number
+ *  and released in order once they are m_depth packets behind the newest
+ *  one. The depth follows the reordering actually seen on the stream,
+ *  and when FEC is present it is large enough to hold a whole FEC matrix.
+ *  Whenever a data or FEC packet arrives, a missing packet is rebuilt from
+ *  a row or column FEC packet if all the other packets that FEC packet
+ *  protects are here. Released packets are kept in the ring until no FEC
+ *  packet that protects them is left.
+ */
+class MTV_PUBLIC RTPPacketBuffer : public PacketBuffer
 {
   public:
     explicit RTPPacketBuffer(unsigned int bitrate) :
         PacketBuffer(bitrate) {}
+    ~RTPPacketBuffer() override;
 
     /// Adds RFC 3550 RTP data packet
     void PushDataPacket(const UDPPacket &udp_packet) override; // PacketBuffer
@@ -24,12 +43,74 @@ class RTPPacketBuffer : public PacketBuffer
     /// Adds SMPTE 2022 Forward Error Correction Stream packet
     void PushFECPacket(const UDPPacket &packet, unsigned int fec_stream_num) override; // PacketBuffer
 
+    struct Stats
+    {
+        uint64_t m_received      { 0 };
+        uint64_t m_duplicates    { 0 };
+        uint64_t m_late          { 0 }; ///< Arrived after it was released
+        uint64_t m_recovered     { 0 }; ///< Rebuilt from FEC
+        uint64_t m_unrecoverable { 0 }; ///< Missing and not rebuilt
+        uint64_t m_fecReceived   { 0 };
+        uint     m_maxReorder    { 0 };
+        uint     m_maxDepth      { 0 };
+    };
+
+    Stats   GetStats(void) const { return m_stats; }
+    QString GetStatsString(void) const;
+
+    static constexpr uint kRingSize { 2048 };
+    static constexpr uint kMinDepth {   32 };
+    static constexpr uint kMaxDepth {  768 };
+
   private:
-    int      m_largeSequenceNumberSeenRecently { 0   };
-    uint64_t m_currentSequence                 { 0LL };
+    struct Slot
+    {
+        RTPDataPacket m_packet;
+        bool          m_used     { false };
+    };
+
+    struct FECEntry
+    {
+        RTPFECPacket  m_packet;
+        uint64_t      m_base     { 0 };
+        uint          m_offset   { 0 };
+        uint          m_count    { 0 };
+
+        uint64_t Last(void) const { return m_base + ((m_count - 1ULL) * m_offset); }
+        bool Protects(uint64_t seq) const
+        {
+            return seq >= m_base && seq <= Last() &&
+                ((seq - m_base) % m_offset) == 0;
+        }
+    };
+
+    uint64_t ExtendSequence(uint seq) const;
+    void     Release(bool flush);
+    void     DropRetained(uint64_t seq);
+    void     Recover(uint64_t seq);
+    bool     RecoverWith(const FECEntry &fec, uint64_t &seq);
+    bool     Rebuild(uint64_t seq, const FECEntry &fec);
+    void     UpdateDepth(void);
+    Slot    &SlotFor(uint64_t seq) { return m_ring[seq % kRingSize]; }
+
+    bool     m_started          { false };
+    /// Next sequence number to release
+    uint64_t m_nextSequence     { 0 };
+    /// Highest sequence number received
+    uint64_t m_highestSequence  { 0 };
+    /// Oldest released packet still kept for FEC recovery
+    uint64_t m_retainFrom       { 0 };
+    uint     m_depth            { kMinDepth };
+    /// Largest reordering seen in the current and previous intervals
+    uint     m_reorder          { 0 };
+    uint     m_lastReorder      { 0 };
+    uint     m_sinceAdapt       { 0 };
+    /// Depth needed to hold the largest FEC matrix seen
+    uint     m_fecDepth         { 0 };
 
-    /// The key is the RTP sequence number + sequence if applicable
-    QMap<uint64_t, RTPDataPacket> m_unorderedPackets;
+    std::array<Slot, kRingSize> m_ring;
+    QList<FECEntry>             m_fecPackets;
+    Stats                       m_stats;
 };
 
 #endif // RTP_PACKET_BUFFER_H
@@ -0,0 +1,259 @@
+/* -*- Mode: c++ -*-
+ * UDPReceiver
+ * Distributed as part of MythTV under GPL v2 and later.
+ */
+
+#include <QtGlobal>
+#if QT_VERSION >= QT_VERSION_CHECK(6,5,0)
+#include <QtSystemDetection>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#ifdef Q_OS_LINUX
+#include <poll.h>
+#include <sys/socket.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#endif
+
+#include <QElapsedTimer>
+
+// MythTV headers
+#include "libmythbase/mythlogging.h"
+#include "udpreceiver.h"
+
+#define LOC QString("UDPReceiver[%1](%2): ").arg(m_stream).arg(objectName())
+
+// How often kernel buffer overruns are reported
+static constexpr std::chrono::seconds kOverrunLogInterval { 10s };
+
+UDPReceiver::UDPReceiver(const QString &name, int fd, uint stream,
+                         UDPReceiverCB *cb, bool timestamps)
+    : MThread(name), m_fd(fd), m_stream(stream), m_callback(cb),
+      m_timestamps(timestamps)
+{
+}
+
+UDPReceiver::~UDPReceiver()
+{
+    Stop();
+}
+
+bool UDPReceiver::IsAvailable(void)
+{
+#ifdef Q_OS_LINUX
+    return true;
+#else
+    return false;
+#endif
+}
+
+void UDPReceiver::Stop(void)
+{
+    m_running = false;
+    wait();
+}
+
+UDPReceiverStats UDPReceiver::GetStats(void) const
+{
+    QMutexLocker locker(&m_statsLock);
+    return m_stats;
+}
+
+QString UDPReceiver::GetStatsString(void) const
+{
+    UDPReceiverStats stats = GetStats();
+    QString msg = QString("%1 datagrams, %2 bytes in %3 reads (max batch %4), "
+                          "dropped %5 truncated, %6 foreign, %7 overruns")
+        .arg(stats.m_datagrams).arg(stats.m_bytes).arg(stats.m_syscalls)
+        .arg(stats.m_maxBatch).arg(stats.m_truncated).arg(stats.m_foreign)
+        .arg(stats.m_overruns);
+    if (m_timestamps)
+        msg += QString(", max gap %1 us").arg(stats.m_maxGap.count());
+    return msg;
+}
+
+void UDPReceiver::run(void)
+{
+    RunProlog();
+
+#ifdef Q_OS_LINUX
+    int one = 1;
+    if (setsockopt(m_fd, SOL_SOCKET, SO_RXQ_OVFL, &one, sizeof(one)) < 0)
+    {
+        LOG(VB_RECORD, LOG_WARNING, LOC +
+            "Unable to count socket buffer overruns" + ENO);
+    }
+    if (m_timestamps)
+    {
+        int flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+        if (setsockopt(m_fd, SOL_SOCKET, SO_TIMESTAMPING,
+                       &flags, sizeof(flags)) < 0)
+        {
+            LOG(VB_RECORD, LOG_WARNING, LOC +
+                "Unable to enable receive timestamps" + ENO);
+            m_timestamps = false;
+        }
+    }
+
+    static constexpr size_t kControlSize =
+        CMSG_SPACE(sizeof(uint32_t)) + CMSG_SPACE(sizeof(scm_timestamping));
+
+    // The ring is allocated once and reused for every batch
+    std::vector<char> ring(static_cast<size_t>(kBatchSize) * kMaxDatagram);
+    std::vector<char> control(static_cast<size_t>(kBatchSize) * kControlSize);
+    std::array<mmsghdr, kBatchSize>          msgs {};
+    std::array<iovec, kBatchSize>            iovecs {};
+    std::array<sockaddr_storage, kBatchSize> senders {};
+    std::array<UDPDatagram, kBatchSize>      datagrams {};
+
+    bool check_sender = !m_sender.isNull();
+    uint32_t overruns = 0;
+    uint32_t logged_overruns = 0;
+    QElapsedTimer overrun_timer;
+    overrun_timer.start();
+    std::chrono::microseconds last_arrival { 0us };
+
+    LOG(VB_RECORD, LOG_INFO, LOC + QString("Receiving up to %1 datagrams per read%2")
+        .arg(kBatchSize).arg(m_timestamps ? " with timestamps" : ""));
+
+    // Only poll once the socket has been drained
+    bool drained = true;
+    while (m_running)
+    {
+        if (drained)
+        {
+            pollfd pfd { m_fd, POLLIN, 0 };
+            int rc = poll(&pfd, 1, 100);
+            if (rc == 0 || (rc < 0 && errno == EINTR))
+                continue;
+            if (rc < 0)
+            {
+                LOG(VB_GENERAL, LOG_ERR, LOC + "poll() failed" + ENO);
+                break;
+            }
+        }
+
+        for (uint i = 0; i < kBatchSize; ++i)
+        {
+            iovecs[i].iov_base = &ring[static_cast<size_t>(i) * kMaxDatagram];
+            iovecs[i].iov_len  = kMaxDatagram;
+            msghdr &hdr = msgs[i].msg_hdr;
+            hdr.msg_name       = &senders[i];
+            hdr.msg_namelen    = sizeof(sockaddr_storage);
+            hdr.msg_iov        = &iovecs[i];
+            hdr.msg_iovlen     = 1;
+            hdr.msg_control    = &control[i * kControlSize];
+            hdr.msg_controllen = kControlSize;
+            hdr.msg_flags      = 0;
+        }
+
+        int received = recvmmsg(m_fd, msgs.data(), kBatchSize, MSG_DONTWAIT,
+                                nullptr);
+        if (received < 0)
+        {
+            drained = true;
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+                continue;
+            LOG(VB_GENERAL, LOG_ERR, LOC + "recvmmsg() failed" + ENO);
+            break;
+        }
+        drained = (received < static_cast<int>(kBatchSize));
+
+        uint count = 0;
+        uint64_t bytes = 0;
+        uint64_t truncated = 0;
+        uint64_t foreign = 0;
+        std::chrono::microseconds max_gap { 0us };
+        for (int i = 0; i < received; ++i)
+        {
+            msghdr &hdr = msgs[i].msg_hdr;
+            std::chrono::microseconds arrival { 0us };
+            for (cmsghdr *cmsg = CMSG_FIRSTHDR(&hdr); cmsg != nullptr;
+                 cmsg = CMSG_NXTHDR(&hdr, cmsg))
+            {
+                if (cmsg->cmsg_level != SOL_SOCKET)
+                    continue;
+                if (cmsg->cmsg_type == SO_RXQ_OVFL)
+                {
+                    memcpy(&overruns, CMSG_DATA(cmsg), sizeof(overruns));
+                }
+                else if (cmsg->cmsg_type == SCM_TIMESTAMPING)
+                {
+                    scm_timestamping ts {};
+                    memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+                    arrival = std::chrono::seconds(ts.ts[0].tv_sec) +
+                        std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::nanoseconds(ts.ts[0].tv_nsec));
+                }
+            }
+
+            if (arrival > 0us)
+            {
+                if (last_arrival > 0us)
+                    max_gap = std::max(max_gap, arrival - last_arrival);
+                last_arrival = arrival;
+            }
+
+            if ((hdr.msg_flags & MSG_TRUNC) != 0)
+            {
+                truncated++;
+                continue;
+            }
+            if (check_sender &&
+                QHostAddress(reinterpret_cast<sockaddr*>(&senders[i])) != m_sender)
+            {
+                foreign++;
+                continue;
+            }
+
+            datagrams[count].m_data    = static_cast<char*>(iovecs[i].iov_base);
+            datagrams[count].m_size    = static_cast<int>(msgs[i].msg_len);
+            datagrams[count].m_arrival = arrival;
+            bytes += msgs[i].msg_len;
+            count++;
+        }
+
+        if (count > 0)
+            m_callback->DatagramsReceived(m_stream, datagrams.data(), count);
+
+        {
+            QMutexLocker locker(&m_statsLock);
+            m_stats.m_datagrams += count;
+            m_stats.m_bytes     += bytes;
+            m_stats.m_syscalls++;
+            m_stats.m_truncated += truncated;
+            m_stats.m_foreign   += foreign;
+            m_stats.m_overruns   = overruns;
+            m_stats.m_maxBatch   = std::max(m_stats.m_maxBatch,
+                                            static_cast<uint>(received));
+            m_stats.m_maxGap     = std::max(m_stats.m_maxGap, max_gap);
+        }
+
+        if (truncated > 0)
+        {
+            LOG(VB_RECORD, LOG_WARNING, LOC +
+                QString("Dropped %1 datagrams larger than %2 bytes")
+                .arg(truncated).arg(kMaxDatagram));
+        }
+        if (overruns != logged_overruns &&
+            overrun_timer.elapsed() > std::chrono::milliseconds(kOverrunLogInterval).count())
+        {
+            LOG(VB_RECORD, LOG_WARNING, LOC +
+                QString("Kernel dropped %1 datagrams, socket buffer full")
+                .arg(overruns - logged_overruns));
+            logged_overruns = overruns;
+            overrun_timer.restart();
+        }
+    }
+
+    LOG(VB_RECORD, LOG_INFO, LOC + "Stopped: " + GetStatsString());
+#endif // Q_OS_LINUX
+
+    RunEpilog();
+}
@@ -0,0 +1,101 @@
+/* -*- Mode: c++ -*-
+ * UDPReceiver
+ * Distributed as part of MythTV under GPL v2 and later.
+ */
+
+#ifndef UDP_RECEIVER_H
+#define UDP_RECEIVER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <QHostAddress>
+#include <QMutex>
+#include <QString>
+
+#include "libmythbase/mthread.h"
+#include "libmythbase/mythchrono.h"
+
+/// A datagram in the receive ring, only valid during the callback.
+struct UDPDatagram
+{
+    const char               *m_data    { nullptr };
+    int                       m_size    { 0 };
+    /// Kernel receive time, zero unless timestamps were requested
+    std::chrono::microseconds m_arrival { 0us };
+};
+
+struct UDPReceiverStats
+{
+    uint64_t m_datagrams  { 0 }; ///< Datagrams delivered
+    uint64_t m_bytes      { 0 }; ///< Bytes delivered
+    uint64_t m_syscalls   { 0 }; ///< recvmmsg() calls returning data
+    uint64_t m_truncated  { 0 }; ///< Dropped, larger than a ring slot
+    uint64_t m_foreign    { 0 }; ///< Dropped, from an unexpected sender
+    uint64_t m_overruns   { 0 }; ///< Dropped by the kernel, socket buffer full
+    uint     m_maxBatch   { 0 }; ///< Most datagrams read by one call
+    /// Longest gap between datagrams, needs timestamps
+    std::chrono::microseconds m_maxGap { 0us };
+};
+
+class UDPReceiverCB
+{
+  protected:
+    virtual ~UDPReceiverCB() = default;
+  public:
+    /// Called on the receive thread with each batch of datagrams.
+    virtual void DatagramsReceived(uint stream, const UDPDatagram *datagrams,
+                                   uint count) = 0;
+};
+
+/** \class UDPReceiver
+ *  \brief Reads a UDP socket on its own thread in batches.
+ *
+ *  Instead of one readDatagram() call and one event loop wakeup per
+ *  datagram, up to kBatchSize datagrams are read with each recvmmsg()
+ *  call into a ring of preallocated buffers and handed to the callback
+ *  together. The kernel's count of datagrams dropped because the socket
+ *  buffer was full is collected with SO_RXQ_OVFL, and per datagram
+ *  receive timestamps can be requested with SO_TIMESTAMPING.
+ *
+ *  This is only available on Linux, elsewhere IsAvailable() returns
+ *  false and the socket should be read from the event loop as before.
+ */
+class UDPReceiver : public MThread
+{
+  public:
+    UDPReceiver(const QString &name, int fd, uint stream, UDPReceiverCB *cb,
+                bool timestamps = false);
+    ~UDPReceiver() override;
+
+    static bool IsAvailable(void);
+
+    /// Drop datagrams that don't come from this address.
+    void SetExpectedSender(const QHostAddress &sender) { m_sender = sender; }
+
+    void Stop(void);
+
+    UDPReceiverStats GetStats(void) const;
+    QString          GetStatsString(void) const;
+
+    static constexpr uint kBatchSize    { 64 };
+    /// Large enough for a jumbo frame
+    static constexpr int  kMaxDatagram  { 9216 };
+
+  protected:
+    void run(void) override; // MThread
+
+  private:
+    int               m_fd;
+    uint              m_stream;
+    UDPReceiverCB    *m_callback;
+    bool              m_timestamps;
+    QHostAddress      m_sender;
+    std::atomic<bool> m_running       { true };
+
+    mutable QMutex    m_statsLock;
+    UDPReceiverStats  m_stats;
+};
+
+#endif // UDP_RECEIVER_H
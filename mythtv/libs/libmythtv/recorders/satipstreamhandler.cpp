@@ -530,13 +530,12 @@ void SatIPStreamHandler::SetSigmonValues(bool lock, int level)
 
 // === RTP DataReadHelper ===================================================
 //
-// Read RTP stream data from the UDP socket and store it in the packet buffer
-// and write the packets immediately to the listeners.
+// Read RTP stream data from the UDP socket and write the packets immediately
+// to the listeners.
 //
-// TODO
-// This has to be created in a separate thread to achieve minimum
-// minimum latency and so to avoid overflow of the UDP input buffers.
-// N.B. Then also with the socket that is now in the streamhandler.
+// Where possible the socket is read in batches by a UDPReceiver on its own
+// thread, to achieve minimum latency and so to avoid overflow of the UDP
+// input buffers. Otherwise it is read from the readyRead signal.
 // ---------------------------------------------------------------------------
 
 #define LOC_DRH QString("SH_DRH[%1]: ").arg(m_streamHandler->m_inputId)
@@ -548,10 +547,6 @@ SatIPDataReadHelper::SatIPDataReadHelper(SatIPStreamHandler* handler)
     LOG(VB_RECORD, LOG_INFO, LOC_DRH +
         QString("Starting data read helper for RTP UDP socket"));
 
-    // Call ReadPending when there are RTP data packets received on m_socket
-    connect(m_socket, &QIODevice::readyRead,
-            this,     &SatIPDataReadHelper::ReadPending);
-
     // Number of RTP packets to discard at start.
     // This is to flush the RTP packets that might still be in transit
     // from the previously tuned channel.
@@ -559,13 +554,36 @@ SatIPDataReadHelper::SatIPDataReadHelper(SatIPStreamHandler* handler)
     m_valid = false;
 
     LOG(VB_RECORD, LOG_DEBUG, LOC_DRH + QString("Init flush count to %1").arg(m_count));
+
+    if (UDPReceiver::IsAvailable() && m_socket->socketDescriptor() >= 0)
+    {
+        m_receiver = new UDPReceiver(
+            QString("SatIPRecv%1").arg(m_streamHandler->m_inputId),
+            m_socket->socketDescriptor(), 0, this,
+            VERBOSE_LEVEL_CHECK(VB_RECORD, LOG_DEBUG));
+        m_receiver->start();
+    }
+    else
+    {
+        // Call ReadPending when there are RTP data packets received on m_socket
+        connect(m_socket, &QIODevice::readyRead,
+                this,     &SatIPDataReadHelper::ReadPending);
+    }
 }
 
 SatIPDataReadHelper::~SatIPDataReadHelper()
 {
     LOG(VB_RECORD, LOG_INFO, LOC_DRH + QString("%1").arg(__func__));
-    disconnect(m_socket, &QIODevice::readyRead,
-               this,     &SatIPDataReadHelper::ReadPending);
+    if (m_receiver)
+    {
+        delete m_receiver;
+        m_receiver = nullptr;
+    }
+    else
+    {
+        disconnect(m_socket, &QIODevice::readyRead,
+                   this,     &SatIPDataReadHelper::ReadPending);
+    }
 }
 
 void SatIPDataReadHelper::ReadPending()
@@ -588,65 +606,81 @@ void SatIPDataReadHelper::ReadPending()
         data.resize(m_socket->pendingDatagramSize());
         m_socket->readDatagram(data.data(), data.size(), &sender, &senderPort);
 
-        if (pkt.GetPayloadType() == RTPDataPacket::kPayLoadTypeTS)
-        {
-            RTPTSDataPacket ts_packet(pkt);
+        ProcessPacket(pkt);
+    }
+}
 
-            if (!ts_packet.IsValid())
-            {
-                continue;
-            }
+void SatIPDataReadHelper::DatagramsReceived(
+    uint /*stream*/, const UDPDatagram *datagrams, uint count)
+{
+    for (uint i = 0; i < count; ++i)
+    {
+        // The data is only used before this returns, no need to copy it
+        RTPDataPacket pkt;
+        pkt.GetDataReference().setRawData(datagrams[i].m_data,
+                                          datagrams[i].m_size);
+        ProcessPacket(pkt);
+    }
+}
 
-            // Check the packet sequence number
-            uint expectedSequenceNumber = (m_sequenceNumber + 1) & 0xFFFF;
-            m_sequenceNumber = ts_packet.GetSequenceNumber();
-            if ((expectedSequenceNumber != m_sequenceNumber) && m_valid)
-            {
-                LOG(VB_RECORD, LOG_ERR, LOC_DRH +
-                    QString("Sequence number error -- Expected:%1 Received:%2")
-                        .arg(expectedSequenceNumber).arg(m_sequenceNumber));
-            }
+void SatIPDataReadHelper::ProcessPacket(const RTPDataPacket &pkt)
+{
+    if (pkt.GetPayloadType() != RTPDataPacket::kPayLoadTypeTS)
+        return;
 
-            // Flush the first few packets after start
-            if (m_count > 0)
-            {
-                LOG(VB_RECORD, LOG_INFO, LOC_DRH + QString("Flushing RTP packet, %1 to do").arg(m_count));
-                m_count--;
-            }
-            else
-            {
-                m_valid = true;
-            }
+    RTPTSDataPacket ts_packet(pkt);
+
+    if (!ts_packet.IsValid())
+        return;
+
+    // Check the packet sequence number
+    uint expectedSequenceNumber = (m_sequenceNumber + 1) & 0xFFFF;
+    m_sequenceNumber = ts_packet.GetSequenceNumber();
+    if ((expectedSequenceNumber != m_sequenceNumber) && m_valid)
+    {
+        LOG(VB_RECORD, LOG_ERR, LOC_DRH +
+            QString("Sequence number error -- Expected:%1 Received:%2")
+                .arg(expectedSequenceNumber).arg(m_sequenceNumber));
+    }
+
+    // Flush the first few packets after start
+    if (m_count > 0)
+    {
+        LOG(VB_RECORD, LOG_INFO, LOC_DRH + QString("Flushing RTP packet, %1 to do").arg(m_count));
+        m_count--;
+    }
+    else
+    {
+        m_valid = true;
+    }
 
-            // Send the packet data to all listeners
-            if (m_valid)
+    // Send the packet data to all listeners
+    if (m_valid)
+    {
+        int remainder = 0;
+        {
+            QMutexLocker locker(&m_streamHandler->m_listenerLock);
+            auto streamDataList = m_streamHandler->m_streamDataList;
+            if (!streamDataList.isEmpty())
             {
-                int remainder = 0;
-                {
-                    QMutexLocker locker(&m_streamHandler->m_listenerLock);
-                    auto streamDataList = m_streamHandler->m_streamDataList;
-                    if (!streamDataList.isEmpty())
-                    {
-                        const unsigned char *data_buffer = ts_packet.GetTSData();
-                        size_t data_length = ts_packet.GetTSDataSize();
-
-                        for (auto sit = streamDataList.cbegin(); sit != streamDataList.cend(); ++sit)
-                        {
-                            remainder = sit.key()->ProcessData(data_buffer, data_length);
-                        }
-
-                        m_streamHandler->WriteMPTS(data_buffer, data_length - remainder);
-                    }
-                }
+                const unsigned char *data_buffer = ts_packet.GetTSData();
+                size_t data_length = ts_packet.GetTSDataSize();
 
-                if (remainder != 0)
+                for (auto sit = streamDataList.cbegin(); sit != streamDataList.cend(); ++sit)
                 {
-                    LOG(VB_RECORD, LOG_INFO, LOC_DRH +
-                        QString("RTP data_length = %1 remainder = %2")
-                        .arg(ts_packet.GetTSDataSize()).arg(remainder));
+                    remainder = sit.key()->ProcessData(data_buffer, data_length);
                 }
+
+                m_streamHandler->WriteMPTS(data_buffer, data_length - remainder);
             }
         }
+
+        if (remainder != 0)
+        {
+            LOG(VB_RECORD, LOG_INFO, LOC_DRH +
+                QString("RTP data_length = %1 remainder = %2")
+                .arg(ts_packet.GetTSDataSize()).arg(remainder));
+        }
     }
 }
 
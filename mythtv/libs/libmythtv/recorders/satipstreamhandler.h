@@ -13,9 +13,11 @@
 #include "dtvconfparserhelpers.h"
 #include "dtvmultiplex.h"
 #include "mpeg/mpegstreamdata.h"
+#include "rtp/udpreceiver.h"
 #include "satiprtsp.h"
 #include "streamhandler.h"
 
+class RTPDataPacket;
 class SatIPDataReadHelper;
 class SatIPControlReadHelper;
 
@@ -96,7 +98,7 @@ class SatIPStreamHandler : public StreamHandler
 
 // --- SatIPDataReadHelper ---------------------------------------------------
 
-class SatIPDataReadHelper : public QObject
+class SatIPDataReadHelper : public QObject, public UDPReceiverCB
 {
     Q_OBJECT
 
@@ -104,12 +106,19 @@ class SatIPDataReadHelper : public QObject
     explicit SatIPDataReadHelper(SatIPStreamHandler *handler);
     ~SatIPDataReadHelper() override;
 
+    // UDPReceiverCB
+    void DatagramsReceived(uint stream, const UDPDatagram *datagrams,
+                           uint count) override;
+
   public slots:
     void ReadPending(void);
 
   private:
+    void ProcessPacket(const RTPDataPacket &pkt);
+
     SatIPStreamHandler *m_streamHandler   {nullptr};
     QUdpSocket         *m_socket          {nullptr};
+    UDPReceiver        *m_receiver        {nullptr};
     uint                m_sequenceNumber  {0};
     uint                m_count           {0};
     bool                m_valid           {false};
@@ -0,0 +1,269 @@
+#include "test_compactprogramlist.h"
+
+#include <array>
+#include <memory>
+
+#include <QTest>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#if __GLIBC_PREREQ(2,33)
+#define HAVE_MALLINFO2 1
+#endif
+#endif
+
+#include "libmythbase/mythdate.h"
+#include "libmythbase/mythsorthelper.h"
+
+// About two weeks of listings for 200 channels
+static constexpr int kListings { 50000 };
+static constexpr int kChannels { 200 };
+static constexpr int kTitles   { 3000 };
+
+static const std::array<QString,6> kCategories
+    { "Drama", "News", "Sports", "Comedy", "Documentary", "Children" };
+
+static ProgramInfo recording(void)
+{
+    return {
+        715,
+        "The Flash (2014)", "",
+        "The New Rogues", "",
+        "Barry continues to train Jesse ...",
+        3, 4, 23, "", "Drama",
+        1514, "514", "WNUVDT", "WNUBDT (WNUV-DT)", "",
+        QString("Default"), QString("Default"),
+        "/recordings/1514_20161025235800.ts",
+        "localhost", "Default",
+        "EP01922936", "EP019229360055", "ttvdb4.py_279121",
+        ProgramInfo::kCategoryTVShow, 7, 6056109800,
+        MythDate::fromString("2016-10-26 00:00:00"),
+        MythDate::fromString("2016-10-26 01:00:00"),
+        MythDate::fromString("2016-10-25 23:58:00"),
+        MythDate::fromString("2016-10-26 01:02:00"),
+        0.95, 2016, 50, 133, QDate(2016,10,26),
+        MythDate::fromString("2016-10-26 01:12:34"),
+        RecStatus::Recorded, 19890314,
+        kDupsInAll, kDupCheckSubThenDesc,
+        20141007,
+        FL_IGNORELASTPLAYPOS | FL_BOOKMARK | FL_REPEAT,
+        AUD_DOLBY,
+        VID_DAMAGED | VID_1080 | VID_HDTV,
+        SUB_HARDHEAR,
+        "Prime A-1",
+        QDateTime() };
+}
+
+/// Build the Nth row the way LoadFromProgram() does, with fresh strings
+/// as they would come from the database. With a Sorter the sort forms of
+/// the title and subtitle come from there.
+static ProgramInfo *listing(int N, CompactProgramList *Sorter,
+                            const ProgramList &SchedList)
+{
+    static const QDateTime s_start = MythDate::fromString("2026-01-01 00:00:00");
+    int chan   = N % kChannels;
+    int title  = (N * 7919) % kTitles;
+    QDateTime start = s_start.addSecs(static_cast<qint64>(N / kChannels) * 1800);
+    QString titleStr    = QString("The Title %1").arg(title);
+    QString subtitleStr = QString("Episode %1").arg(N % 97);
+
+    return new ProgramInfo(
+        titleStr,
+        Sorter ? Sorter->SortTitle(titleStr) : QString(),
+        subtitleStr,
+        Sorter ? Sorter->SortTitle(subtitleStr) : QString(),
+        QString("The description of title %1, episode %2.").arg(title).arg(N % 97),
+        QString(),
+        kCategories[title % kCategories.size()],
+        1000 + chan,
+        QString::number(chan + 1),
+        QString("CALL%1").arg(chan),
+        QString("Channel Name %1").arg(chan),
+        QString(),
+        start, start.addSecs(1800), start, start.addSecs(1800),
+        QString("EP%1").arg(title, 8, 10, QChar('0')),
+        QString("EP%1%2").arg(title, 8, 10, QChar('0')).arg(N % 97, 4, 10, QChar('0')),
+        ProgramInfo::kCategoryTVShow,
+        0.5F, 2020, 0, 0, QDate(2020, 1, 1 + (N % 28)),
+        RecStatus::Unknown, 0, kNotRecording, 0,
+        false, (N % 3) == 0,
+        VID_HDTV, AUD_STEREO, SUB_NORMAL,
+        1, N % 97, 0,
+        SchedList);
+}
+
+static void loadProgramList(ProgramList &Programs)
+{
+    ProgramList schedList;
+    Programs.clear();
+    for (int i = 0; i < kListings; ++i)
+        Programs.push_back(listing(i, nullptr, schedList));
+}
+
+static void loadCompactList(CompactProgramList &Programs)
+{
+    ProgramList schedList;
+    Programs.clear();
+    Programs.reserve(kListings);
+    for (int i = 0; i < kListings; ++i)
+    {
+        std::unique_ptr<ProgramInfo> program { listing(i, &Programs, schedList) };
+        Programs.Append(*program);
+    }
+}
+
+static QString flatten(const ProgramInfo &Program)
+{
+    QStringList list;
+    Program.ToStringList(list);
+    return list.join('|');
+}
+
+void TestCompactProgramList::test_roundTrip(void)
+{
+    ProgramInfo original = recording();
+    CompactProgramList programs;
+    programs.Append(original);
+    QCOMPARE(programs.size(), size_t{1});
+
+    ProgramInfo copy = programs.At(0);
+    QCOMPARE(flatten(copy), flatten(original));
+    QVERIFY(copy == original);
+    QCOMPARE(copy.GetSortTitle(), original.GetSortTitle());
+    QCOMPARE(copy.GetSortSubtitle(), original.GetSortSubtitle());
+    QCOMPARE(copy.GetOriginalAirDate(), original.GetOriginalAirDate());
+
+    QCOMPARE(programs.GetTitle(0), QString("The Flash (2014)"));
+    QCOMPARE(programs.GetChanID(0), 1514U);
+    QCOMPARE(programs.GetRecordingStatus(0), RecStatus::Recorded);
+    QCOMPARE(programs.GetRecordingStartTime(0),
+             MythDate::fromString("2016-10-25 23:58:00"));
+    QCOMPARE(programs.GetRecordingStartTime(0).timeSpec(), Qt::UTC);
+}
+
+void TestCompactProgramList::test_emptyFields(void)
+{
+    ProgramInfo original = recording();
+    original.SetRecordingStatus(RecStatus::Failed);
+    original.SetSubtitle(QString());
+    CompactProgramList programs;
+    programs.Append(original);
+
+    // Materializing must reset what was in the ProgramInfo before
+    ProgramInfo copy = recording();
+    programs.Materialize(0, copy);
+    QVERIFY(copy.GetSubtitle().isEmpty());
+    QVERIFY(copy.GetSortSubtitle().isEmpty());
+    QVERIFY(!copy.GetBookmarkUpdate().isValid());
+    QCOMPARE(copy.GetRecordingStatus(), RecStatus::Failed);
+    QCOMPARE(flatten(copy), flatten(original));
+}
+
+void TestCompactProgramList::test_interning(void)
+{
+    CompactProgramList programs;
+    programs.Append(recording());
+    size_t strings = programs.StringCount();
+
+    ProgramInfo second = recording();
+    second.SetTitle("Supergirl");
+    programs.Append(second);
+    programs.Append(recording());
+
+    // Only the new title and its sort form are added
+    QCOMPARE(programs.size(), size_t{3});
+    QCOMPARE(programs.StringCount(), strings + 2);
+    QCOMPARE(programs.GetTitle(1), QString("Supergirl"));
+    QCOMPARE(programs.GetChannelName(2), QString("WNUBDT (WNUV-DT)"));
+}
+
+void TestCompactProgramList::test_sortTitle(void)
+{
+    CompactProgramList programs;
+    QCOMPARE(programs.SortTitle("The Flash (2014)"),
+             getMythSortHelper()->doTitle("The Flash (2014)"));
+    size_t strings = programs.StringCount();
+    QCOMPARE(programs.SortTitle(QString("The Flash (2014)")),
+             QString("flash (2014)"));
+    QCOMPARE(programs.StringCount(), strings);
+    QVERIFY(programs.SortTitle(QString()).isEmpty());
+}
+
+void TestCompactProgramList::test_toProgramList(void)
+{
+    ProgramList schedList;
+    CompactProgramList programs;
+    for (int i = 0; i < 10; ++i)
+    {
+        std::unique_ptr<ProgramInfo> program { listing(i, nullptr, schedList) };
+        programs.Append(*program);
+    }
+
+    ProgramList list;
+    programs.ToProgramList(list);
+    QCOMPARE(list.size(), size_t{10});
+    for (size_t i = 0; i < list.size(); ++i)
+    {
+        std::unique_ptr<ProgramInfo> expected {
+            listing(static_cast<int>(i), nullptr, schedList) };
+        QCOMPARE(flatten(*list[i]), flatten(*expected));
+        QCOMPARE(programs.GetScheduledStartTime(i),
+                 expected->GetScheduledStartTime());
+    }
+}
+
+void TestCompactProgramList::benchmark_load_data(void)
+{
+    QTest::addColumn<bool>("compact");
+    QTest::newRow("ProgramList")        << false;
+    QTest::newRow("CompactProgramList") << true;
+}
+
+void TestCompactProgramList::benchmark_load(void)
+{
+    QFETCH(bool, compact);
+
+    ProgramList list;
+    CompactProgramList compactList;
+    if (compact)
+    {
+        QBENCHMARK { loadCompactList(compactList); }
+        QCOMPARE(compactList.size(), size_t{kListings});
+    }
+    else
+    {
+        QBENCHMARK { loadProgramList(list); }
+        QCOMPARE(list.size(), size_t{kListings});
+    }
+}
+
+void TestCompactProgramList::test_listingsMemory(void)
+{
+#ifdef HAVE_MALLINFO2
+    auto heapInUse = []() { return mallinfo2().uordblks; };
+
+    size_t before = heapInUse();
+    auto *list = new ProgramList;
+    loadProgramList(*list);
+    size_t listBytes = heapInUse() - before;
+    delete list;
+
+    before = heapInUse();
+    auto *compact = new CompactProgramList;
+    loadCompactList(*compact);
+    size_t compactBytes = heapInUse() - before;
+
+    qInfo().noquote()
+        << QString("%1 listings: ProgramList %2 KiB, CompactProgramList %3 KiB "
+                   "(estimated %4 KiB, %5 strings)")
+        .arg(kListings).arg(listBytes / 1024).arg(compactBytes / 1024)
+        .arg(compact->MemoryUsage() / 1024).arg(compact->StringCount());
+    delete compact;
+
+    QVERIFY(compactBytes < listBytes / 2);
+#else
+    QSKIP("Heap usage is only measured with glibc");
+#endif
+}
+
+QTEST_GUILESS_MAIN(TestCompactProgramList)
@@ -0,0 +1,25 @@
+#ifndef LIBMYTHTV_TEST_COMPACTPROGRAMLIST_H
+#define LIBMYTHTV_TEST_COMPACTPROGRAMLIST_H
+
+#include <QObject>
+
+#include "libmythtv/compactprogramlist.h"
+#include "libmythtv/programinfo.h"
+
+class TestCompactProgramList : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    static void test_roundTrip(void);
+    static void test_emptyFields(void);
+    static void test_interning(void);
+    static void test_sortTitle(void);
+    static void test_toProgramList(void);
+
+    static void benchmark_load_data(void);
+    static void benchmark_load(void);
+    static void test_listingsMemory(void);
+};
+
+#endif // LIBMYTHTV_TEST_COMPACTPROGRAMLIST_H
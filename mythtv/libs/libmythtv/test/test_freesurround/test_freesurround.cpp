@@ -0,0 +1,148 @@
+/*
+ *  Class TestFreeSurround
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#include "test_freesurround.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+
+#include <QElapsedTimer>
+
+#include "libmythtv/audio/freesurround_decoder.h"
+
+static constexpr unsigned kBlockSize { 8192 };
+static constexpr unsigned kHalfBlock { kBlockSize / 2 };
+static constexpr double   kRate      { 48000.0 };
+
+// Fill both decoders with the same stereo signal: a centred tone, a
+// partially panned tone and some anti-phase noise for the rear channels.
+static void fill_block(std::mt19937 &rng, unsigned block,
+                       fsurround_decoder &a, fsurround_decoder *b = nullptr)
+{
+    std::normal_distribution<float> noise(0.0F, 0.06F);
+    float **ina = a.getInputBuffers();
+    float **inb = b ? b->getInputBuffers() : nullptr;
+    for (unsigned k = 0; k < kHalfBlock; ++k)
+    {
+        double t = ((block * kHalfBlock) + k) / kRate;
+        auto centre = static_cast<float>(0.4 * std::sin(2 * std::numbers::pi * 440 * t));
+        auto panned = static_cast<float>(0.3 * std::sin((2 * std::numbers::pi * 1234 * t) + 1));
+        float rear = noise(rng);
+        float left  = centre + panned + rear;
+        float right = centre - rear + (0.5F * panned * static_cast<float>(block % 3));
+        ina[0][k] = left;
+        ina[1][k] = right;
+        if (inb)
+        {
+            inb[0][k] = left;
+            inb[1][k] = right;
+        }
+    }
+}
+
+void TestFreeSurround::FastMatchesExact_data()
+{
+    QTest::addColumn<unsigned>("phase");
+    QTest::addColumn<bool>("linear");
+
+    QTest::newRow("music, simple steering")  << 0U << false;
+    QTest::newRow("music, linear steering")  << 0U << true;
+    QTest::newRow("dvd, simple steering")    << 1U << false;
+    QTest::newRow("dvd, linear steering")    << 1U << true;
+    QTest::newRow("90deg, linear steering")  << 3U << true;
+}
+
+void TestFreeSurround::FastMatchesExact()
+{
+    QFETCH(unsigned, phase);
+    QFETCH(bool, linear);
+
+    fsurround_decoder exact(kBlockSize);
+    fsurround_decoder fast(kBlockSize);
+    for (auto *dec : { &exact, &fast })
+    {
+        dec->phase_mode(phase);
+        dec->steering_mode(linear);
+        dec->sample_rate(48000);
+    }
+    fast.fast_mode(true);
+
+    std::mt19937 rng(1);
+    float maxError = 0.0F;
+    float maxValue = 0.0F;
+    for (unsigned block = 0; block < 32; ++block)
+    {
+        fill_block(rng, block, exact, &fast);
+        exact.decode(0.65F, 0.3F, 1.0F);
+        fast.decode(0.65F, 0.3F, 1.0F);
+        float **oute = exact.getOutputBuffers();
+        float **outf = fast.getOutputBuffers();
+        for (int ch = 0; ch < 6; ++ch)
+        {
+            for (unsigned k = 0; k < kHalfBlock; ++k)
+            {
+                maxError = std::max(maxError, std::abs(oute[ch][k] - outf[ch][k]));
+                maxValue = std::max(maxValue, std::abs(oute[ch][k]));
+            }
+        }
+    }
+
+    QVERIFY(maxValue > 0.1F);
+    QVERIFY2(maxError < 1e-2F,
+             qPrintable(QString("max error %1").arg(maxError)));
+}
+
+void TestFreeSurround::Decode_data()
+{
+    QTest::addColumn<bool>("fast");
+    QTest::newRow("exact") << false;
+    QTest::newRow("fast")  << true;
+}
+
+void TestFreeSurround::Decode()
+{
+    QFETCH(bool, fast);
+
+    fsurround_decoder dec(kBlockSize);
+    dec.steering_mode(true);
+    dec.sample_rate(48000);
+    dec.fast_mode(fast);
+
+    std::mt19937 rng(1);
+    fill_block(rng, 0, dec);
+
+    qint64 samples = 0;
+    QElapsedTimer timer;
+    timer.start();
+    QBENCHMARK
+    {
+        dec.decode(0.65F, 0.3F, 1.0F);
+        samples += kHalfBlock;
+    }
+    qint64 elapsed = timer.nsecsElapsed();
+    if (elapsed > 0)
+    {
+        qInfo() << (fast ? "fast:" : "exact:")
+                << qRound64(samples * 1e9 / elapsed) << "samples/sec";
+    }
+}
+
+QTEST_APPLESS_MAIN(TestFreeSurround)
+
+#include "moc_test_freesurround.cpp"
@@ -0,0 +1,37 @@
+/*
+ *  Class TestFreeSurround
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef LIBMYTHTV_TEST_FREESURROUND_H
+#define LIBMYTHTV_TEST_FREESURROUND_H
+
+#include <QTest>
+
+class TestFreeSurround : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    // The fast per bin decode must stay close to the exact one
+    static void FastMatchesExact_data();
+    static void FastMatchesExact();
+
+    // Throughput of each decode path, reported in samples/sec
+    static void Decode_data();
+    static void Decode();
+};
+
+#endif // LIBMYTHTV_TEST_FREESURROUND_H
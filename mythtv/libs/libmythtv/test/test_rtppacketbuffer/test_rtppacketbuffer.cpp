@@ -0,0 +1,217 @@
+#include "test_rtppacketbuffer.h"
+
+#include <QList>
+#include <QTest>
+#include <QtEndian>
+
+#include "libmythtv/recorders/rtp/rtpdatapacket.h"
+#include "libmythtv/recorders/rtp/rtpfecpacket.h"
+#include "libmythtv/recorders/rtp/rtppacketbuffer.h"
+
+static constexpr uint     kRTPHeaderSize { 12 };
+static constexpr uint32_t kSSRC          { 0x12345678 };
+static constexpr uint     kPayloadType   { RTPDataPacket::kPayLoadTypeTS };
+
+/// Payloads differ in content and length so that XOR recovery is checked
+static QByteArray payload(uint seq)
+{
+    seq &= 0xFFFF;
+    QByteArray data(100 + static_cast<int>(seq % 5), '\0');
+    for (int i = 0; i < data.size(); ++i)
+        data[i] = static_cast<char>((seq * 7) + i);
+    return data;
+}
+
+static QByteArray rtpHeader(uint seq, uint pt)
+{
+    QByteArray header(kRTPHeaderSize, '\0');
+    auto *h = reinterpret_cast<unsigned char*>(header.data());
+    h[0] = 0x80;
+    h[1] = static_cast<unsigned char>(pt);
+    qToBigEndian(static_cast<uint16_t>(seq & 0xFFFF), h + 2);
+    qToBigEndian(static_cast<uint32_t>((seq & 0xFFFF) * 90), h + 4);
+    qToBigEndian(kSSRC, h + 8);
+    return header;
+}
+
+static UDPPacket dataPacket(uint seq)
+{
+    UDPPacket packet(0ULL);
+    packet.GetDataReference() = rtpHeader(seq, kPayloadType) + payload(seq);
+    return packet;
+}
+
+/// SMPTE 2022-1 FEC packet for the Count packets Offset apart from Base
+static UDPPacket fecPacket(uint base, uint offset, uint count, bool row)
+{
+    QByteArray xored;
+    uint length = 0;
+    uint pt     = 0;
+    uint ts     = 0;
+    for (uint i = 0; i < count; ++i)
+    {
+        uint seq = (base + (i * offset)) & 0xFFFF;
+        QByteArray data = payload(seq);
+        length ^= static_cast<uint>(data.size());
+        pt     ^= kPayloadType;
+        ts     ^= seq * 90;
+        if (xored.size() < data.size())
+            xored.append(QByteArray(data.size() - xored.size(), '\0'));
+        for (int j = 0; j < data.size(); ++j)
+            xored[j] = static_cast<char>(xored[j] ^ data[j]);
+    }
+
+    QByteArray header(RTPFECPacket::kFECHeaderSize, '\0');
+    auto *f = reinterpret_cast<unsigned char*>(header.data());
+    qToBigEndian(static_cast<uint16_t>(base & 0xFFFF), f);
+    qToBigEndian(static_cast<uint16_t>(length), f + 2);
+    f[4] = static_cast<unsigned char>(0x80 | pt);
+    qToBigEndian(static_cast<uint32_t>(ts), f + 8);
+    f[12] = row ? 0x40 : 0x00;
+    f[13] = static_cast<unsigned char>(offset);
+    f[14] = static_cast<unsigned char>(count);
+
+    UDPPacket packet(0ULL);
+    packet.GetDataReference() = rtpHeader(0, 96) + header + xored;
+    return packet;
+}
+
+static QList<RTPDataPacket> drain(RTPPacketBuffer &buffer)
+{
+    QList<RTPDataPacket> packets;
+    while (buffer.HasAvailablePacket())
+    {
+        RTPDataPacket packet(buffer.PopDataPacket());
+        if (packet.IsValid())
+            packets.push_back(packet);
+    }
+    return packets;
+}
+
+/// Checks that Count packets in order from First came out intact
+static void verify(const QList<RTPDataPacket> &packets, uint first, uint count)
+{
+    QVERIFY(packets.size() >= static_cast<int>(count));
+    for (uint i = 0; i < count; ++i)
+    {
+        const RTPDataPacket &packet = packets[static_cast<int>(i)];
+        uint seq = (first + i) & 0xFFFF;
+        QCOMPARE(packet.GetSequenceNumber(), seq);
+        QCOMPARE(packet.GetPayloadType(), kPayloadType);
+        QCOMPARE(packet.GetTimeStamp(), seq * 90);
+        QCOMPARE(packet.GetSynchronizationSource(), kSSRC);
+        QCOMPARE(packet.GetData().mid(static_cast<int>(packet.GetPayloadOffset())),
+                 payload(seq));
+    }
+}
+
+/// Pushes enough packets after Next to release everything before it
+static void pad(RTPPacketBuffer &buffer, uint next)
+{
+    for (uint i = 0; i < 2 * RTPPacketBuffer::kMinDepth; ++i)
+        buffer.PushDataPacket(dataPacket(next + i));
+}
+
+void TestRTPPacketBuffer::test_inOrder(void)
+{
+    RTPPacketBuffer buffer(0);
+    for (uint seq = 1000; seq < 1100; ++seq)
+        buffer.PushDataPacket(dataPacket(seq));
+
+    // Everything the depth lets through is released in order
+    QList<RTPDataPacket> packets = drain(buffer);
+    auto count = static_cast<uint>(packets.size());
+    QCOMPARE(count, 100 - RTPPacketBuffer::kMinDepth);
+    verify(packets, 1000, count);
+}
+
+void TestRTPPacketBuffer::test_reordered(void)
+{
+    RTPPacketBuffer buffer(0);
+    // Swap every pair after the first, then repeat one
+    for (uint seq = 1000; seq < 1020; ++seq)
+        buffer.PushDataPacket(dataPacket(seq < 1002 ? seq : seq ^ 1));
+    buffer.PushDataPacket(dataPacket(1005));
+    pad(buffer, 1020);
+
+    verify(drain(buffer), 1000, 20);
+    QCOMPARE(buffer.GetStats().m_duplicates, uint64_t{1});
+    QCOMPARE(buffer.GetStats().m_maxReorder, 1U);
+}
+
+void TestRTPPacketBuffer::test_rowRecovery(void)
+{
+    // A row of four, losing the third
+    RTPPacketBuffer buffer(0);
+    for (uint seq = 1000; seq < 1004; ++seq)
+    {
+        if (seq != 1002)
+            buffer.PushDataPacket(dataPacket(seq));
+    }
+    buffer.PushFECPacket(fecPacket(1000, 1, 4, true), 1);
+    pad(buffer, 1004);
+
+    verify(drain(buffer), 1000, 4);
+    QCOMPARE(buffer.GetStats().m_recovered, uint64_t{1});
+    QCOMPARE(buffer.GetStats().m_unrecoverable, uint64_t{0});
+}
+
+void TestRTPPacketBuffer::test_columnRecovery(void)
+{
+    // A 4x4 matrix, losing one packet from the middle of two columns
+    RTPPacketBuffer buffer(0);
+    for (uint seq = 1000; seq < 1016; ++seq)
+    {
+        if (seq != 1009 && seq != 1014)
+            buffer.PushDataPacket(dataPacket(seq));
+    }
+    for (uint column = 0; column < 4; ++column)
+        buffer.PushFECPacket(fecPacket(1000 + column, 4, 4, false), 0);
+    pad(buffer, 1016);
+
+    verify(drain(buffer), 1000, 16);
+    QCOMPARE(buffer.GetStats().m_recovered, uint64_t{2});
+    QCOMPARE(buffer.GetStats().m_unrecoverable, uint64_t{0});
+}
+
+void TestRTPPacketBuffer::test_fecBeforeData(void)
+{
+    // The FEC arrives before the rest of its row, the loss is repaired
+    // when the last packet it protects arrives.
+    RTPPacketBuffer buffer(0);
+    buffer.PushDataPacket(dataPacket(1000));
+    buffer.PushFECPacket(fecPacket(1000, 1, 4, true), 1);
+    buffer.PushDataPacket(dataPacket(1002));
+    QCOMPARE(buffer.GetStats().m_recovered, uint64_t{0});
+    buffer.PushDataPacket(dataPacket(1003));
+    QCOMPARE(buffer.GetStats().m_recovered, uint64_t{1});
+
+    // The real packet turning up afterwards is a duplicate
+    buffer.PushDataPacket(dataPacket(1001));
+    pad(buffer, 1004);
+
+    verify(drain(buffer), 1000, 4);
+    QCOMPARE(buffer.GetStats().m_duplicates, uint64_t{1});
+}
+
+void TestRTPPacketBuffer::test_sequenceWrap(void)
+{
+    // Run across the 16 bit wrap, losing a packet protected by a row
+    // that starts before the wrap.
+    RTPPacketBuffer buffer(0);
+    for (uint seq = 65520; seq < 65560; ++seq)
+    {
+        if ((seq & 0xFFFF) != 1)
+            buffer.PushDataPacket(dataPacket(seq));
+    }
+    buffer.PushFECPacket(fecPacket(65534, 1, 4, true), 1);
+    pad(buffer, 65560);
+
+    verify(drain(buffer), 65520, 40);
+    QCOMPARE(buffer.GetStats().m_recovered, uint64_t{1});
+    QCOMPARE(buffer.GetStats().m_unrecoverable, uint64_t{0});
+    QCOMPARE(buffer.GetStats().m_late, uint64_t{0});
+    QCOMPARE(buffer.GetStats().m_duplicates, uint64_t{0});
+}
+
+QTEST_APPLESS_MAIN(TestRTPPacketBuffer)
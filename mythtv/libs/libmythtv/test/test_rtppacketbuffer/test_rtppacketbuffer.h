@@ -0,0 +1,19 @@
+#ifndef LIBMYTHTV_TEST_RTPPACKETBUFFER_H
+#define LIBMYTHTV_TEST_RTPPACKETBUFFER_H
+
+#include <QObject>
+
+class TestRTPPacketBuffer : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    static void test_inOrder(void);
+    static void test_reordered(void);
+    static void test_rowRecovery(void);
+    static void test_columnRecovery(void);
+    static void test_fecBeforeData(void);
+    static void test_sequenceWrap(void);
+};
+
+#endif // LIBMYTHTV_TEST_RTPPACKETBUFFER_H
@@ -0,0 +1,215 @@
+// C++
+#include <algorithm>
+
+// Qt
+#include <QBuffer>
+#include <QFile>
+#include <QImageReader>
+#include <QPainter>
+
+// MythTV
+#include "libmythbase/mythcorecontext.h"
+#include "libmythbase/mythdate.h"
+#include "libmythbase/mythdirs.h"
+#include "libmythbase/mythlogging.h"
+#include "libmythbase/mythsystemlegacy.h"
+#include "libmythbase/remotefile.h"
+
+#include "io/mythmediabuffer.h"
+#include "mythpreviewplayer.h"
+#include "playercontext.h"
+#include "programinfo.h"
+#include "thumbstrip.h"
+
+#define LOC QString("ThumbStrip: ")
+
+/** \brief Start mythpreviewgen to make the strip for a finished recording.
+ *
+ *  This returns at once, the strip appears next to the recording when
+ *  mythpreviewgen has worked through it at idle priority.
+ */
+void ThumbStrip::GenerateInBackground(const ProgramInfo &ProgInfo)
+{
+    if (!gCoreContext->GetBoolSetting("ThumbStripGenerate", true))
+        return;
+
+    QString command = GetAppBinDir() + "mythpreviewgen";
+    QStringList args { "--thumbstrip",
+                       "--chanid", QString::number(ProgInfo.GetChanID()),
+                       "--starttime",
+                       ProgInfo.GetRecordingStartTime(MythDate::kFilename) };
+
+    auto *ms = new MythSystemLegacy(command, args,
+                                    kMSDontBlockInputDevs |
+                                    kMSDontDisableDrawing |
+                                    kMSRunBackground      |
+                                    kMSAutoCleanup        |
+                                    kMSPropagateLogs);
+    ms->SetNice(17);
+    ms->SetIOPrio(7);
+    ms->Run();
+
+    LOG(VB_GENERAL, LOG_INFO, LOC + QString("Generating seek thumbnails for %1")
+        .arg(ProgInfo.toString(ProgramInfo::kRecordingKey)));
+}
+
+/** \brief Grab keyframe thumbnails from a recording and save them as a strip.
+ *
+ *  \param ProgInfo  Recording to grab from.
+ *  \param Pathname  Local file containing the recording.
+ *  \param OutFile   Strip to write, normally GetFilename(Pathname).
+ *  \param Interval  Requested distance between thumbnails. This is
+ *                   increased for very long recordings so the strip
+ *                   never has more than kMaxTiles thumbnails.
+ */
+bool ThumbStrip::Generate(const ProgramInfo &ProgInfo, const QString &Pathname,
+                          const QString &OutFile, std::chrono::seconds Interval)
+{
+    MythMediaBuffer *buffer = MythMediaBuffer::Create(Pathname, false, false, 0ms);
+    if (!buffer || !buffer->IsOpen())
+    {
+        LOG(VB_GENERAL, LOG_ERR, LOC + QString("Could not open file: '%1'")
+            .arg(Pathname));
+        delete buffer;
+        return false;
+    }
+
+    auto *ctx = new PlayerContext(kPreviewGeneratorInUseID);
+    auto *player = new MythPreviewPlayer(ctx, static_cast<PlayerFlags>(kAudioMuted | kVideoIsNull | kNoITV));
+    ctx->SetRingBuffer(buffer);
+    ctx->SetPlayingInfo(&ProgInfo);
+    ctx->SetPlayer(player);
+
+    QList<QImage> tiles = player->GetThumbnails(Interval, kTileWidth, kMaxTiles);
+    delete ctx;
+
+    if (tiles.isEmpty())
+    {
+        LOG(VB_GENERAL, LOG_ERR, LOC + QString("No thumbnails for '%1'")
+            .arg(Pathname));
+        return false;
+    }
+
+    return Save(OutFile, tiles, Interval);
+}
+
+bool ThumbStrip::Save(const QString &Filename, const QList<QImage> &Tiles,
+                      std::chrono::seconds Interval)
+{
+    if (Tiles.isEmpty())
+        return false;
+
+    QSize tile = Tiles.first().size();
+    int columns = std::min(kColumns, static_cast<int>(Tiles.size()));
+    int rows = (static_cast<int>(Tiles.size()) + kColumns - 1) / kColumns;
+    QImage strip(tile.width() * columns, tile.height() * rows, QImage::Format_RGB32);
+    strip.fill(Qt::black);
+
+    QPainter painter(&strip);
+    for (int i = 0; i < Tiles.size(); ++i)
+    {
+        QPoint pos((i % kColumns) * tile.width(), (i / kColumns) * tile.height());
+        if (Tiles[i].size() == tile)
+            painter.drawImage(pos, Tiles[i]);
+        else
+            painter.drawImage(QRect(pos, tile), Tiles[i]);
+    }
+    painter.end();
+
+    // The layout travels with the image as JPEG comments
+    strip.setText("Interval", QString::number(Interval.count()));
+    strip.setText("TileSize", QString("%1x%2").arg(tile.width()).arg(tile.height()));
+    strip.setText("Count",    QString::number(Tiles.size()));
+
+    // Write under a temporary name so readers never see a partial strip
+    QString tmpname = Filename + ".tmp";
+    if (!strip.save(tmpname, "JPG", 75))
+    {
+        LOG(VB_GENERAL, LOG_ERR, LOC + QString("Failed to write '%1'").arg(tmpname));
+        QFile::remove(tmpname);
+        return false;
+    }
+    QFile::remove(Filename);
+    if (!QFile::rename(tmpname, Filename))
+    {
+        LOG(VB_GENERAL, LOG_ERR, LOC + QString("Failed to rename '%1' to '%2'")
+            .arg(tmpname, Filename));
+        QFile::remove(tmpname);
+        return false;
+    }
+
+    LOG(VB_GENERAL, LOG_INFO, LOC + QString("Saved %1 thumbnails every %2s to '%3'")
+        .arg(Tiles.size()).arg(Interval.count()).arg(Filename));
+    return true;
+}
+
+/// Load a strip from a local file or a myth:// URL.
+bool ThumbStrip::Load(const QString &Filename)
+{
+    Clear();
+
+    QByteArray data;
+    if (Filename.startsWith("myth://"))
+    {
+        if (!RemoteFile::Exists(Filename))
+            return false;
+        RemoteFile remote(Filename, false, false, 0s);
+        if (!remote.SaveAs(data))
+            return false;
+    }
+    else
+    {
+        QFile file(Filename);
+        if (!file.open(QIODevice::ReadOnly))
+            return false;
+        data = file.readAll();
+    }
+
+    QBuffer buffer(&data);
+    QImageReader reader(&buffer, "JPG");
+    if (!reader.read(&m_image))
+    {
+        LOG(VB_GENERAL, LOG_WARNING, LOC + QString("Failed to read '%1': %2")
+            .arg(Filename, reader.errorString()));
+        return false;
+    }
+
+    QStringList size = m_image.text("TileSize").split('x');
+    m_tileSize = QSize(size.value(0).toInt(), size.value(1).toInt());
+    m_interval = std::chrono::seconds(m_image.text("Interval").toInt());
+    m_count    = m_image.text("Count").toInt();
+
+    if (m_tileSize.isEmpty() || m_interval <= 0s || m_count <= 0 ||
+        m_tileSize.width() * std::min(m_count, kColumns) > m_image.width())
+    {
+        LOG(VB_GENERAL, LOG_WARNING, LOC + QString("'%1' has no valid layout")
+            .arg(Filename));
+        Clear();
+        return false;
+    }
+
+    LOG(VB_PLAYBACK, LOG_INFO, LOC + QString("Loaded %1 thumbnails every %2s from '%3'")
+        .arg(m_count).arg(m_interval.count()).arg(Filename));
+    return true;
+}
+
+void ThumbStrip::Clear(void)
+{
+    m_image    = QImage();
+    m_tileSize = QSize();
+    m_interval = kDefaultInterval;
+    m_count    = 0;
+}
+
+/// Returns the thumbnail taken at or before Position.
+QImage ThumbStrip::GetThumbnail(std::chrono::milliseconds Position) const
+{
+    if (!IsValid())
+        return {};
+
+    auto index = static_cast<int>(Position / m_interval);
+    index = std::clamp(index, 0, m_count - 1);
+    return m_image.copy((index % kColumns) * m_tileSize.width(),
+                        (index / kColumns) * m_tileSize.height(),
+                        m_tileSize.width(), m_tileSize.height());
+}
@@ -0,0 +1,58 @@
+#ifndef THUMBSTRIP_H
+#define THUMBSTRIP_H
+
+// Qt
+#include <QImage>
+#include <QList>
+#include <QSize>
+#include <QString>
+
+// MythTV
+#include "libmythbase/mythchrono.h"
+#include "libmythtv/mythtvexp.h"
+
+class ProgramInfo;
+
+/** \class ThumbStrip
+ *  \brief A grid of small keyframe thumbnails taken at a fixed interval
+ *         through a recording.
+ *
+ *  The strip is written after the recording has finished and is stored
+ *  next to it as "<basename>.strip.jpg". Tile n shows the recording at
+ *  n * interval seconds, so scrubbing UIs can show a preview for any
+ *  position without decoding the video.
+ */
+class MTV_PUBLIC ThumbStrip
+{
+  public:
+    static constexpr std::chrono::seconds kDefaultInterval { 10s };
+    static constexpr int kTileWidth { 160 };
+    static constexpr int kColumns   { 10 };
+    /// Keeps the strip height inside the JPEG limit of 65535 lines
+    static constexpr int kMaxTiles  { 4000 };
+
+    static QString GetFilename(const QString &Pathname)
+        { return Pathname + ".strip.jpg"; }
+    static void GenerateInBackground(const ProgramInfo &ProgInfo);
+    static bool Generate(const ProgramInfo &ProgInfo, const QString &Pathname,
+                         const QString &OutFile,
+                         std::chrono::seconds Interval = kDefaultInterval);
+    static bool Save(const QString &Filename, const QList<QImage> &Tiles,
+                     std::chrono::seconds Interval);
+
+    bool   Load(const QString &Filename);
+    void   Clear(void);
+    bool   IsValid(void) const                 { return m_count > 0; }
+    int    GetCount(void) const                { return m_count;     }
+    QSize  GetTileSize(void) const             { return m_tileSize;  }
+    std::chrono::seconds GetInterval(void) const { return m_interval; }
+    QImage GetThumbnail(std::chrono::milliseconds Position) const;
+
+  private:
+    QImage               m_image;
+    QSize                m_tileSize;
+    std::chrono::seconds m_interval { kDefaultInterval };
+    int                  m_count    { 0 };
+};
+
+#endif // THUMBSTRIP_H
@@ -40,6 +40,7 @@
 #include "recordingprofile.h"
 #include "recordingrule.h"
 #include "sourceutil.h"
+#include "thumbstrip.h"
 #include "tv_rec.h"
 #include "tvremoteutil.h"
 
@@ -988,6 +989,7 @@ void TVRec::FinishedRecording(RecordingInfo *curRec, RecordingQuality *recq)
         (curRec->GetRecordingStatus() == RecStatus::Recorded))
     {
         PreviewGeneratorQueue::GetPreviewImage(*curRec, "");
+        ThumbStrip::GenerateInBackground(*curRec);
     }
 
     // store recording in recorded table
@@ -11,6 +11,7 @@
 
 #include "fourcc.h"
 #include "mythcodecid.h"
+#include "mythvideoframepool.h"
 #include "videobuffers.h"
 
 // FFmpeg
@@ -58,6 +59,41 @@ static inline void DoDiscard(const std::vector<AVBufferRef *> &Discards)
         av_buffer_unref(&it);
 }
 
+/*! \brief Return the software buffer of Frame to the frame pool.
+ *
+ * MythVideoFrame::Init and the MythVideoFrame destructor free the buffer with
+ * av_free, which would leave the pool with a stale record of it.
+*/
+static void ReturnToPool(MythVideoFrame *Frame)
+{
+    if (MythVideoFrame::HardwareFormat(Frame->m_type) || !Frame->m_buffer)
+        return;
+    MythVideoFramePool::GetPool()->ReleaseBuffer(Frame->m_buffer);
+    Frame->m_buffer = nullptr;
+    Frame->m_bufferSize = 0;
+}
+
+/// \brief (Re)initialise a software frame with a buffer from the frame pool.
+static void InitFromPool(MythVideoFrame *Frame, VideoFrameType Type, int Width, int Height,
+                         const VideoFrameTypes* RenderFormats)
+{
+    auto * pool = MythVideoFramePool::GetPool();
+    ReturnToPool(Frame);
+
+    size_t size = 0;
+    uint8_t* buffer = nullptr;
+    if ((Width > 0 && Height > 0) && (Type != FMT_NONE))
+    {
+        size = MythVideoFrame::GetBufferSize(Type, Width, Height);
+        buffer = pool->GetBuffer(size);
+    }
+    Frame->Init(Type, buffer, buffer ? size : 0, Width, Height, RenderFormats);
+
+    // Init refuses some frames (e.g. with priv buffers) without taking the buffer
+    if (buffer && (Frame->m_buffer != buffer))
+        pool->ReleaseBuffer(buffer);
+}
+
 /**
  * \class VideoBuffers
  *  This class creates tracks the state of the buffers used by
@@ -128,9 +164,28 @@ static inline void DoDiscard(const std::vector<AVBufferRef *> &Discards)
  *        decoder (in the decode queue) then it is placed in the finished queue
  *        until the decoder is no longer using it (not in the decode queue).
  *
+ *  Software frame buffers are drawn from, and returned to, the process wide
+ *  MythVideoFramePool - so tearing down and recreating the buffers (e.g. on
+ *  a resolution change) does not normally allocate any memory.
+ *
  * \see VideoOutput
  */
 
+VideoBuffers::~VideoBuffers()
+{
+    if (m_freeFrameRequests)
+        LOG(VB_PLAYBACK, LOG_INFO, QString("VideoBuffers: %1").arg(GetAllocationStats()));
+    ReturnBuffers();
+}
+
+/// \brief Return all software frame buffers to the frame pool.
+void VideoBuffers::ReturnBuffers(void)
+{
+    QMutexLocker locker(&m_globalLock);
+    for (auto & frame : m_buffers)
+        ReturnToPool(&frame);
+}
+
 uint VideoBuffers::GetNumBuffers(int PixelFormat, int MaxReferenceFrames, bool Decoder /*=false*/)
 {
     uint refs = static_cast<uint>(MaxReferenceFrames);
@@ -177,6 +232,7 @@ void VideoBuffers::Init(uint NumDecode, uint NeedFree,
     QMutexLocker locker(&m_globalLock);
 
     Reset();
+    ReturnBuffers();
 
     // make a big reservation, so that things that depend on
     // pointer to VideoFrames work even after a few push_backs
@@ -317,11 +373,20 @@ MythVideoFrame *VideoBuffers::GetNextFreeFrameInternal(BufferType EnqueueTo)
  */
 MythVideoFrame *VideoBuffers::GetNextFreeFrame(BufferType EnqueueTo)
 {
+    auto start = std::chrono::steady_clock::now();
     for (uint tries = 1; true; tries++)
     {
         MythVideoFrame *frame = VideoBuffers::GetNextFreeFrameInternal(EnqueueTo);
         if (frame)
+        {
+            auto wait = std::chrono::duration_cast<std::chrono::microseconds>
+                    (std::chrono::steady_clock::now() - start);
+            QMutexLocker locker(&m_globalLock);
+            m_freeFrameRequests++;
+            m_freeFrameWait += wait;
+            m_freeFrameMaxWait = std::max(m_freeFrameMaxWait, wait);
             return frame;
+        }
 
         if (tries >= TRY_LOCK_SPINS)
         {
@@ -954,7 +1019,10 @@ bool VideoBuffers::CreateBuffers(VideoFrameType Type, int Width, int Height, con
     if (MythVideoFrame::HardwareFormat(Type))
     {
         for (uint i = 0; i < Size(); i++)
+        {
+            ReturnToPool(&m_buffers[i]);
             m_buffers[i].Init(Type, Width, Height, m_renderFormats);
+        }
         LOG(VB_PLAYBACK, LOG_INFO, QString("Created %1 empty %2 (%3x%4) video buffers")
            .arg(Size()).arg(MythVideoFrame::FormatDescription(Type)).arg(Width).arg(Height));
         return true;
@@ -963,7 +1031,7 @@ bool VideoBuffers::CreateBuffers(VideoFrameType Type, int Width, int Height, con
     // Software buffers
     for (uint i = 0; i < Size(); i++)
     {
-        m_buffers[i].Init(Type, Width, Height, m_renderFormats);
+        InitFromPool(&m_buffers[i], Type, Width, Height, m_renderFormats);
         m_buffers[i].ClearBufferToBlank();
         success &= m_buffers[i].m_dummy || (m_buffers[i].m_buffer != nullptr);
     }
@@ -997,7 +1065,7 @@ bool VideoBuffers::ReinitBuffer(MythVideoFrame *Frame, VideoFrameType Type, Myth
 
     MythDeintType singler = Frame->m_deinterlaceSingle;
     MythDeintType doubler = Frame->m_deinterlaceDouble;
-    Frame->Init(Type, Width, Height, formats);
+    InitFromPool(Frame, Type, Width, Height, formats);
     Frame->ClearBufferToBlank();
 
     // retain deinterlacer settings and update restrictions based on new frame type
@@ -1007,6 +1075,17 @@ bool VideoBuffers::ReinitBuffer(MythVideoFrame *Frame, VideoFrameType Type, Myth
 
 static unsigned long long to_bitmap(const frame_queue_t& Queue, int Num);
 
+/// \brief Frame pool churn and time spent waiting in GetNextFreeFrame.
+QString VideoBuffers::GetAllocationStats(void) const
+{
+    QMutexLocker locker(&m_globalLock);
+    auto average = m_freeFrameRequests ? (m_freeFrameWait / m_freeFrameRequests) : 0us;
+    return QString("GetNextFreeFrame calls:%1 avg:%2us max:%3us total:%4ms - pool %5")
+        .arg(m_freeFrameRequests).arg(average.count()).arg(m_freeFrameMaxWait.count())
+        .arg(std::chrono::duration_cast<std::chrono::milliseconds>(m_freeFrameWait).count())
+        .arg(MythVideoFramePool::GetPool()->GetStats());
+}
+
 QString VideoBuffers::GetStatus(uint Num) const
 {
     if (Num == 0)
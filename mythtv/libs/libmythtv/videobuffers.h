@@ -2,6 +2,7 @@
 #define VIDEOBUFFERS_H
 
 // Std
+#include <chrono>
 #include <vector>
 #include <map>
 
@@ -39,7 +40,7 @@ class MTV_PUBLIC VideoBuffers
 {
   public:
     VideoBuffers() = default;
-   ~VideoBuffers() = default;
+   ~VideoBuffers();
 
     static uint GetNumBuffers(int PixelFormat, int MaxReferenceFrames = 16, bool Decoder = false);
     void Init(uint NumDecode,
@@ -92,11 +93,13 @@ class MTV_PUBLIC VideoBuffers
     uint  Size(void) const;
 
     QString GetStatus(uint Num = 0) const;
+    QString GetAllocationStats(void) const;
 
   private:
     frame_queue_t       *Queue(BufferType Type);
     const frame_queue_t *Queue(BufferType Type) const;
     MythVideoFrame      *GetNextFreeFrameInternal(BufferType EnqueueTo);
+    void                 ReturnBuffers(void);
     static void          SetDeinterlacingFlags(MythVideoFrame &Frame, MythDeintType Single,
                                                MythDeintType Double, MythCodecID CodecID);
 
@@ -117,6 +120,9 @@ class MTV_PUBLIC VideoBuffers
     uint                 m_needPrebufferFramesSmall  { 0 };
     uint                 m_rpos                      { 0 };
     uint                 m_vpos                      { 0 };
+    uint64_t             m_freeFrameRequests         { 0 };
+    std::chrono::microseconds m_freeFrameWait        { 0us };
+    std::chrono::microseconds m_freeFrameMaxWait     { 0us };
     mutable QRecursiveMutex m_globalLock;
 };
 
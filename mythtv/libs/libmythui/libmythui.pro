@@ -26,7 +26,7 @@ HEADERS += mythuilocation.h
 HEADERS += mythuiscreenbounds.h
 HEADERS += myththemebase.h
 HEADERS += mythpainter_qt.h mythuihelper.h
-HEADERS += mythpaintergpu.h
+HEADERS += mythpaintergpu.h mythglyphcache.h
 HEADERS += mythscreenstack.h mythgesture.h mythuitype.h mythscreentype.h
 HEADERS += mythuiimage.h mythuitext.h mythuistatetype.h  xmlparsebase.h
 HEADERS += mythuibutton.h myththemedmenu.h mythdialogbox.h
@@ -68,7 +68,7 @@ SOURCES += mythuiscreenbounds.cpp
 SOURCES += myththemebase.cpp
 SOURCES += mythrender.cpp
 SOURCES += mythpainter_qt.cpp xmlparsebase.cpp mythuihelper.cpp
-SOURCES += mythpaintergpu.cpp
+SOURCES += mythpaintergpu.cpp mythglyphcache.cpp
 SOURCES += mythscreenstack.cpp mythgesture.cpp mythuitype.cpp mythscreentype.cpp
 SOURCES += mythuiimage.cpp mythuitext.cpp mythuifilebrowser.cpp
 SOURCES += mythuistatetype.cpp mythfontproperties.cpp
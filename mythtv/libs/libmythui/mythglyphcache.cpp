@@ -0,0 +1,219 @@
+// C++
+#include <algorithm>
+
+// Qt
+#include <QGlyphRun>
+#include <QPainter>
+#include <QPainterPath>
+#include <QRawFont>
+
+// MythTV
+#include "libmythbase/mythlogging.h"
+#include "mythglyphcache.h"
+#include "mythimage.h"
+#include "mythpainter.h"
+
+#define LOC QString("GlyphCache: ")
+
+// Font ids and outline widths share the top of the 64 bit glyph key
+static constexpr int kMaxFonts { 1024 };
+
+MythGlyphCache::MythGlyphCache(MythPainter *Painter)
+  : m_painter(Painter)
+{
+}
+
+MythGlyphCache::~MythGlyphCache()
+{
+    Reset();
+}
+
+/// Release all pages and forget every glyph.
+void MythGlyphCache::Reset(void)
+{
+    for (auto & page : m_pages)
+        page.m_image->DecrRef();
+    m_pages.clear();
+    m_glyphs.clear();
+    m_fonts.clear();
+    m_generation++;
+}
+
+/// Empty the pages, but keep them for the glyphs that are drawn next.
+void MythGlyphCache::Recycle(void)
+{
+    LOG(VB_GUI, LOG_DEBUG, LOC + QString("%1 pages full, starting over with %2 glyphs")
+        .arg(m_pages.size()).arg(m_glyphs.size()));
+
+    for (auto & page : m_pages)
+    {
+        page.m_image->fill(Qt::transparent);
+        page.m_image->SetChanged();
+        page.m_shelfX = 0;
+        page.m_shelfY = 0;
+        page.m_shelfHeight = 0;
+    }
+    m_glyphs.clear();
+    m_generation++;
+}
+
+quint64 MythGlyphCache::MakeKey(int Font, quint32 Index, QRgb Color, int Outline)
+{
+    return (static_cast<quint64>(Font)    << 54) |
+           (static_cast<quint64>(Outline) << 48) |
+           (static_cast<quint64>(Index)   << 32) | Color;
+}
+
+int MythGlyphCache::FontId(const QRawFont &Font)
+{
+    QString name = QString("%1/%2/%3/%4/%5").arg(Font.familyName(), Font.styleName())
+        .arg(Font.pixelSize()).arg(Font.weight()).arg(static_cast<int>(Font.style()));
+
+    auto it = m_fonts.constFind(name);
+    if (it != m_fonts.constEnd())
+        return *it;
+
+    if (m_fonts.size() >= kMaxFonts)
+    {
+        Recycle();
+        m_fonts.clear();
+    }
+    int id = static_cast<int>(m_fonts.size());
+    m_fonts.insert(name, id);
+    return id;
+}
+
+/*! \brief Find the glyph in the cache, rendering it first if necessary.
+ *
+ * \return false if the glyph can not be cached, in which case the text has
+ *         to be drawn some other way. A glyph without any pixels, such as a
+ *         space, is returned without a page.
+ */
+bool MythGlyphCache::GetGlyph(const QRawFont &Font, quint32 Index, QRgb Color,
+                              int Outline, Glyph &Result)
+{
+    if (Index > 0xffff || Outline < 0 || Outline > kMaxOutline)
+        return false;
+
+    int font = FontId(Font);
+    quint64 key = MakeKey(font, Index, Color, Outline);
+    auto it = m_glyphs.constFind(key);
+    if (it != m_glyphs.constEnd())
+    {
+        Result = *it;
+        return true;
+    }
+
+    Glyph glyph;
+    QImage image = Render(Font, Index, Color, Outline, glyph.m_offset);
+    if (!image.isNull())
+    {
+        if (!Allocate(image.size(), glyph))
+        {
+            Recycle();
+            if (!Allocate(image.size(), glyph))
+                return false;
+        }
+
+        QPainter painter(glyph.m_page);
+        painter.setCompositionMode(QPainter::CompositionMode_Source);
+        painter.drawImage(glyph.m_source.topLeft(), image);
+        painter.end();
+        glyph.m_page->AddChangedArea(glyph.m_source);
+    }
+
+    m_glyphs.insert(key, glyph);
+    Result = glyph;
+    return true;
+}
+
+/// Find room for a glyph on the shelves of the pages, adding a page if needed.
+bool MythGlyphCache::Allocate(QSize Size, Glyph &Result)
+{
+    // Keep a transparent pixel between glyphs so that scaled and filtered
+    // draws do not pick up their neighbours
+    int width  = Size.width() + 1;
+    int height = Size.height() + 1;
+    if (width > kPageSize || height > kPageSize)
+        return false;
+
+    for (;;)
+    {
+        for (auto & page : m_pages)
+        {
+            int x = page.m_shelfX;
+            int y = page.m_shelfY;
+            int shelf = page.m_shelfHeight;
+            if (x + width > kPageSize)
+            {
+                x = 0;
+                y += shelf;
+                shelf = 0;
+            }
+            if (y + height > kPageSize)
+                continue;
+
+            page.m_shelfX = x + width;
+            page.m_shelfY = y;
+            page.m_shelfHeight = std::max(shelf, height);
+            Result.m_page = page.m_image;
+            Result.m_source = QRect(QPoint(x, y), Size);
+            return true;
+        }
+
+        if (static_cast<int>(m_pages.size()) >= kMaxPages)
+            return false;
+
+        QImage blank(kPageSize, kPageSize, QImage::Format_ARGB32_Premultiplied);
+        blank.fill(Qt::transparent);
+        Page page;
+        page.m_image = m_painter->GetFormatImage();
+        page.m_image->SetFileName(QString("MythGlyphCache page %1").arg(m_pages.size()));
+        page.m_image->Assign(blank);
+        m_pages.push_back(page);
+    }
+}
+
+/// Render a glyph, Offset is set to its top left relative to the pen position.
+QImage MythGlyphCache::Render(const QRawFont &Font, quint32 Index, QRgb Color,
+                              int Outline, QPoint &Offset)
+{
+    QRectF bounds = Font.boundingRect(Index);
+    if (bounds.isEmpty())
+        return {};
+
+    // Room for antialiasing and the outline pen
+    int pad = Outline + 1;
+    QRect area = bounds.toAlignedRect().adjusted(-pad, -pad, pad, pad);
+    Offset = area.topLeft();
+
+    QImage image(area.size(), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    QPointF origin(-area.x(), -area.y());
+    QColor color = QColor::fromRgba(Color);
+
+    if (Outline > 0)
+    {
+        QPainterPath path = Font.pathForGlyph(Index);
+        path.translate(origin);
+        QPen pen(color);
+        pen.setWidth((Outline * 2) + 1);
+        pen.setCapStyle(Qt::RoundCap);
+        pen.setJoinStyle(Qt::RoundJoin);
+        painter.strokePath(path, pen);
+    }
+    else
+    {
+        QGlyphRun run;
+        run.setRawFont(Font);
+        run.setGlyphIndexes({ Index });
+        run.setPositions({ origin });
+        painter.setPen(color);
+        painter.drawGlyphRun(QPointF(), run);
+    }
+    painter.end();
+    return image;
+}
@@ -0,0 +1,81 @@
+#ifndef MYTHGLYPHCACHE_H
+#define MYTHGLYPHCACHE_H
+
+// C++
+#include <cstdint>
+#include <vector>
+
+// Qt
+#include <QColor>
+#include <QHash>
+#include <QImage>
+#include <QPoint>
+#include <QRect>
+#include <QString>
+
+class QRawFont;
+class MythImage;
+class MythPainter;
+
+/*! \brief Rasterised glyphs packed into a few painter images.
+ *
+ * Text used to be drawn into an image per string, so every new string (a
+ * scrolling guide shows hundreds of them) cost a full QPainter text render,
+ * a large allocation and a texture upload. The glyph cache renders each
+ * glyph once per font, colour and outline width into an atlas page, and
+ * text is then drawn as one small image per glyph from those pages.
+ *
+ * Pages are ordinary painter images, so the painters upload and draw them
+ * like any other image. A page that got new glyphs is marked as changed and
+ * is uploaded again the next time it is drawn. When all pages are full the
+ * cache starts over; GetGeneration() tells callers that glyphs looked up
+ * earlier are no longer valid.
+ */
+class MythGlyphCache
+{
+  public:
+    struct Glyph
+    {
+        MythImage *m_page   { nullptr };
+        QRect      m_source;    ///< area of the page holding the glyph
+        QPoint     m_offset;    ///< from the pen position to the top left
+    };
+
+    explicit MythGlyphCache(MythPainter *Painter);
+   ~MythGlyphCache();
+
+    bool     GetGlyph(const QRawFont &Font, quint32 Index, QRgb Color,
+                      int Outline, Glyph &Result);
+    uint64_t GetGeneration(void) const { return m_generation; }
+    void     Reset(void);
+
+    static constexpr int kPageSize { 512 };
+    static constexpr int kMaxPages { 8 };
+    static constexpr int kMaxOutline { 63 };
+
+  private:
+    Q_DISABLE_COPY(MythGlyphCache)
+
+    struct Page
+    {
+        MythImage *m_image       { nullptr };
+        int        m_shelfX      { 0 };
+        int        m_shelfY      { 0 };
+        int        m_shelfHeight { 0 };
+    };
+
+    static quint64 MakeKey(int Font, quint32 Index, QRgb Color, int Outline);
+    int  FontId(const QRawFont &Font);
+    bool Allocate(QSize Size, Glyph &Result);
+    void Recycle(void);
+    static QImage Render(const QRawFont &Font, quint32 Index, QRgb Color,
+                         int Outline, QPoint &Offset);
+
+    MythPainter          *m_painter    { nullptr };
+    std::vector<Page>     m_pages;
+    QHash<quint64, Glyph> m_glyphs;
+    QHash<QString, int>   m_fonts;
+    uint64_t              m_generation { 0 };
+};
+
+#endif // MYTHGLYPHCACHE_H
@@ -67,6 +67,18 @@ int MythImage::DecrRef(void)
     return cnt;
 }
 
+/// Marks just Area as changed, so painters that keep a texture can
+/// update that part of it rather than the whole image.
+void MythImage::AddChangedArea(QRect area)
+{
+    // Already changed in full
+    bool whole = m_changed && m_changedArea.isNull();
+    QRect changed = m_changed ? m_changedArea.united(area) : area;
+    SetChanged();
+    if (!whole)
+        m_changedArea = changed;
+}
+
 void MythImage::SetIsInCache(bool bCached)
 {
     IncrRef();
@@ -47,8 +47,12 @@ class MUI_PUBLIC MythImage : public QImage, public ReferenceCounter
     int IncrRef(void) override; // ReferenceCounter
     int DecrRef(void) override; // ReferenceCounter
 
-    virtual void SetChanged(bool change = true) { m_changed = change; }
+    virtual void SetChanged(bool change = true) { m_changed = change; m_changedArea = QRect(); }
     bool IsChanged() const { return m_changed; }
+    void AddChangedArea(QRect area);
+    /// The part of the image changed since SetChanged(false), all of it
+    /// unless only AddChangedArea() was used.
+    QRect GetChangedArea() const { return m_changedArea.isNull() ? rect() : m_changedArea; }
 
     bool IsGradient() const { return m_isGradient; }
     bool IsReflected() const { return m_isReflected; }
@@ -108,6 +112,7 @@ class MUI_PUBLIC MythImage : public QImage, public ReferenceCounter
                              FillDirection direction = FillDirection::TopToBottom);
 
     bool           m_changed       {false};
+    QRect          m_changedArea;
     MythPainter   *m_parent        {nullptr};
 
     bool           m_isGradient    {false};
@@ -1,8 +1,10 @@
 #include <algorithm>
+#include <cmath>
 #include <complex>
 #include <cstdint>
 
 // QT headers
+#include <QRawFont>
 #include <QRect>
 #include <QPainter>
 #include <QPainterPath>
@@ -13,12 +15,16 @@
 
 // libmythui headers
 #include "mythfontproperties.h"
+#include "mythglyphcache.h"
 #include "mythimage.h"
 #include "mythuianimation.h"    // UIEffects
 
 // Own header
 #include "mythpainter.h"
 
+// Larger text is rare and is left to the per string images
+static constexpr int kMaxGlyphPixelSize { 200 };
+
 MythPainter::MythPainter()
 {
     SetMaximumCacheSizes(64, 48);
@@ -28,6 +34,9 @@ void MythPainter::Teardown(void)
 {
     ExpireImages(0);
 
+    delete m_glyphCache;
+    m_glyphCache = nullptr;
+
     QMutexLocker locker(&m_allocationLock);
 
     if (!m_allocatedImages.isEmpty())
@@ -72,10 +81,26 @@ void MythPainter::DrawImage(const QPoint topLeft, MythImage *im, int alpha)
     DrawImage(topLeft.x(), topLeft.y(), im, alpha);
 }
 
+/*! \brief Compose text from cached glyphs instead of per string images.
+ *
+ * For painters that can draw many small images cheaply. Set
+ * MYTHTV_NO_GLYPH_CACHE to always render text into images.
+ */
+void MythPainter::EnableGlyphCache(void)
+{
+    if (m_glyphCache || qEnvironmentVariableIsSet("MYTHTV_NO_GLYPH_CACHE"))
+        return;
+    m_glyphCache = new MythGlyphCache(this);
+    LOG(VB_GUI, LOG_INFO, "MythPainter: Drawing text from the glyph cache");
+}
+
 void MythPainter::DrawText(const QRect r, const QString &msg,
                            int flags, const MythFontProperties &font,
                            int alpha, const QRect boundRect)
 {
+    if (DrawTextGlyphs(r, msg, flags, font, alpha, boundRect))
+        return;
+
     MythImage *im = GetImageFromString(msg, flags, r, font);
     if (!im)
         return;
@@ -128,6 +153,10 @@ void MythPainter::DrawTextLayout(const QRect canvasRect,
     if (canvasRect.isNull())
         return;
 
+    if (DrawTextLayoutGlyphs(canvasRect, layouts, formats, font, alpha,
+                             destRect))
+        return;
+
     QRect      canvas(canvasRect);
     QRect      dest(destRect);
 
@@ -153,6 +182,208 @@ void MythPainter::DrawTextLayout(const QRect canvasRect,
     im->DecrRef();
 }
 
+/// DrawText() from the glyph cache, with the text placed as DrawTextPriv() does.
+bool MythPainter::DrawTextGlyphs(const QRect r, const QString &msg, int flags,
+                                 const MythFontProperties &font, int alpha,
+                                 const QRect boundRect)
+{
+    if (!m_glyphCache || msg.isEmpty() || (flags & Qt::TextShowMnemonic) ||
+        msg.contains('\t') || font.GetBrush().style() != Qt::SolidPattern)
+        return false;
+
+    QColor outlineColor;
+    int outlineSize = 0;
+    int outlineAlpha = 255;
+    if (font.hasOutline())
+        font.GetOutline(outlineColor, outlineSize, outlineAlpha);
+
+    QPoint shadowOffset(0, 0);
+    QColor shadowColor;
+    int shadowAlpha = 255;
+    if (font.hasShadow())
+        font.GetShadow(shadowOffset, shadowColor, shadowAlpha);
+
+    QFont face = font.face();
+    QFontMetrics fm(face);
+    int totalHeight = fm.height() + outlineSize +
+        std::max(outlineSize, std::abs(shadowOffset.y()));
+    int paddingY = (flags & Qt::TextWordWrap) ? 0 : (r.height() - totalHeight) / 2;
+    QPoint textOffset(std::max(outlineSize, -shadowOffset.x()),
+                      paddingY + std::max(outlineSize, -shadowOffset.y()));
+
+    // Break the lines the way QPainter::drawText() does
+    QString text = msg;
+    text.replace('\n', QChar::LineSeparator);
+    QTextLayout layout(text, face);
+    QTextOption option;
+    bool wrap = (flags & (Qt::TextWordWrap | Qt::TextWrapAnywhere)) != 0;
+    if (flags & Qt::TextWordWrap)
+        option.setWrapMode(QTextOption::WordWrap);
+    else if (flags & Qt::TextWrapAnywhere)
+        option.setWrapMode(QTextOption::WrapAnywhere);
+    else
+        option.setWrapMode(QTextOption::ManualWrap);
+    layout.setTextOption(option);
+
+    qreal leading = fm.leading();
+    qreal height = -leading;
+    layout.beginLayout();
+    for (QTextLine line = layout.createLine(); line.isValid();
+         line = layout.createLine())
+    {
+        line.setLineWidth(wrap ? r.width() : 0x01000000);
+        height = std::ceil(height + leading);
+        line.setPosition(QPointF(0, height));
+        height += line.ascent() + line.descent();
+    }
+    layout.endLayout();
+
+    qreal offsetY = 0;
+    if (flags & Qt::AlignBottom)
+        offsetY = r.height() - height;
+    else if (flags & Qt::AlignVCenter)
+        offsetY = (r.height() - height) / 2;
+
+    GlyphRuns runs;
+    QPointF origin = QPointF(r.topLeft() + textOffset) + QPointF(0, offsetY);
+    for (int i = 0; i < layout.lineCount(); ++i)
+    {
+        QTextLine line = layout.lineAt(i);
+        qreal offsetX = 0;
+        if (flags & Qt::AlignRight)
+            offsetX = r.width() - line.naturalTextWidth();
+        else if (flags & Qt::AlignHCenter)
+            offsetX = (r.width() - line.naturalTextWidth()) / 2;
+        runs.emplace_back(origin + QPointF(offsetX, 0), line.glyphRuns());
+    }
+
+    std::vector<GlyphPass> passes;
+    if (font.hasShadow())
+    {
+        shadowColor.setAlpha(shadowAlpha);
+        passes.push_back({ shadowOffset, shadowColor.rgba(), 0 });
+    }
+    if (font.hasOutline())
+    {
+        outlineColor.setAlpha(outlineAlpha);
+        passes.push_back({ QPoint(), outlineColor.rgba(), outlineSize });
+    }
+    passes.push_back({ QPoint(), font.color().rgba(), 0 });
+
+    // The image would have been clipped to r, and then drawn within boundRect
+    QRect clip = boundRect.isEmpty() ? r : r.intersected(boundRect);
+    return DrawGlyphRuns(runs, passes, clip, alpha);
+}
+
+/// DrawTextLayout() from the glyph cache for layouts without formatting.
+bool MythPainter::DrawTextLayoutGlyphs(const QRect canvas,
+                                       const LayoutVector &layouts,
+                                       const FormatVector &formats,
+                                       const MythFontProperties &font,
+                                       int alpha, const QRect dest)
+{
+    // Outlines and font changes come as formats, leave those to the image
+    if (!m_glyphCache || !formats.isEmpty() ||
+        font.GetBrush().style() != Qt::SolidPattern)
+        return false;
+
+    GlyphRuns runs;
+    QPointF origin(dest.topLeft() + canvas.topLeft());
+    for (auto *layout : std::as_const(layouts))
+    {
+        if (!layout->formats().isEmpty())
+            return false;
+        runs.emplace_back(origin + layout->position(), layout->glyphRuns());
+    }
+
+    std::vector<GlyphPass> passes;
+    if (font.hasShadow())
+    {
+        QPoint shadowOffset;
+        QColor shadowColor;
+        int    shadowAlpha = 255;
+        font.GetShadow(shadowOffset, shadowColor, shadowAlpha);
+        shadowColor.setAlpha(shadowAlpha);
+
+        MythPoint shadow(shadowOffset);
+        shadow.NormPoint(); // scale it to screen resolution
+        passes.push_back({ QPoint(shadow.x(), shadow.y()), shadowColor.rgba(), 0 });
+    }
+    passes.push_back({ QPoint(), font.color().rgba(), 0 });
+
+    // The image is canvas sized, and at most dest of it is shown
+    QRect clip(dest.topLeft(), canvas.size().boundedTo(dest.size()));
+    return DrawGlyphRuns(runs, passes, clip, alpha);
+}
+
+/// Draw each pass over all of the runs, clipped to clip.
+bool MythPainter::DrawGlyphRuns(const GlyphRuns &runs,
+                                const std::vector<GlyphPass> &passes,
+                                const QRect clip, int alpha)
+{
+    if (clip.isEmpty())
+        return true;
+
+    // A glyph that does not fit empties the cache, so the glyphs found
+    // before it are gone. Once the cache has started over the text fits,
+    // or it never will.
+    std::vector<GlyphQuad> quads;
+    bool ready = false;
+    for (int attempt = 0; attempt < 2 && !ready; ++attempt)
+    {
+        uint64_t generation = m_glyphCache->GetGeneration();
+        quads.clear();
+        for (const auto & pass : passes)
+            if (!AddGlyphs(quads, runs, pass))
+                return false;
+        ready = generation == m_glyphCache->GetGeneration();
+    }
+    if (!ready)
+        return false;
+
+    for (const auto & quad : quads)
+    {
+        QRect dest = quad.m_dest.intersected(clip);
+        if (dest.isEmpty())
+            continue;
+        QRect src(quad.m_source.topLeft() + (dest.topLeft() - quad.m_dest.topLeft()),
+                  dest.size());
+        DrawImage(dest, quad.m_page, src, alpha);
+    }
+    return true;
+}
+
+bool MythPainter::AddGlyphs(std::vector<GlyphQuad> &quads,
+                            const GlyphRuns &runs, const GlyphPass &pass)
+{
+    for (const auto & [origin, list] : runs)
+    {
+        for (const auto & run : list)
+        {
+            QRawFont rawFont = run.rawFont();
+            if (rawFont.pixelSize() > kMaxGlyphPixelSize)
+                return false;
+
+            const auto indexes = run.glyphIndexes();
+            const auto positions = run.positions();
+            for (int i = 0; i < indexes.size(); ++i)
+            {
+                MythGlyphCache::Glyph glyph;
+                if (!m_glyphCache->GetGlyph(rawFont, indexes[i], pass.m_color,
+                                            pass.m_outline, glyph))
+                    return false;
+                if (!glyph.m_page)
+                    continue;
+
+                QPoint pen = (origin + positions[i]).toPoint() + pass.m_offset;
+                quads.push_back({ glyph.m_page, glyph.m_source,
+                                  QRect(pen + glyph.m_offset, glyph.m_source.size()) });
+            }
+        }
+    }
+    return true;
+}
+
 void MythPainter::DrawRect(const QRect area, const QBrush &fillBrush,
                            const QPen &linePen, int alpha)
 {
@@ -340,26 +571,14 @@ MythImage *MythPainter::GetImageFromString(const QString &msg,
                        QString::number(flags) +
                        QString::number(font.color().rgba()) + msg;
 
-    MythImage *im = nullptr;
-    if (m_stringToImageMap.contains(incoming))
-    {
-        m_stringExpireList.remove(incoming);
-        m_stringExpireList.push_back(incoming);
-        im = m_stringToImageMap.value(incoming);
-        if (im)
-            im->IncrRef();
-    }
-    else
+    MythImage *im = GetCachedImage(incoming);
+    if (!im)
     {
         im = GetFormatImage();
         im->SetFileName(QString("GetImageFromString: %1").arg(msg));
         DrawTextPriv(im, msg, flags, r, font);
 
-        im->IncrRef();
-        m_softwareCacheSize += im->GetSize();
-        m_stringToImageMap[incoming] = im;
-        m_stringExpireList.push_back(incoming);
-        ExpireImages(m_maxSoftwareCacheSize);
+        CacheImage(incoming, im);
     }
     return im;
 }
@@ -380,16 +599,8 @@ MythImage *MythPainter::GetImageFromTextLayout(const LayoutVector &layouts,
     for (auto *layout : std::as_const(layouts))
         incoming += layout->text();
 
-    MythImage *im = nullptr;
-    if (m_stringToImageMap.contains(incoming))
-    {
-        m_stringExpireList.remove(incoming);
-        m_stringExpireList.push_back(incoming);
-        im = m_stringToImageMap.value(incoming);
-        if (im)
-            im->IncrRef();
-    }
-    else
+    MythImage *im = GetCachedImage(incoming);
+    if (!im)
     {
         im = GetFormatImage();
         im->SetFileName("GetImageFromTextLayout");
@@ -444,11 +655,7 @@ MythImage *MythPainter::GetImageFromTextLayout(const LayoutVector &layouts,
         pm.setOffset(canvas.topLeft());
         im->Assign(pm.copy(0, 0, dest.width(), dest.height()));
 
-        im->IncrRef();
-        m_softwareCacheSize += im->GetSize();
-        m_stringToImageMap[incoming] = im;
-        m_stringExpireList.push_back(incoming);
-        ExpireImages(m_maxSoftwareCacheSize);
+        CacheImage(incoming, im);
     }
     return im;
 }
@@ -497,30 +704,42 @@ MythImage* MythPainter::GetImageFromRect(const QRect area, int radius,
 
     incoming += QString::number(hash1) + QString::number(hash2);
 
-    MythImage *im = nullptr;
-    if (m_stringToImageMap.contains(incoming))
-    {
-        m_stringExpireList.remove(incoming);
-        m_stringExpireList.push_back(incoming);
-        im = m_stringToImageMap.value(incoming);
-        if (im)
-            im->IncrRef();
-    }
-    else
+    MythImage *im = GetCachedImage(incoming);
+    if (!im)
     {
         im = GetFormatImage();
         im->SetFileName("GetImageFromRect");
         DrawRectPriv(im, area, radius, ellipse, fillBrush, linePen);
 
-        im->IncrRef();
-        m_softwareCacheSize += im->GetSize();
-        m_stringToImageMap[incoming] = im;
-        m_stringExpireList.push_back(incoming);
-        ExpireImages(m_maxSoftwareCacheSize);
+        CacheImage(incoming, im);
     }
     return im;
 }
 
+/// Look up a cached image and mark it as the most recently used.
+/// \note The image is returned with a new reference, call DecrRef() when done.
+MythImage *MythPainter::GetCachedImage(const QString &key)
+{
+    auto it = m_stringToImageMap.find(key);
+    if (it == m_stringToImageMap.end())
+        return nullptr;
+
+    m_stringExpireList.splice(m_stringExpireList.end(), m_stringExpireList,
+                              it->m_expire);
+    if (it->m_image)
+        it->m_image->IncrRef();
+    return it->m_image;
+}
+
+void MythPainter::CacheImage(const QString &key, MythImage *im)
+{
+    im->IncrRef();
+    m_softwareCacheSize += im->GetSize();
+    m_stringExpireList.push_back(key);
+    m_stringToImageMap.insert(key, { im, std::prev(m_stringExpireList.end()) });
+    ExpireImages(m_maxSoftwareCacheSize);
+}
+
 MythImage *MythPainter::GetFormatImage(void)
 {
     QMutexLocker locker(&m_allocationLock);
@@ -558,15 +777,14 @@ void MythPainter::ExpireImages(int64_t max)
         QString oldmsg = m_stringExpireList.front();
         m_stringExpireList.pop_front();
 
-        QMap<QString, MythImage*>::iterator it =
-            m_stringToImageMap.find(oldmsg); // clazy:exclude=detaching-member (erases item)
+        auto it = m_stringToImageMap.find(oldmsg); // clazy:exclude=detaching-member (erases item)
         if (it == m_stringToImageMap.end())
         {
             recompute = true;
             continue;
         }
-        MythImage *oldim = *it;
-        it = m_stringToImageMap.erase(it);
+        MythImage *oldim = it->m_image;
+        m_stringToImageMap.erase(it);
 
         if (oldim)
         {
@@ -582,8 +800,8 @@ void MythPainter::ExpireImages(int64_t max)
     if (recompute)
     {
         m_softwareCacheSize = 0;
-        for (auto *img : std::as_const(m_stringToImageMap))
-            m_softwareCacheSize += img->GetSize();
+        for (const auto & cached : std::as_const(m_stringToImageMap))
+            m_softwareCacheSize += cached.m_image->GetSize();
     }
 }
 
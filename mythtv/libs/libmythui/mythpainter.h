@@ -1,6 +1,8 @@
 #ifndef MYTHPAINTER_H_
 #define MYTHPAINTER_H_
 
+#include <QGlyphRun>
+#include <QHash>
 #include <QMap>
 #include <QString>
 #include <QTextLayout>
@@ -19,8 +21,11 @@ class QColor;
 #include <cstdint>
 #include <list>
 #include <memory>
+#include <utility>
+#include <vector>
 
 class MythFontProperties;
+class MythGlyphCache;
 class MythImage;
 class UIEffects;
 
@@ -128,20 +133,62 @@ class MUI_PUBLIC MythPainter : public QObject
 
     void CheckFormatImage(MythImage *im);
 
+    void EnableGlyphCache(void);
+
     float m_frameTime { 0 };
 
     int m_hardwareCacheSize     { 0 };
     int m_maxHardwareCacheSize  { 0 };
 
   private:
+    struct CachedImage
+    {
+        MythImage                   *m_image { nullptr };
+        std::list<QString>::iterator m_expire;
+    };
+
+    struct GlyphPass
+    {
+        QPoint m_offset;
+        QRgb   m_color   { 0 };
+        int    m_outline { 0 };
+    };
+
+    struct GlyphQuad
+    {
+        MythImage *m_page { nullptr };
+        QRect      m_source;
+        QRect      m_dest;
+    };
+
+    using GlyphRuns = std::vector<std::pair<QPointF, QList<QGlyphRun>>>;
+
+    MythImage *GetCachedImage(const QString &key);
+    void CacheImage(const QString &key, MythImage *im);
+
+    bool DrawTextGlyphs(QRect r, const QString &msg, int flags,
+                        const MythFontProperties &font, int alpha,
+                        QRect boundRect);
+    bool DrawTextLayoutGlyphs(QRect canvas, const LayoutVector &layouts,
+                              const FormatVector &formats,
+                              const MythFontProperties &font, int alpha,
+                              QRect dest);
+    bool DrawGlyphRuns(const GlyphRuns &runs,
+                       const std::vector<GlyphPass> &passes,
+                       QRect clip, int alpha);
+    bool AddGlyphs(std::vector<GlyphQuad> &quads, const GlyphRuns &runs,
+                   const GlyphPass &pass);
+
     int64_t m_softwareCacheSize {0};
     int64_t m_maxSoftwareCacheSize {48LL * 1024 * 1024};
 
     QMutex           m_allocationLock;
     QSet<MythImage*> m_allocatedImages;
 
-    QMap<QString, MythImage *> m_stringToImageMap;
-    std::list<QString>         m_stringExpireList;
+    QHash<QString, CachedImage> m_stringToImageMap;
+    std::list<QString>          m_stringExpireList;
+
+    MythGlyphCache *m_glyphCache { nullptr };
 
     bool m_showBorders          {false};
     bool m_showNames            {false};
@@ -52,6 +52,11 @@ void MythQtImage::RegeneratePixmap(void)
     }
 }
 
+MythQtPainter::MythQtPainter()
+{
+    EnableGlyphCache();
+}
+
 MythQtPainter::~MythQtPainter()
 {
     Teardown();
@@ -12,6 +12,7 @@
 
 // libmythbase headers
 #include "libmythbase/lcddevice.h"
+#include "libmythbase/mythdb.h"
 #include "libmythbase/mythlogging.h"
 
 // mythui headers
@@ -68,6 +69,10 @@ void MythUIButtonList::Const(void)
 
 MythUIButtonList::~MythUIButtonList()
 {
+    if (m_prefetchGeneration)
+        m_prefetchGeneration->fetchAndAddRelaxed(1);
+    ReportScrollStats();
+
     m_buttonToItem.clear();
     m_clearing = true;
 
@@ -133,6 +138,9 @@ void MythUIButtonList::Reset()
 
     m_selPosition = 0;
     m_topPosition = 0;
+    m_prefetchSelPosition = -1;
+    if (m_prefetchGeneration)
+        m_prefetchGeneration->fetchAndAddRelaxed(1);
     m_itemCount   = 0;
 
     StopLoad();
@@ -1461,6 +1469,8 @@ void MythUIButtonList::CalculateArrowStates()
         DistributeButtons();
 
     updateLCD();
+    UpdateScrollStats(true);
+    Prefetch();
 
     m_needsUpdate = false;
 
@@ -1495,6 +1505,150 @@ void MythUIButtonList::ItemVisible(MythUIButtonListItem *item)
         emit itemVisible(item);
 }
 
+/**
+ *  \brief Decode images for the next \p pages pages of items, in the
+ *         direction of scrolling, in the background.
+ *
+ *  Images are loaded into the image cache with the properties of the images
+ *  in the button template so that they are ready by the time their items are
+ *  scrolled into view. itemPrefetch is emitted for each upcoming item first,
+ *  giving the screen a chance to set image filenames lazily. Work queued for
+ *  an earlier position is dropped once the list moves on, and the total of
+ *  all outstanding background loads is limited to half of the image cache.
+ *  0 disables.
+ */
+void MythUIButtonList::SetPrefetchPages(int pages)
+{
+    m_prefetchPages = std::max(pages, 0);
+    if (m_prefetchPages && !m_prefetchGeneration)
+        m_prefetchGeneration = std::make_shared<QAtomicInt>(0);
+    m_prefetchBudget = GetMythDB()->GetNumSetting("UIImageCacheSize", 30) * 1024LL * 1024 / 2;
+}
+
+void MythUIButtonList::Prefetch(void)
+{
+    if (m_prefetchPages <= 0 || m_itemCount <= m_itemsVisible ||
+        m_itemsVisible <= 0 || m_buttonList.empty() || !m_buttonList[0])
+        return;
+
+    if (m_selPosition == m_prefetchSelPosition)
+        return;
+
+    int direction = m_selPosition < m_prefetchSelPosition ? -1 : 1;
+    m_prefetchSelPosition = m_selPosition;
+
+    // Anything still queued for the previous position is now stale
+    m_prefetchGeneration->fetchAndAddRelaxed(1);
+
+    auto *state = dynamic_cast<MythUIGroup *>(m_buttonList[0]->GetState("active"));
+    if (!state)
+        return;
+
+    QHash<QString, MythUIImage *> templates;
+    const QList<MythUIType *> descendants = state->GetAllDescendants();
+    for (MythUIType *obj : descendants)
+    {
+        auto *image = dynamic_cast<MythUIImage *>(obj);
+        if (image && obj->objectName() != "buttonarrow")
+            templates.insert(obj->objectName(), image);
+    }
+
+    if (templates.isEmpty())
+        return;
+
+    bool wrap  = m_wrapStyle > WrapNone;
+    int  count = std::min(m_prefetchPages * m_itemsVisible,
+                          m_itemCount - m_itemsVisible);
+    int  pos   = (direction > 0)
+        ? std::max(m_topPosition + m_itemsVisible, m_selPosition + 1)
+        : std::min(m_topPosition, m_selPosition) - 1;
+    // Loads already queued or running, including those for visible items,
+    // count against the budget too
+    qint64 budget = m_prefetchBudget - MythUIImage::OutstandingLoadBytes();
+
+    for (int i = 0; i < count && budget > 0; ++i, pos += direction)
+    {
+        if (wrap)
+            pos = (pos + m_itemCount) % m_itemCount;
+        else if (pos < 0 || pos >= m_itemCount)
+            break;
+
+        MythUIButtonListItem *item = m_itemList.at(pos);
+        if (!item)
+            continue;
+
+        emit itemPrefetch(item);
+
+        for (auto it = templates.cbegin(); it != templates.cend(); ++it)
+        {
+            QString filename = item->GetImageFilename(it.key());
+            if (filename.isEmpty() && it.key() == "buttonimage")
+                filename = item->GetImageFilename();
+            budget -= it.value()->Prefetch(filename, m_prefetchGeneration);
+        }
+    }
+}
+
+/**
+ *  \brief Track frame times while the list is being scrolled.
+ *
+ *  A scroll starts with the first move after the list has been idle for a
+ *  second and its statistics are logged when the next one starts, or when the
+ *  list is destroyed.
+ */
+void MythUIButtonList::UpdateScrollStats(bool moved)
+{
+    static constexpr std::chrono::microseconds kScrollIdle { 1s };
+    static constexpr std::chrono::microseconds kSlowFrame  { 34ms };
+
+    auto now = nowAsDuration<std::chrono::microseconds>();
+    ScrollStats &stats = m_scrollStats;
+    bool scrolling = stats.m_lastMove > 0us && (now - stats.m_lastMove) < kScrollIdle;
+
+    if (moved)
+    {
+        if (m_selPosition == stats.m_lastSelPosition)
+            return;
+
+        if (!scrolling)
+        {
+            ReportScrollStats();
+            stats = ScrollStats();
+            stats.m_lastFrame = now;
+        }
+        stats.m_lastSelPosition = m_selPosition;
+        stats.m_lastMove = now;
+        stats.m_moves++;
+        return;
+    }
+
+    if (!scrolling)
+        return;
+
+    auto frame = now - stats.m_lastFrame;
+    stats.m_lastFrame = now;
+    stats.m_totalTime += frame;
+    stats.m_maxFrame = std::max(stats.m_maxFrame, frame);
+    stats.m_frames++;
+    if (frame > kSlowFrame)
+        stats.m_slowFrames++;
+}
+
+void MythUIButtonList::ReportScrollStats(void)
+{
+    const ScrollStats &stats = m_scrollStats;
+    if (stats.m_moves < 2 || stats.m_frames < 1)
+        return;
+
+    LOG(VB_GUI, LOG_INFO, LOC +
+        QString("Scrolled %1 items in %2 frames: average %3ms, max %4ms, "
+                "%5 slow frames")
+        .arg(stats.m_moves).arg(stats.m_frames)
+        .arg(stats.m_totalTime.count() / 1000.0 / stats.m_frames, 0, 'f', 1)
+        .arg(stats.m_maxFrame.count() / 1000.0, 0, 'f', 1)
+        .arg(stats.m_slowFrames));
+}
+
 void MythUIButtonList::InsertItem(MythUIButtonListItem *item, int listPosition)
 {
     bool wasEmpty = m_itemList.isEmpty();
@@ -3040,6 +3194,8 @@ bool MythUIButtonList::ParseElement(
 void MythUIButtonList::DrawSelf(MythPainter * /*p*/, int /*xoffset*/, int /*yoffset*/,
                                 int /*alphaMod*/, QRect /*clipRect*/)
 {
+    UpdateScrollStats(false);
+
     if (m_needsUpdate)
     {
         CalculateArrowStates();
@@ -1,6 +1,7 @@
 #ifndef MYTHUIBUTTONLIST_H_
 #define MYTHUIBUTTONLIST_H_
 
+#include <memory>
 #include <utility>
 
 // Qt headers
@@ -11,6 +12,7 @@
 #include <optional>
 
 // MythTV headers
+#include "libmythbase/mythchrono.h"
 #include "mythuitype.h"
 #include "mythscreentype.h"
 #include "mythimage.h"
@@ -268,6 +270,8 @@ class MUI_PUBLIC MythUIButtonList : public MythUIType
     void LoadInBackground(int start = 0, int pageSize = 20);
     int  StopLoad(void);
 
+    void SetPrefetchPages(int pages);
+
   public slots:
     void Select();
     void Deselect();
@@ -278,6 +282,7 @@ class MUI_PUBLIC MythUIButtonList : public MythUIType
     void itemClicked(MythUIButtonListItem* item);
     void itemVisible(MythUIButtonListItem* item);
     void itemLoaded(MythUIButtonListItem* item);
+    void itemPrefetch(MythUIButtonListItem* item);
 
   protected:
     void customEvent(QEvent *event) override; // MythUIType
@@ -322,6 +327,9 @@ class MUI_PUBLIC MythUIButtonList : public MythUIType
     void CalculateArrowStates(void);
     void SetScrollBarPosition(void);
     void ItemVisible(MythUIButtonListItem *item);
+    void Prefetch(void);
+    void UpdateScrollStats(bool moved);
+    void ReportScrollStats(void);
 
     void SetActive(bool active);
 
@@ -402,6 +410,25 @@ class MUI_PUBLIC MythUIButtonList : public MythUIType
     QList<MythUIButtonListItem*> m_itemList;
     int m_nextItemLoaded              {0};
 
+    int    m_prefetchPages            {0};
+    int    m_prefetchSelPosition      {-1};
+    qint64 m_prefetchBudget           {0};
+    std::shared_ptr<QAtomicInt> m_prefetchGeneration;
+
+    // Frame times while the list is being scrolled
+    struct ScrollStats
+    {
+        std::chrono::microseconds m_lastMove   {0us};
+        std::chrono::microseconds m_lastFrame  {0us};
+        std::chrono::microseconds m_totalTime  {0us};
+        std::chrono::microseconds m_maxFrame   {0us};
+        int                       m_moves      {0};
+        int                       m_frames     {0};
+        int                       m_slowFrames {0};
+        int                       m_lastSelPosition {-1};
+    };
+    ScrollStats m_scrollStats;
+
     bool m_defaultDrawFromBottom      {false};
     std::optional<bool> m_shadowDrawFromBottom {std::nullopt};
 
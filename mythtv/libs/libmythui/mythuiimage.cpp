@@ -7,19 +7,27 @@
 #include <cstdlib>
 #include <random>
 #include <algorithm>
+#include <chrono>
 
 // QT
 #include <QCoreApplication>
+#include <QDateTime>
 #include <QDir>
 #include <QDomDocument>
 #include <QEvent>
 #include <QFile>
+#include <QHash>
 #include <QImageReader>
+#include <QMutex>
 #include <QReadWriteLock>
 #include <QRunnable>
+#include <QUrl>
+#include <QUrlQuery>
 
 // libmythbase
 #include "libmythbase/mthreadpool.h"
+#include "libmythbase/mythcorecontext.h"
+#include "libmythbase/mythdownloadmanager.h"
 #include "libmythbase/mythlogging.h"
 #include "libmythbase/mythmiscutil.h"
 
@@ -33,6 +41,39 @@ class ImageLoadThread;
 
 #define LOC      QString("MythUIImage(0x%1): ").arg((uint64_t)this,0,16)
 
+// How long a failed scaled image fetch is remembered, and how many
+// consecutive failures mark a backend as not providing scaled images at all
+// (e.g. an older backend).
+static constexpr std::chrono::minutes kScaledMissTimeout { 10 };
+static constexpr int                  kScaledHostMisses  { 3 };
+
+/// Scaled image fetches that recently failed, so they are not retried on
+/// every load.
+struct ScaledImageMisses
+{
+    QMutex                 m_lock;
+    QHash<QString, qint64> m_until;      ///< By URL or host, ms since epoch
+    QHash<QString, int>    m_hostMisses;
+};
+
+static ScaledImageMisses &GetScaledImageMisses()
+{
+    static ScaledImageMisses s_misses;
+    return s_misses;
+}
+
+/// Estimated decoded size of the background loads that are queued or running
+static QAtomicInteger<qint64> s_outstandingLoadBytes { 0 };
+
+/// Estimate the decoded size of an image shown at Size, or full screen if the
+/// size is not known yet.
+static qint64 EstimateDecodedBytes(QSize Size)
+{
+    if (Size.width() <= 0 || Size.height() <= 0)
+        Size = GetMythMainWindow()->GetUIScreenRect().size();
+    return 4LL * std::max(Size.width(), 1) * std::max(Size.height(), 1);
+}
+
 /////////////////////////////////////////////////////
 
 ImageProperties::ImageProperties(const ImageProperties& other)
@@ -201,6 +242,96 @@ class ImageLoader
         return imagelabel;
     }
 
+    /**
+    *  \brief Fetch a backend image already scaled to the size it will be
+    *         rendered at.
+    *
+    *  The backend keeps a shared cache of scaled copies that is served with
+    *  strong ETags, so repeated loads only revalidate the download manager's
+    *  copy and full resolution artwork is never decoded here. Returns false if
+    *  the image is not a backend file, or the backend could not provide it,
+    *  in which case the caller should load the original.
+    *
+    *  This blocks on the network, so is only used by the background loaders.
+    *  Failures are remembered for kScaledMissTimeout, per image and, after
+    *  kScaledHostMisses in a row, for the whole backend.
+    */
+    static bool LoadScaledImage(MythImage *image, const QString &filename,
+                                int w, int h, bool preserveAspect)
+    {
+        if (!filename.startsWith("myth://"))
+            return false;
+
+        // Stretching needs the full resolution in both directions
+        if (!preserveAspect && w > 0 && h > 0)
+            return false;
+
+        if (!gCoreContext->GetBoolSetting("UIUseBackendImageCache", true))
+            return false;
+
+        QUrl url(filename);
+        QString fname = url.path();
+        if (url.hasFragment())
+            fname += '#' + url.fragment();
+        while (fname.startsWith('/'))
+            fname.remove(0, 1);
+
+        QString host = url.host();
+        QString address = gCoreContext->GetBackendServerIP(host);
+        if (address.isEmpty())
+            address = host;
+
+        QUrlQuery query;
+        query.addQueryItem("StorageGroup", url.userName().isEmpty() ? "Default" : url.userName());
+        query.addQueryItem("FileName", fname);
+        query.addQueryItem("Width", QString::number(std::max(w, 0)));
+        query.addQueryItem("Height", QString::number(std::max(h, 0)));
+
+        QUrl scaled;
+        scaled.setScheme("http");
+        scaled.setHost(address);
+        scaled.setPort(gCoreContext->GetBackendStatusPort(host));
+        scaled.setPath("/Content/GetScaledImage");
+        scaled.setQuery(query);
+        QString fetchUrl = scaled.toString();
+
+        ScaledImageMisses &misses = GetScaledImageMisses();
+        qint64 now = QDateTime::currentMSecsSinceEpoch();
+        {
+            QMutexLocker locker(&misses.m_lock);
+            if (misses.m_until.value(host, 0) > now || misses.m_until.value(fetchUrl, 0) > now)
+                return false;
+        }
+
+        QByteArray data;
+        QImage im;
+        if (!GetMythDownloadManager()->download(fetchUrl, &data) ||
+            data.isEmpty() || !im.loadFromData(data))
+        {
+            LOG(VB_GUI | VB_FILE, LOG_DEBUG,
+                QString("ImageLoader::LoadScaledImage(%1) not available from "
+                        "the backend").arg(filename));
+            qint64 until = now + std::chrono::milliseconds(kScaledMissTimeout).count();
+            QMutexLocker locker(&misses.m_lock);
+            misses.m_until.insert(fetchUrl, until);
+            if (++misses.m_hostMisses[host] >= kScaledHostMisses)
+            {
+                misses.m_until.insert(host, until);
+                misses.m_hostMisses.remove(host);
+            }
+            return false;
+        }
+
+        {
+            QMutexLocker locker(&misses.m_lock);
+            misses.m_hostMisses.remove(host);
+        }
+
+        image->Assign(im);
+        image->SetFileName(filename);
+        return true;
+    }
+
     static MythImage *LoadImage(MythPainter *painter,
                                  // Must be a copy for thread safety
                                 ImageProperties imProps,
@@ -210,7 +341,8 @@ class ImageLoader
                                  // each MythUIImage object?
                                 const MythUIImage *parent,
                                 bool &aborted,
-                                MythImageReader *imageReader = nullptr)
+                                MythImageReader *imageReader = nullptr,
+                                bool inBackground = false)
     {
         QString cacheKey = GenImageLabel(imProps);
         if (!PreLoad(cacheKey, parent))
@@ -276,6 +408,10 @@ class ImageLoader
 
             if (imageReader)
                 ok = image->Load(imageReader);
+            else if (bResize && inBackground &&
+                     LoadScaledImage(image, filename, w, h,
+                                     imProps.m_preserveAspect))
+                ok = true;
             else
                 ok = image->Load(filename);
 
@@ -487,10 +623,17 @@ class ImageLoadThread : public QRunnable
   public:
     ImageLoadThread(MythUIImage *parent, MythPainter *painter,
                     const ImageProperties &imProps, QString basefile,
-                    int number, ImageCacheMode mode) :
+                    int number, ImageCacheMode mode, qint64 bytes) :
         m_parent(parent), m_painter(painter), m_imageProperties(imProps),
-        m_basefile(std::move(basefile)), m_number(number), m_cacheMode(mode)
+        m_basefile(std::move(basefile)), m_number(number), m_cacheMode(mode),
+        m_bytes(bytes)
+    {
+        s_outstandingLoadBytes.fetchAndAddRelaxed(m_bytes);
+    }
+
+    ~ImageLoadThread() override
     {
+        s_outstandingLoadBytes.fetchAndAddRelaxed(-m_bytes);
     }
 
     void run() override // QRunnable
@@ -523,7 +666,7 @@ class ImageLoadThread : public QRunnable
         MythImage *image = ImageLoader::LoadImage(m_painter,
                                                     m_imageProperties,
                                                     m_cacheMode, m_parent,
-                                                    aborted);
+                                                    aborted, nullptr, true);
 
         auto *le = new ImageLoadEvent(m_parent, image, m_basefile,
                                       m_imageProperties.m_filename,
@@ -538,6 +681,57 @@ private:
     QString         m_basefile;
     int             m_number;
     ImageCacheMode  m_cacheMode;
+    qint64          m_bytes;
+};
+
+/*!
+* \class ImagePrefetchThread
+* \brief Loads an image into the cache ahead of the widget that will show it.
+*
+* The request is dropped if the generation it was queued for is no longer
+* current when it reaches the front of the queue.
+*/
+class ImagePrefetchThread : public QRunnable
+{
+  public:
+    ImagePrefetchThread(MythPainter *painter, const ImageProperties &imProps,
+                        std::shared_ptr<QAtomicInt> generation, qint64 bytes) :
+        m_painter(painter), m_imageProperties(imProps),
+        m_generation(std::move(generation)),
+        m_queuedGeneration(m_generation->loadRelaxed()),
+        m_bytes(bytes)
+    {
+        s_outstandingLoadBytes.fetchAndAddRelaxed(m_bytes);
+    }
+
+    ~ImagePrefetchThread() override
+    {
+        s_outstandingLoadBytes.fetchAndAddRelaxed(-m_bytes);
+    }
+
+    void run() override // QRunnable
+    {
+        if (m_generation->loadRelaxed() != m_queuedGeneration)
+            return;
+
+        if (GetMythUI()->IsImageInCache(ImageLoader::GenImageLabel(m_imageProperties)))
+            return;
+
+        bool aborted = false;
+        MythImage *image = ImageLoader::LoadImage(m_painter, m_imageProperties,
+                                                  kCacheNormal, nullptr, aborted,
+                                                  nullptr, true);
+        // The cache holds its own reference
+        if (image)
+            image->DecrRef();
+    }
+
+  private:
+    MythPainter    *m_painter {nullptr};
+    ImageProperties m_imageProperties;
+    std::shared_ptr<QAtomicInt> m_generation;
+    int             m_queuedGeneration;
+    qint64          m_bytes;
 };
 
 /////////////////////////////////////////////////////////////////
@@ -1041,9 +1235,12 @@ bool MythUIImage::Load(bool allowLoadInBackground, bool forceStat)
                 QString("Load(), spawning thread to load '%1'").arg(filename));
 
             m_runningThreads++;
+            QSize size = imProps.m_forceSize.isNull() ? GetArea().size()
+                                                      : imProps.m_forceSize;
             auto *bImgThread = new ImageLoadThread(this, GetPainter(),
                                     imProps, bFilename, i,
-                                    static_cast<ImageCacheMode>(cacheMode2));
+                                    static_cast<ImageCacheMode>(cacheMode2),
+                                    EstimateDecodedBytes(size));
             GetMythUI()->GetImageThreadPool()->start(bImgThread, "ImageLoad");
         }
         else
@@ -1133,6 +1330,55 @@ bool MythUIImage::Load(bool allowLoadInBackground, bool forceStat)
     return true;
 }
 
+/**
+ *  \brief Queue a low priority load of \p filename, with the properties of
+ *         this widget, into the image cache.
+ *
+ *  Used to decode and scale images that are about to be shown by a copy of
+ *  this widget. The request is skipped if \p generation has changed by the
+ *  time it runs.
+ *
+ *  \returns An estimate of the decoded size in bytes, or 0 if nothing was
+ *           queued.
+ */
+qint64 MythUIImage::Prefetch(const QString &filename,
+                             const std::shared_ptr<QAtomicInt> &generation)
+{
+    // Queued behind images that are already on screen
+    static constexpr int kPrefetchPriority { 1 };
+
+    if (filename.isEmpty() || ImageLoader::SupportsAnimation(filename))
+        return 0;
+
+    ImageProperties imProps = m_imageProperties;
+    imProps.m_filename = filename;
+    if (GetMythUI()->IsImageInCache(ImageLoader::GenImageLabel(imProps)))
+        return 0;
+
+    QSize size = GetArea().size();
+    if (imProps.m_forceSize.width() > 0)
+        size.setWidth(imProps.m_forceSize.width());
+    if (imProps.m_forceSize.height() > 0)
+        size.setHeight(imProps.m_forceSize.height());
+
+    qint64 bytes = EstimateDecodedBytes(size);
+    auto *prefetch = new ImagePrefetchThread(GetPainter(), imProps, generation,
+                                             bytes);
+    GetMythUI()->GetImageThreadPool()->start(prefetch, "ImagePrefetch",
+                                             kPrefetchPriority);
+
+    return bytes;
+}
+
+/**
+ *  \brief The estimated decoded size of all images that are queued or being
+ *          loaded in the background, by widgets and by prefetching.
+ */
+qint64 MythUIImage::OutstandingLoadBytes(void)
+{
+    return s_outstandingLoadBytes.loadRelaxed();
+}
+
 /**
  *  \copydoc MythUIType::Pulse()
  */
@@ -1,6 +1,9 @@
 #ifndef MYTHUI_IMAGE_H_
 #define MYTHUI_IMAGE_H_
 
+#include <memory>
+
+#include <QAtomicInt>
 #include <QDateTime>
 #include <QHash>
 #include <QMutex>
@@ -130,6 +133,9 @@ class MUI_PUBLIC MythUIImage : public MythUIType
 
     void Reset(void) override; // MythUIType
     bool Load(bool allowLoadInBackground = true, bool forceStat = false);
+    qint64 Prefetch(const QString &filename,
+                    const std::shared_ptr<QAtomicInt> &generation);
+    static qint64 OutstandingLoadBytes(void);
 
     void Pulse(void) override; // MythUIType
 
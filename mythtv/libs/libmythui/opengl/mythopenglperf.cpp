@@ -92,3 +92,29 @@ void MythOpenGLPerf::LogSamples(void)
     m_timersRunning = 0;
     reset();
 }
+
+/*! \brief Add the work done for one frame and log the averages every SampleCount frames.
+ *
+ * Unlike the timers this needs no GPU support, so it is always available.
+*/
+void MythOpenGLPerf::RecordFrame(int DrawCalls, int Quads, int Uploads, int64_t UploadBytes)
+{
+    m_drawCalls   += DrawCalls;
+    m_quads       += Quads;
+    m_uploads     += Uploads;
+    m_uploadBytes += UploadBytes;
+    if (++m_frameCount < m_totalSamples)
+        return;
+
+    LOG(VB_GPU, LOG_INFO, m_name + QString("Per frame: %1 draw calls, %2 quads, "
+                                           "%3 texture uploads (%4 KB)")
+        .arg(static_cast<double>(m_drawCalls) / m_frameCount, 0, 'f', 1)
+        .arg(static_cast<double>(m_quads) / m_frameCount, 0, 'f', 1)
+        .arg(static_cast<double>(m_uploads) / m_frameCount, 0, 'f', 2)
+        .arg(static_cast<double>(m_uploadBytes) / m_frameCount / 1024.0, 0, 'f', 1));
+    m_frameCount  = 0;
+    m_drawCalls   = 0;
+    m_quads       = 0;
+    m_uploads     = 0;
+    m_uploadBytes = 0;
+}
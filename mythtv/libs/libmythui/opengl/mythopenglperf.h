@@ -1,6 +1,9 @@
 #ifndef MYTHOPENGLPERF_H
 #define MYTHOPENGLPERF_H
 
+// C++
+#include <cstdint>
+
 // Qt
 #include <QVector>
 #if QT_VERSION < QT_VERSION_CHECK(6,0,0)
@@ -47,6 +50,7 @@ class MUI_PUBLIC MythOpenGLPerf : public QOpenGLTimeMonitor
     void RecordSample    (void);
     void LogSamples      (void);
     int  GetTimersRunning(void) const;
+    void RecordFrame     (int DrawCalls, int Quads, int Uploads, int64_t UploadBytes);
 
   private:
     QString m_name;
@@ -56,6 +60,11 @@ class MUI_PUBLIC MythOpenGLPerf : public QOpenGLTimeMonitor
     int  m_timersRunning           { 0 };
     QVector<GLuint64> m_timerData  { 0 };
     QVector<QString>  m_timerNames;
+    int     m_frameCount           { 0 };
+    int64_t m_drawCalls            { 0 };
+    int64_t m_quads                { 0 };
+    int64_t m_uploads              { 0 };
+    int64_t m_uploadBytes          { 0 };
 };
 
 #endif // MYTHOPENGLPERF_H
@@ -1,17 +1,26 @@
 // C++
 #include <algorithm>
+#include <cstring>
 
 // Qt
 #include <QtGlobal>
+#if QT_VERSION >= QT_VERSION_CHECK(6,5,0)
+#include <QtEnvironmentVariables>
+#endif
 #include <QCoreApplication>
 #include <QPainter>
 
 // MythTV
 #include "libmythbase/mythlogging.h"
 #include "mythmainwindow.h"
+#include "mythopenglperf.h"
 #include "mythrenderopengl.h"
 #include "mythpainteropengl.h"
 
+static constexpr int    kAtlasPageSize { 1024 };
+static constexpr int    kAtlasMaxImage { 256 };
+static constexpr size_t kAtlasMaxPages { 4 };
+
 MythOpenGLPainter::MythOpenGLPainter(MythRenderOpenGL* Render,
                                      MythMainWindow* Parent)
   : MythPainterGPU(Parent)
@@ -21,6 +30,16 @@ MythOpenGLPainter::MythOpenGLPainter(MythRenderOpenGL* Render,
 
     if (!m_render)
         LOG(VB_GENERAL, LOG_ERR, "OpenGL painter has no render device");
+
+    if (qEnvironmentVariableIsSet("MYTHTV_NO_GL_BATCH"))
+    {
+        m_batching = false;
+        LOG(VB_GENERAL, LOG_INFO, "OpenGL painter: Image batching disabled");
+    }
+
+    // Glyphs only save draw calls when they are batched
+    if (m_batching)
+        EnableGlyphCache();
 }
 
 MythOpenGLPainter::~MythOpenGLPainter()
@@ -55,6 +74,8 @@ void MythOpenGLPainter::FreeResources(void)
     for (auto * proc : std::as_const(m_procedurals))
         delete proc;
     m_procedurals.clear();
+    delete m_openGLPerf;
+    m_openGLPerf = nullptr;
     MythPainterGPU::FreeResources();
 }
 
@@ -86,6 +107,16 @@ void MythOpenGLPainter::ClearCache(void)
         m_imageExpireList.remove(it.key());
     }
     m_imageToTextureMap.clear();
+    ClearAtlas();
+}
+
+void MythOpenGLPainter::ClearAtlas(void)
+{
+    QMutexLocker locker(&m_imageAndTextureLock);
+    for (auto & page : m_atlasPages)
+        m_textureDeleteList.push_back(page.m_texture);
+    m_atlasPages.clear();
+    m_atlas.clear();
 }
 
 void MythOpenGLPainter::Begin(QPaintDevice *Parent)
@@ -129,6 +160,23 @@ void MythOpenGLPainter::Begin(QPaintDevice *Parent)
 
     DeleteTextures();
     m_render->makeCurrent();
+    m_frameCount++;
+
+    if (!m_openGLPerf && VERBOSE_LEVEL_CHECK(VB_GPU, LOG_INFO))
+        m_openGLPerf = new MythOpenGLPerf("GLUIPerf: ", { "UI:" });
+    if (m_openGLPerf)
+    {
+        // Discard whatever was drawn since the last End(), e.g. video, so
+        // that only the UI is counted.
+        int drawcalls = 0;
+        int quads = 0;
+        int uploads = 0;
+        int64_t bytes = 0;
+        m_render->GetFrameCounts(drawcalls, quads, uploads, bytes);
+        // Only time a frame once the last one has been read back
+        if (!m_openGLPerf->GetTimersRunning())
+            m_openGLPerf->RecordSample();
+    }
 
     // If master (have complete swap control) then bind default framebuffer and clear
     if (m_viewControl.testFlag(Framebuffer))
@@ -159,11 +207,33 @@ void MythOpenGLPainter::End(void)
     if (VERBOSE_LEVEL_CHECK(VB_GPU, LOG_INFO))
         m_render->logDebugMarker("PAINTER_FRAME_END");
 
+    // Whoever draws next (e.g. video) must not find our images still queued
+    m_render->FlushBitmaps();
+
+    if (m_openGLPerf)
+    {
+        if (m_openGLPerf->GetTimersRunning() == 1)
+            m_openGLPerf->RecordSample();
+        int drawcalls = 0;
+        int quads = 0;
+        int uploads = 0;
+        int64_t bytes = 0;
+        m_render->GetFrameCounts(drawcalls, quads, uploads, bytes);
+        m_openGLPerf->RecordFrame(drawcalls, quads, uploads, bytes);
+    }
+
     if (m_viewControl.testFlag(Framebuffer))
     {
         m_render->Flush();
         m_render->swapBuffers();
     }
+    // Results are usually ready a frame or two later. Reading them before
+    // then would turn the timers off, so wait rather than block or give up.
+    if (m_openGLPerf && (m_openGLPerf->GetTimersRunning() > 1) &&
+        m_openGLPerf->isResultAvailable())
+    {
+        m_openGLPerf->LogSamples();
+    }
     m_render->doneCurrent();
 
     m_mappedTextures.clear();
@@ -176,13 +246,25 @@ MythGLTexture* MythOpenGLPainter::GetTextureFromCache(MythImage *Image)
         return nullptr;
 
     QMutexLocker locker(&m_imageAndTextureLock);
+    // Drawn in a way the atlas can not handle, so it needs its own texture
+    if (m_atlas.contains(Image))
+        DeleteFormatImagePriv(Image);
     if (m_imageToTextureMap.contains(Image))
     {
+        m_imageExpireList.remove(Image);
+        m_imageExpireList.push_back(Image);
+        MythGLTexture *texture = m_imageToTextureMap.value(Image);
         if (!Image->IsChanged())
+            return texture;
+
+        // Only part of the image was redrawn, upload just that
+        QRect changed = Image->GetChangedArea();
+        if (changed != Image->rect())
         {
-            m_imageExpireList.remove(Image);
-            m_imageExpireList.push_back(Image);
-            return m_imageToTextureMap.value(Image);
+            locker.unlock();
+            Image->SetChanged(false);
+            m_render->UpdateTexture(texture, changed.topLeft(), Image->copy(changed));
+            return texture;
         }
         DeleteFormatImagePriv(Image);
     }
@@ -211,7 +293,7 @@ MythGLTexture* MythOpenGLPainter::GetTextureFromCache(MythImage *Image)
             .arg(m_maxHardwareCacheSize / 1024));
 
         locker.relock();
-        while (m_hardwareCacheSize > m_maxHardwareCacheSize)
+        while ((m_hardwareCacheSize > m_maxHardwareCacheSize) && !m_imageExpireList.empty())
         {
             MythImage *expiredIm = m_imageExpireList.front();
             m_imageExpireList.pop_front();
@@ -227,7 +309,7 @@ MythGLTexture* MythOpenGLPainter::GetTextureFromCache(MythImage *Image)
     m_imageToTextureMap[Image] = texture;
     m_imageExpireList.push_back(Image);
 
-    while (m_hardwareCacheSize > m_maxHardwareCacheSize)
+    while ((m_hardwareCacheSize > m_maxHardwareCacheSize) && !m_imageExpireList.empty())
     {
         MythImage *expiredIm = m_imageExpireList.front();
         m_imageExpireList.pop_front();
@@ -252,6 +334,18 @@ void MythOpenGLPainter::DrawImage(const QRect Dest, MythImage *Image,
                            static_cast<int>(Dest.width()  * pixelratio),
                            static_cast<int>(Dest.height() * pixelratio));
 
+        // Queue the image, preferably from an atlas page, so that runs of
+        // images from the same texture are drawn with a single call
+        if (m_batching)
+        {
+            QRect source = Source;
+            MythGLTexture *texture = GetAtlasTexture(Image, source);
+            if (!texture)
+                texture = GetTextureFromCache(Image);
+            m_render->QueueBitmap(texture, source, dest, Alpha, pixelratio);
+            return;
+        }
+
         // Drawing an image multiple times with the same VBO will
         // stall most GPUs as the VBO is re-mapped whilst still in
         // use. Use a pooled VBO instead.
@@ -277,6 +371,140 @@ void MythOpenGLPainter::DrawImage(const QRect Dest, MythImage *Image,
     }
 }
 
+/*! \brief Return the atlas page holding Image, adding it if necessary.
+ *
+ * Source is moved to where the image is on the page. Returns nullptr for
+ * images that are too large or are drawn from outside their own area, and
+ * when the atlas is not usable, in which case the image gets its own texture.
+*/
+MythGLTexture* MythOpenGLPainter::GetAtlasTexture(MythImage *Image, QRect &Source)
+{
+    if (!Image || Image->isNull() || Image->width() > kAtlasMaxImage ||
+        Image->height() > kAtlasMaxImage || !Image->rect().contains(Source))
+    {
+        return nullptr;
+    }
+
+    QMutexLocker locker(&m_imageAndTextureLock);
+    auto it = m_atlas.find(Image);
+    if (it != m_atlas.end() && Image->IsChanged())
+    {
+        // Update in place when possible, images such as clocks change often
+        if (it->m_area.size() == Image->size())
+        {
+            Image->SetChanged(false);
+            WriteAtlasSlot(*it, *Image);
+        }
+        else
+        {
+            DeleteFormatImagePriv(Image);
+            it = m_atlas.end();
+        }
+    }
+
+    if (it == m_atlas.end())
+    {
+        AtlasSlot slot;
+        if (!AllocateAtlasSlot(Image->size(), slot))
+            return nullptr;
+
+        // Replaces any texture of its own
+        DeleteFormatImagePriv(Image);
+        CheckFormatImage(Image);
+        Image->SetChanged(false);
+        WriteAtlasSlot(slot, *Image);
+        m_atlasPages[slot.m_page].m_images.push_back(Image);
+        it = m_atlas.insert(Image, slot);
+    }
+
+    AtlasPage &page = m_atlasPages[it->m_page];
+    page.m_lastUsed = m_frameCount;
+    Source.translate(it->m_area.topLeft());
+    return page.m_texture;
+}
+
+/*! \brief Find room for an image of Size on the atlas pages.
+ *
+ * Images are placed on shelves with a one pixel border. A new page is added
+ * while there are fewer than kAtlasMaxPages, after that the page that was
+ * used least recently is emptied.
+*/
+bool MythOpenGLPainter::AllocateAtlasSlot(QSize Size, AtlasSlot &Slot)
+{
+    int width  = Size.width() + 2;
+    int height = Size.height() + 2;
+
+    for (size_t index = 0; index < m_atlasPages.size(); ++index)
+    {
+        AtlasPage &page = m_atlasPages[index];
+        int x = page.m_shelfX;
+        int y = page.m_shelfY;
+        int shelf = page.m_shelfHeight;
+        if (x + width > kAtlasPageSize)
+        {
+            x = 0;
+            y += shelf;
+            shelf = 0;
+        }
+        if (y + height > kAtlasPageSize)
+            continue;
+
+        page.m_shelfX = x + width;
+        page.m_shelfY = y;
+        page.m_shelfHeight = std::max(shelf, height);
+        Slot.m_page = index;
+        Slot.m_area = QRect(QPoint(x + 1, y + 1), Size);
+        return true;
+    }
+
+    if (m_atlasPages.size() < kAtlasMaxPages)
+    {
+        QImage blank(kAtlasPageSize, kAtlasPageSize, QImage::Format_RGBA8888);
+        blank.fill(Qt::transparent);
+        MythGLTexture *texture = m_render->CreateTextureFromQImage(&blank);
+        if (!texture)
+            return false;
+        m_hardwareCacheSize += MythRenderOpenGL::GetTextureDataSize(texture);
+        AtlasPage page;
+        page.m_texture = texture;
+        m_atlasPages.push_back(page);
+        LOG(VB_GPU, LOG_INFO, QString("OpenGL painter: Added atlas page %1")
+            .arg(m_atlasPages.size()));
+    }
+    else
+    {
+        auto lru = std::ranges::min_element(m_atlasPages, {}, &AtlasPage::m_lastUsed);
+        for (auto * image : lru->m_images)
+            m_atlas.remove(image);
+        lru->m_images.clear();
+        lru->m_shelfX = 0;
+        lru->m_shelfY = 0;
+        lru->m_shelfHeight = 0;
+        LOG(VB_GPU, LOG_DEBUG, QString("OpenGL painter: Recycled atlas page %1")
+            .arg(std::distance(m_atlasPages.begin(), lru)));
+    }
+    return AllocateAtlasSlot(Size, Slot);
+}
+
+/// Upload Image to its slot, repeating the edge pixels into the border.
+void MythOpenGLPainter::WriteAtlasSlot(const AtlasSlot &Slot, const QImage &Image)
+{
+    QImage source = Image.convertToFormat(QImage::Format_RGBA8888);
+    int width  = source.width();
+    int height = source.height();
+    QImage bordered(width + 2, height + 2, QImage::Format_RGBA8888);
+    for (int y = 0; y < height + 2; ++y)
+    {
+        const auto *in = reinterpret_cast<const quint32*>(source.constScanLine(std::clamp(y - 1, 0, height - 1)));
+        auto *out = reinterpret_cast<quint32*>(bordered.scanLine(y));
+        out[0] = in[0];
+        std::memcpy(out + 1, in, static_cast<size_t>(width) * sizeof(quint32));
+        out[width + 1] = in[width - 1];
+    }
+    m_render->UpdateTexture(m_atlasPages[Slot.m_page].m_texture,
+                            Slot.m_area.topLeft() - QPoint(1, 1), bordered);
+}
+
 void MythOpenGLPainter::DrawProcedural(QRect Dest, int Alpha, const ProcSource& VertexSource, const ProcSource& FragmentSource, const QString &SourceHash)
 {
     if (auto * shader = GetProceduralShader(VertexSource, FragmentSource, SourceHash); shader && m_render)
@@ -341,6 +569,11 @@ void MythOpenGLPainter::DeleteFormatImagePriv(MythImage *Image)
         m_imageToTextureMap.remove(Image);
         m_imageExpireList.remove(Image);
     }
+    if (auto slot = m_atlas.constFind(Image); slot != m_atlas.constEnd())
+    {
+        std::erase(m_atlasPages[slot->m_page].m_images, Image);
+        m_atlas.erase(slot);
+    }
 }
 
 void MythOpenGLPainter::PushTransformation(const UIEffects &Fx, QPointF Center)
@@ -4,6 +4,7 @@
 // Std
 #include <array>
 #include <list>
+#include <vector>
 
 // Qt
 #include <QMutex>
@@ -16,6 +17,7 @@
 
 class MythMainWindow;
 class MythGLTexture;
+class MythOpenGLPerf;
 class MythRenderOpenGL;
 class QOpenGLBuffer;
 class QOpenGLFramebufferObject;
@@ -53,6 +55,7 @@ class MUI_PUBLIC MythOpenGLPainter : public MythPainterGPU
   protected:
     void  ClearCache(void);
     MythGLTexture* GetTextureFromCache(MythImage *Image);
+    MythGLTexture* GetAtlasTexture(MythImage *Image, QRect &Source);
     QOpenGLShaderProgram* GetProceduralShader(const ProcSource& VertexSource, const ProcSource& FragmentSource, const QString& SourceHash);
 
     MythImage* GetFormatImagePriv(void) override { return new MythImage(this); }
@@ -72,6 +75,32 @@ class MUI_PUBLIC MythOpenGLPainter : public MythPainterGPU
     bool                       m_mappedBufferPoolReady { false };
 
     QHash<QString,QOpenGLShaderProgram*> m_procedurals;
+
+    // Small images share a few large textures, so that consecutive draws
+    // can be batched into one draw call
+    struct AtlasSlot
+    {
+        size_t m_page { 0 };
+        QRect  m_area;
+    };
+    struct AtlasPage
+    {
+        MythGLTexture*          m_texture     { nullptr };
+        int                     m_shelfX      { 0 };
+        int                     m_shelfY      { 0 };
+        int                     m_shelfHeight { 0 };
+        uint64_t                m_lastUsed    { 0 };
+        std::vector<MythImage*> m_images;
+    };
+    bool  AllocateAtlasSlot(QSize Size, AtlasSlot &Slot);
+    void  WriteAtlasSlot(const AtlasSlot &Slot, const QImage &Image);
+    void  ClearAtlas(void);
+
+    bool                       m_batching   { true };
+    uint64_t                   m_frameCount { 0 };
+    QHash<MythImage*,AtlasSlot> m_atlas;
+    std::vector<AtlasPage>     m_atlasPages;
+    MythOpenGLPerf*            m_openGLPerf { nullptr };
 };
 
 #endif
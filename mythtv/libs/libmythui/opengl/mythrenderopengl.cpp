@@ -1,6 +1,7 @@
 // Std
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 
 // Qt
 #include <QtGlobal>
@@ -38,6 +39,7 @@ static constexpr GLuint kVertexOffset  { 0 };
 static constexpr GLuint kTextureOffset { 8 * sizeof(GLfloat) };
 
 static constexpr int MAX_VERTEX_CACHE { 500 };
+static constexpr size_t kMaxBatchQuads  { 4096 };
 
 MythGLTexture::MythGLTexture(QOpenGLTexture *Texture)
   : m_texture(Texture)
@@ -510,6 +512,7 @@ bool MythRenderOpenGL::IsReady(void)
 
 void MythRenderOpenGL::swapBuffers()
 {
+    FlushBitmaps();
     QOpenGLContext::swapBuffers(m_window);
     m_swapCount++;
 }
@@ -583,6 +586,7 @@ void MythRenderOpenGL::SetViewPort(QRect Rect, bool ViewportOnly)
     if (Rect == m_viewport)
         return;
     makeCurrent();
+    FlushBitmaps();
     m_viewport = Rect;
     glViewport(m_viewport.left(), m_viewport.top(),
                m_viewport.width(), m_viewport.height());
@@ -593,6 +597,7 @@ void MythRenderOpenGL::SetViewPort(QRect Rect, bool ViewportOnly)
 
 void MythRenderOpenGL::Flush(void)
 {
+    FlushBitmaps();
     if (!m_flushEnabled)
         return;
 
@@ -604,6 +609,8 @@ void MythRenderOpenGL::Flush(void)
 void MythRenderOpenGL::SetBlend(bool Enable)
 {
     makeCurrent();
+    if (Enable != m_blend)
+        FlushBitmaps();
     if (Enable && !m_blend)
         glEnable(GL_BLEND);
     else if (!Enable && m_blend)
@@ -649,6 +656,8 @@ MythGLTexture* MythRenderOpenGL::CreateTextureFromQImage(QImage *Image)
     result->m_bufferSize  = GetBufferSize(result->m_totalSize, QOpenGLTexture::RGBA, QOpenGLTexture::UInt8);
     result->m_size        = Image->size();
     result->m_crop        = true;
+    m_uploads++;
+    m_uploadBytes += result->m_bufferSize;
     return result;
 }
 
@@ -679,6 +688,7 @@ void MythRenderOpenGL::SetTextureFilters(MythGLTexture *Texture, QOpenGLTexture:
         return;
 
     makeCurrent();
+    FlushBitmaps();
     if (Texture->m_texture)
     {
         Texture->m_texture->bind();
@@ -716,6 +726,7 @@ void MythRenderOpenGL::DeleteTexture(MythGLTexture *Texture)
         return;
 
     makeCurrent();
+    FlushBitmaps();
     // N.B. Don't delete m_textureId - it is owned externally
     delete Texture->m_texture;
     delete [] Texture->m_data;
@@ -786,6 +797,7 @@ void MythRenderOpenGL::BindFramebuffer(QOpenGLFramebufferObject *Framebuffer)
         return;
 
     makeCurrent();
+    FlushBitmaps();
     if (Framebuffer == nullptr)
     {
         QOpenGLFramebufferObject::bindDefault();
@@ -802,6 +814,7 @@ void MythRenderOpenGL::BindFramebuffer(QOpenGLFramebufferObject *Framebuffer)
 void MythRenderOpenGL::ClearFramebuffer(void)
 {
     makeCurrent();
+    FlushBitmaps();
     glClear(GL_COLOR_BUFFER_BIT);
     doneCurrent();
 }
@@ -813,6 +826,7 @@ void MythRenderOpenGL::DrawProcedural(QRect Area, int Alpha, QOpenGLFramebufferO
         return;
 
     makeCurrent();
+    FlushBitmaps();
     BindFramebuffer(Target);
     glEnableVertexAttribArray(VERTEX_INDEX);
     GetCachedVBO(GL_TRIANGLE_STRIP, Area);
@@ -822,6 +836,7 @@ void MythRenderOpenGL::DrawProcedural(QRect Area, int Alpha, QOpenGLFramebufferO
     Program->setUniformValue("u_alpha", static_cast<float>(Alpha / 255.0F));
     Program->setUniformValue("u_res",   QVector2D(m_window->width(), m_window->height()));
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    m_drawCalls++;
     QOpenGLBuffer::release(QOpenGLBuffer::VertexBuffer);
     glDisableVertexAttribArray(VERTEX_INDEX);
     doneCurrent();
@@ -832,6 +847,7 @@ void MythRenderOpenGL::DrawBitmap(MythGLTexture *Texture, QOpenGLFramebufferObje
                                   QOpenGLShaderProgram *Program, int Alpha, qreal Scale)
 {
     makeCurrent();
+    FlushBitmaps();
 
     if (!Texture || !((Texture->m_texture || Texture->m_textureId) && Texture->m_vbo))
         return;
@@ -876,6 +892,8 @@ void MythRenderOpenGL::DrawBitmap(MythGLTexture *Texture, QOpenGLFramebufferObje
     glVertexAttrib4f(COLOR_INDEX, 1.0F, 1.0F, 1.0F, Alpha / 255.0F);
     glVertexAttribPointerI(TEXTURE_INDEX, TEXTURE_SIZE, GL_FLOAT, GL_FALSE, TEXTURE_SIZE * sizeof(GLfloat), kTextureOffset);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    m_drawCalls++;
+    m_quads++;
     glDisableVertexAttribArray(TEXTURE_INDEX);
     glDisableVertexAttribArray(VERTEX_INDEX);
     QOpenGLBuffer::release(QOpenGLBuffer::VertexBuffer);
@@ -892,6 +910,7 @@ void MythRenderOpenGL::DrawBitmap(std::vector<MythGLTexture *> &Textures,
         return;
 
     makeCurrent();
+    FlushBitmaps();
     BindFramebuffer(Target);
 
     if (Program == nullptr)
@@ -941,6 +960,8 @@ void MythRenderOpenGL::DrawBitmap(std::vector<MythGLTexture *> &Textures,
     glVertexAttrib4f(COLOR_INDEX, 1.0, 1.0, 1.0, 1.0);
     glVertexAttribPointerI(TEXTURE_INDEX, TEXTURE_SIZE, GL_FLOAT, GL_FALSE, TEXTURE_SIZE * sizeof(GLfloat), kTextureOffset);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    m_drawCalls++;
+    m_quads++;
     glDisableVertexAttribArray(TEXTURE_INDEX);
     glDisableVertexAttribArray(VERTEX_INDEX);
     QOpenGLBuffer::release(QOpenGLBuffer::VertexBuffer);
@@ -950,10 +971,169 @@ void MythRenderOpenGL::DrawBitmap(std::vector<MythGLTexture *> &Textures,
 static const float kLimitedRangeOffset = (16.0F / 255.0F);
 static const float kLimitedRangeScale  = (219.0F / 255.0F);
 
+/*! \brief Draw a bitmap with the next bitmaps that use the same texture.
+ *
+ * Bitmaps are collected until one with another texture or transformation
+ * is queued, anything else is drawn, or the frame ends. They are then drawn
+ * together with a single call. Only for the default shader and framebuffer.
+ * Texture must stay valid until it is drawn, DeleteTexture() takes care of
+ * that.
+*/
+void MythRenderOpenGL::QueueBitmap(MythGLTexture *Texture, const QRect Source,
+                                   const QRect Destination, int Alpha, qreal Scale)
+{
+    if (!Texture || !(Texture->m_texture || Texture->m_textureId) || Texture->m_size.isEmpty())
+        return;
+
+    makeCurrent();
+    GLuint textureid = Texture->m_texture ? Texture->m_texture->textureId() : Texture->m_textureId;
+    const QMatrix4x4 &transform = m_transforms.top();
+    if (!m_batch.empty() &&
+        ((textureid != m_batchTexture) || (Texture->m_target != m_batchTarget) ||
+         !qFuzzyCompare(transform, m_batchTransform) ||
+         (m_batch.size() >= (kMaxBatchQuads * 6))))
+    {
+        FlushBitmaps();
+    }
+
+    if (m_batch.empty())
+    {
+        m_batchTexture   = textureid;
+        m_batchTarget    = Texture->m_target;
+        m_batchTransform = transform;
+    }
+
+    // As UpdateTextureVertices() without rotation
+    QSize size = Texture->m_size;
+    int width  = Texture->m_crop ? std::min(Source.width(),  size.width())  : Source.width();
+    int height = Texture->m_crop ? std::min(Source.height(), size.height()) : Source.height();
+
+    GLfloat left   = Source.left();
+    GLfloat right  = Source.left() + width;
+    GLfloat top    = Source.top();
+    GLfloat bottom = Source.top() + height;
+    if (Texture->m_target != QOpenGLTexture::TargetRectangle)
+    {
+        left   /= static_cast<GLfloat>(size.width());
+        right  /= static_cast<GLfloat>(size.width());
+        top    /= static_cast<GLfloat>(size.height());
+        bottom /= static_cast<GLfloat>(size.height());
+    }
+    if (!Texture->m_flip)
+        std::swap(top, bottom);
+
+    width  = Texture->m_crop ? std::min(static_cast<int>(width * Scale), Destination.width())   : Destination.width();
+    height = Texture->m_crop ? std::min(static_cast<int>(height * Scale), Destination.height()) : Destination.height();
+
+    auto x1 = static_cast<GLfloat>(Destination.left());
+    auto y1 = static_cast<GLfloat>(Destination.top());
+    auto x2 = static_cast<GLfloat>(Destination.left() + width);
+    auto y2 = static_cast<GLfloat>(Destination.top() + height);
+    auto alpha = static_cast<GLubyte>(std::clamp(Alpha, 0, 255));
+
+    MythGLBatchVertex topleft     { x1, y1, left,  top,    { 255, 255, 255, alpha } };
+    MythGLBatchVertex bottomleft  { x1, y2, left,  bottom, { 255, 255, 255, alpha } };
+    MythGLBatchVertex topright    { x2, y1, right, top,    { 255, 255, 255, alpha } };
+    MythGLBatchVertex bottomright { x2, y2, right, bottom, { 255, 255, 255, alpha } };
+    m_batch.insert(m_batch.end(), { topleft, bottomleft, topright,
+                                    topright, bottomleft, bottomright });
+    m_quads++;
+    doneCurrent();
+}
+
+/// Draw the queued bitmaps.
+void MythRenderOpenGL::FlushBitmaps(void)
+{
+    if (m_batch.empty())
+        return;
+
+    makeCurrent();
+
+    // The calls below would flush again
+    std::swap(m_batch, m_batchDraw);
+
+    if (!m_batchVBO)
+        m_batchVBO = CreateVBO(static_cast<int>(kMaxBatchQuads * 6 * sizeof(MythGLBatchVertex)));
+
+    QOpenGLShaderProgram *program = m_defaultPrograms[kShaderDefault];
+    if (m_batchVBO && program)
+    {
+        BindFramebuffer(nullptr);
+        SetShaderProgramParams(program, m_projection, "u_projection");
+        SetShaderProgramParams(program, m_batchTransform, "u_transform");
+        program->setUniformValue("s_texture0", 0);
+        ActiveTexture(GL_TEXTURE0);
+        glBindTexture(m_batchTarget, m_batchTexture);
+
+        // Orphan the last batch rather than wait for the GPU to finish with it
+        m_batchVBO->bind();
+        m_batchVBO->allocate(m_batchDraw.data(),
+                             static_cast<int>(m_batchDraw.size() * sizeof(MythGLBatchVertex)));
+
+        static constexpr GLsizei kStride = sizeof(MythGLBatchVertex);
+        glEnableVertexAttribArray(VERTEX_INDEX);
+        glEnableVertexAttribArray(COLOR_INDEX);
+        glEnableVertexAttribArray(TEXTURE_INDEX);
+        glVertexAttribPointerI(VERTEX_INDEX, VERTEX_SIZE, GL_FLOAT, GL_FALSE, kStride,
+                               static_cast<GLuint>(offsetof(MythGLBatchVertex, m_x)));
+        glVertexAttribPointerI(TEXTURE_INDEX, TEXTURE_SIZE, GL_FLOAT, GL_FALSE, kStride,
+                               static_cast<GLuint>(offsetof(MythGLBatchVertex, m_s)));
+        glVertexAttribPointerI(COLOR_INDEX, 4, GL_UNSIGNED_BYTE, GL_TRUE, kStride,
+                               static_cast<GLuint>(offsetof(MythGLBatchVertex, m_color)));
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(m_batchDraw.size()));
+        m_drawCalls++;
+        glDisableVertexAttribArray(TEXTURE_INDEX);
+        glDisableVertexAttribArray(COLOR_INDEX);
+        glDisableVertexAttribArray(VERTEX_INDEX);
+        QOpenGLBuffer::release(QOpenGLBuffer::VertexBuffer);
+    }
+
+    m_batchDraw.clear();
+    doneCurrent();
+}
+
+/// Replace part of a texture with Image, which must fit inside it.
+void MythRenderOpenGL::UpdateTexture(MythGLTexture *Texture, const QPoint Offset,
+                                     const QImage &Image)
+{
+    if (!Texture || !(Texture->m_texture || Texture->m_textureId) || Image.isNull())
+        return;
+
+    makeCurrent();
+    // Queued bitmaps may still show what is replaced
+    FlushBitmaps();
+
+    QImage image = Image.convertToFormat(QImage::Format_RGBA8888);
+    if (Texture->m_texture)
+        Texture->m_texture->bind();
+    else
+        glBindTexture(Texture->m_target, Texture->m_textureId);
+    glTexSubImage2D(Texture->m_target, 0, Offset.x(), Offset.y(), image.width(),
+                    image.height(), GL_RGBA, GL_UNSIGNED_BYTE, image.constBits());
+    m_uploads++;
+    m_uploadBytes += image.sizeInBytes();
+    doneCurrent();
+}
+
+/// Draw calls, bitmaps and texture uploads since the last call.
+void MythRenderOpenGL::GetFrameCounts(int &DrawCalls, int &Quads, int &Uploads,
+                                      int64_t &UploadBytes)
+{
+    DrawCalls   = m_drawCalls;
+    Quads       = m_quads;
+    Uploads     = m_uploads;
+    UploadBytes = m_uploadBytes;
+    m_drawCalls   = 0;
+    m_quads       = 0;
+    m_uploads     = 0;
+    m_uploadBytes = 0;
+}
+
 /// \brief An optimised method to clear a QRect to the given color
 void MythRenderOpenGL::ClearRect(QOpenGLFramebufferObject *Target, const QRect Area, int Color, int Alpha)
 {
     makeCurrent();
+    FlushBitmaps();
     BindFramebuffer(Target);
     glEnableVertexAttribArray(VERTEX_INDEX);
 
@@ -965,6 +1145,7 @@ void MythRenderOpenGL::ClearRect(QOpenGLFramebufferObject *Target, const QRect A
     GetCachedVBO(GL_TRIANGLE_STRIP, Area);
     glVertexAttribPointerI(VERTEX_INDEX, VERTEX_SIZE, GL_FLOAT, GL_FALSE, VERTEX_SIZE * sizeof(GLfloat), kVertexOffset);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    m_drawCalls++;
 
     QOpenGLBuffer::release(QOpenGLBuffer::VertexBuffer);
     glDisableVertexAttribArray(VERTEX_INDEX);
@@ -1020,6 +1201,7 @@ void MythRenderOpenGL::DrawRoundRect(QOpenGLFramebufferObject *Target,
     m_parameters(1,1) = halfheight;
 
     makeCurrent();
+    FlushBitmaps();
     BindFramebuffer(Target);
     glEnableVertexAttribArray(VERTEX_INDEX);
     GetCachedVBO(GL_TRIANGLE_STRIP, Area);
@@ -1031,6 +1213,7 @@ void MythRenderOpenGL::DrawRoundRect(QOpenGLFramebufferObject *Target,
         SetShaderProjection(m_defaultPrograms[kShaderRect]);
         SetShaderProgramParams(m_defaultPrograms[kShaderRect], m_parameters, "u_parameters");
         glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        m_drawCalls++;
     }
 
     if (edge)
@@ -1045,6 +1228,7 @@ void MythRenderOpenGL::DrawRoundRect(QOpenGLFramebufferObject *Target,
         SetShaderProjection(m_defaultPrograms[kShaderEdge]);
         SetShaderProgramParams(m_defaultPrograms[kShaderEdge], m_parameters, "u_parameters");
         glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        m_drawCalls++;
     }
 
     QOpenGLBuffer::release(QOpenGLBuffer::VertexBuffer);
@@ -1114,6 +1298,9 @@ void MythRenderOpenGL::ReleaseResources(void)
     OpenGLLocker locker(this);
     if (VERBOSE_LEVEL_CHECK(VB_GPU, LOG_INFO))
         logDebugMarker("RENDER_RELEASE_START");
+    m_batch.clear();
+    delete m_batchVBO;
+    m_batchVBO = nullptr;
     DeleteDefaultShaders();
     ExpireVertices();
     ExpireVBOS();
@@ -80,6 +80,16 @@ class MUI_PUBLIC MythGLTexture
     Q_DISABLE_COPY(MythGLTexture)
 };
 
+/// One corner of a queued bitmap, see MythRenderOpenGL::QueueBitmap()
+struct MythGLBatchVertex
+{
+    GLfloat m_x { 0.0F };
+    GLfloat m_y { 0.0F };
+    GLfloat m_s { 0.0F };
+    GLfloat m_t { 0.0F };
+    std::array<GLubyte,4> m_color { 255, 255, 255, 255 };
+};
+
 enum DefaultShaders : std::uint8_t
 {
     kShaderSimple  = 0,
@@ -152,6 +162,11 @@ class MUI_PUBLIC MythRenderOpenGL : public QOpenGLContext, public QOpenGLFunctio
     void  DrawBitmap(MythGLTexture *Texture, QOpenGLFramebufferObject *Target,
                      QRect Source, QRect Destination,
                      QOpenGLShaderProgram *Program, int Alpha = 255, qreal Scale = 1.0);
+    void  QueueBitmap(MythGLTexture *Texture, QRect Source, QRect Destination,
+                      int Alpha = 255, qreal Scale = 1.0);
+    void  FlushBitmaps(void);
+    void  UpdateTexture(MythGLTexture *Texture, QPoint Offset, const QImage &Image);
+    void  GetFrameCounts(int &DrawCalls, int &Quads, int &Uploads, int64_t &UploadBytes);
     void  DrawBitmap(std::vector<MythGLTexture *> &Textures,
                      QOpenGLFramebufferObject *Target,
                      QRect Source, QRect Destination,
@@ -216,6 +231,20 @@ class MUI_PUBLIC MythRenderOpenGL : public QOpenGLContext, public QOpenGLFunctio
     QMap<uint64_t,QOpenGLBuffer*>m_cachedVBOS;
     QList<uint64_t>              m_vboExpiry;
 
+    // Queued bitmaps
+    std::vector<MythGLBatchVertex> m_batch;
+    std::vector<MythGLBatchVertex> m_batchDraw;
+    GLuint                       m_batchTexture { 0 };
+    GLenum                       m_batchTarget  { QOpenGLTexture::Target2D };
+    QMatrix4x4                   m_batchTransform;
+    QOpenGLBuffer*               m_batchVBO     { nullptr };
+
+    // Frame statistics
+    int        m_drawCalls   { 0 };
+    int        m_quads       { 0 };
+    int        m_uploads     { 0 };
+    int64_t    m_uploadBytes { 0 };
+
     // Locking
     QRecursiveMutex  m_lock;
     int        m_lockLevel { 0 };
@@ -0,0 +1,198 @@
+#include <array>
+#include <cstdlib>
+
+#include <QGuiApplication>
+
+#include "libmythbase/mythcorecontext.h"
+#include "libmythui/mythfontproperties.h"
+
+#include "test_mythpainter.h"
+
+static constexpr int kGuideRows    { 12 };
+static constexpr int kGuideColumns { 6 };
+static constexpr int kRowHeight    { 40 };
+
+static const std::array<QString, 12> kTitles
+{
+    "News", "The Late Show", "Wildlife Documentary: Rivers of the North",
+    "Weather", "Film: The Long Road Home", "Cooking Together",
+    "Live Football: Second Half", "Quiz Night", "Cartoons",
+    "History of Flight", "Late Movie: Starlight Express", "Shopping"
+};
+
+// Bounding box of the pixels that are not fully transparent
+static QRect Coverage(const QImage &Image)
+{
+    QRect result;
+    for (int y = 0; y < Image.height(); ++y)
+        for (int x = 0; x < Image.width(); ++x)
+            if (qAlpha(Image.pixel(x, y)) > 0)
+                result |= QRect(x, y, 1, 1);
+    return result;
+}
+
+static QImage Render(bool Glyphs, QRect Area, const QString &Text, int Flags,
+                     const MythFontProperties &Font, QRect Bound)
+{
+    QImage image(320, 120, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    ImagePainter painter(Glyphs);
+    painter.Begin(&image);
+    painter.DrawText(Area, Text, Flags, Font, 255, Bound);
+    painter.End();
+    return image;
+}
+
+static void InitFont(MythFontProperties &Font)
+{
+    QFont face;
+    face.setPixelSize(18);
+    Font.SetFace(face);
+    Font.SetColor(Qt::white);
+}
+
+void TestMythPainter::initTestCase(void)
+{
+    gCoreContext = new MythCoreContext("test_mythpainter_1.0", nullptr);
+    gCoreContext->OverrideSettingForSession("GUITEXTZOOM", "100");
+}
+
+void TestMythPainter::cleanupTestCase(void)
+{
+    delete gCoreContext;
+    gCoreContext = nullptr;
+}
+
+void TestMythPainter::GlyphTextClipped(void)
+{
+    MythFontProperties font;
+    InitFont(font);
+
+    QRect area(10, 10, 200, 40);
+    QRect bound(10, 10, 50, 40);
+    QImage image = Render(true, area, "Clipped glyph text", Qt::AlignLeft | Qt::AlignVCenter,
+                          font, bound);
+    QRect covered = Coverage(image);
+    QVERIFY(!covered.isEmpty());
+    QVERIFY(bound.contains(covered));
+}
+
+void TestMythPainter::GlyphTextMatchesImage(void)
+{
+    MythFontProperties font;
+    InitFont(font);
+    font.SetShadow(true, QPoint(2, 2), Qt::black, 255);
+
+    QRect area(10, 10, 300, 100);
+    const std::array<int, 4> flags
+    {
+        Qt::AlignLeft | Qt::AlignVCenter,
+        Qt::AlignHCenter | Qt::AlignTop,
+        Qt::AlignRight | Qt::AlignBottom,
+        Qt::AlignLeft | Qt::AlignTop | Qt::TextWordWrap
+    };
+
+    for (int flag : flags)
+    {
+        QString text = "Wildlife Documentary: Rivers of the North";
+        QRect glyphs = Coverage(Render(true, area, text, flag, font, area));
+        QRect strings = Coverage(Render(false, area, text, flag, font, area));
+        QVERIFY(!glyphs.isEmpty());
+
+        // Glyphs are placed on whole pixels
+        QVERIFY2(std::abs(glyphs.left() - strings.left()) <= 2 &&
+                 std::abs(glyphs.top() - strings.top()) <= 2 &&
+                 std::abs(glyphs.right() - strings.right()) <= 2 &&
+                 std::abs(glyphs.bottom() - strings.bottom()) <= 2,
+                 qPrintable(QString("flags %1: glyphs %2,%3 %4x%5 strings %6,%7 %8x%9")
+                            .arg(flag).arg(glyphs.x()).arg(glyphs.y())
+                            .arg(glyphs.width()).arg(glyphs.height())
+                            .arg(strings.x()).arg(strings.y())
+                            .arg(strings.width()).arg(strings.height())));
+    }
+}
+
+void TestMythPainter::GuideScroll_data(void)
+{
+    QTest::addColumn<bool>("glyphs");
+    QTest::addColumn<int>("step");
+    QTest::newRow("string images, line")  << false << 1;
+    QTest::newRow("glyph cache, line")    << true  << 1;
+    QTest::newRow("string images, page")  << false << kGuideRows;
+    QTest::newRow("glyph cache, page")    << true  << kGuideRows;
+}
+
+// Draw the program titles of a guide grid that moves down by step rows
+// every frame, so the titles of step rows are new each time.
+void TestMythPainter::GuideScroll(void)
+{
+    QFETCH(bool, glyphs);
+    QFETCH(int, step);
+
+    MythFontProperties font;
+    InitFont(font);
+    font.SetShadow(true, QPoint(1, 1), Qt::black, 128);
+
+    QImage screen(1280, 720, QImage::Format_ARGB32_Premultiplied);
+    ImagePainter painter(glyphs);
+    int firstRow = 0;
+
+    QBENCHMARK
+    {
+        screen.fill(Qt::transparent);
+        painter.Begin(&screen);
+        for (int row = 0; row < kGuideRows; ++row)
+        {
+            int channel = firstRow + row;
+            int x = 200;
+            for (int col = 0; col < kGuideColumns && x < screen.width(); ++col)
+            {
+                int width = 120 + (((channel * 5) + (col * 3)) % 7) * 30;
+                QRect cell(x, 100 + (row * kRowHeight), width, kRowHeight);
+                const QString &title = kTitles[((channel * 7) + (col * 3)) % kTitles.size()];
+                painter.DrawText(cell.adjusted(4, 0, -4, 0), title,
+                                 Qt::AlignLeft | Qt::AlignVCenter, font, 255,
+                                 cell.intersected(screen.rect()));
+                x += width;
+            }
+        }
+        painter.End();
+        firstRow += step;
+    }
+}
+
+void TestMythPainter::ImageChangedArea(void)
+{
+    ImagePainter painter(false);
+    MythImage *image = painter.GetFormatImage();
+    image->Assign(QImage(64, 64, QImage::Format_ARGB32_Premultiplied));
+    image->SetChanged(false);
+
+    // Areas add up until the image is uploaded
+    image->AddChangedArea(QRect(0, 0, 8, 8));
+    image->AddChangedArea(QRect(16, 16, 8, 8));
+    QVERIFY(image->IsChanged());
+    QCOMPARE(image->GetChangedArea(), QRect(0, 0, 24, 24));
+
+    // A full change is not narrowed by a later area
+    image->SetChanged();
+    image->AddChangedArea(QRect(0, 0, 8, 8));
+    QCOMPARE(image->GetChangedArea(), image->rect());
+
+    image->SetChanged(false);
+    image->AddChangedArea(QRect(4, 4, 4, 4));
+    QCOMPARE(image->GetChangedArea(), QRect(4, 4, 4, 4));
+    image->DecrRef();
+}
+
+int main(int argc, char **argv)
+{
+    // Text needs a GUI application, but no display
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    QGuiApplication app(argc, argv);
+    TestMythPainter test;
+    return QTest::qExec(&test, argc, argv);
+}
+
+#include "moc_test_mythpainter.cpp"
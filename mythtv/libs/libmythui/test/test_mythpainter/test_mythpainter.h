@@ -0,0 +1,58 @@
+#ifndef LIBMYTHUI_TEST_MYTHPAINTER_H
+#define LIBMYTHUI_TEST_MYTHPAINTER_H
+
+#include <QPainter>
+#include <QTest>
+
+#include "libmythui/mythimage.h"
+#include "libmythui/mythpainter.h"
+
+/// Draws into a QImage with QPainter, like MythQtPainter without the pixmaps.
+class ImagePainter : public MythPainter
+{
+  public:
+    explicit ImagePainter(bool Glyphs)
+    {
+        if (Glyphs)
+            EnableGlyphCache();
+    }
+   ~ImagePainter() override { Teardown(); }
+
+    QString GetName(void) override { return "Image"; }
+    bool SupportsAnimation(void) override { return false; }
+    bool SupportsAlpha(void) override { return true; }
+    bool SupportsClipping(void) override { return false; }
+
+    void Begin(QPaintDevice *Parent) override { m_painter.begin(Parent); }
+    void End(void) override { m_painter.end(); }
+
+    void DrawImage(QRect Dest, MythImage *Image, QRect Source, int Alpha) override
+    {
+        m_painter.setOpacity(Alpha / 255.0);
+        m_painter.drawImage(Dest, *Image, Source);
+    }
+
+  protected:
+    MythImage *GetFormatImagePriv(void) override { return new MythImage(this); }
+    void DeleteFormatImagePriv(MythImage */*Image*/) override { }
+
+  private:
+    QPainter m_painter;
+};
+
+class TestMythPainter : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    static void initTestCase(void);
+    static void cleanupTestCase(void);
+
+    static void GlyphTextClipped(void);
+    static void GlyphTextMatchesImage(void);
+    static void GuideScroll_data(void);
+    static void GuideScroll(void);
+    static void ImageChangedArea(void);
+};
+
+#endif // LIBMYTHUI_TEST_MYTHPAINTER_H
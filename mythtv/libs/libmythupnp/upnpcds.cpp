@@ -28,6 +28,9 @@
 static constexpr const char* DIDL_LITE_BEGIN { R"(<DIDL-Lite xmlns:dc="http://purl.org/dc/elements/1.1/" xmlns:upnp="urn:schemas-upnp-org:metadata-1-0/upnp/" xmlns="urn:schemas-upnp-org:metadata-1-0/DIDL-Lite/">)" };
 static constexpr const char* DIDL_LITE_END   { "</DIDL-Lite>" };
 
+// Most objects an extension keeps in its browse cache
+static constexpr int kMaxCachedObjects { 100000 };
+
 /////////////////////////////////////////////////////////////////////////////
 //
 /////////////////////////////////////////////////////////////////////////////
@@ -195,6 +198,38 @@ void UPnpCDS::UnregisterExtension( UPnpCDSExtension *pExtension )
     }
 }
 
+/**
+ *  \brief Tell control points that the content behind an event has changed
+ *
+ *  Every extension interested in sEvent drops its cached containers. The
+ *  changed extension roots are evented in ContainerUpdateIDs and the
+ *  SystemUpdateID is moved on, so clients know to browse again.
+ */
+
+void UPnpCDS::ContentChanged( const QString &sEvent )
+{
+    QStringList containers;
+
+    for (auto *ext : std::as_const(m_extensions))
+    {
+        if (!ext->IsChangeEvent(sEvent))
+            continue;
+
+        uint16_t nUpdateId = ext->ContentChanged();
+        containers << ext->m_sExtensionId << QString::number(nUpdateId);
+    }
+
+    if (containers.isEmpty())
+        return;
+
+    LOG(VB_UPNP, LOG_INFO, QString("UPnpCDS::ContentChanged: %1 (%2)")
+            .arg(containers.join(','), sEvent));
+
+    SetValue< QString  >( "ContainerUpdateIDs", containers.join(',') );
+    SetValue< uint16_t >( "SystemUpdateID",
+                          GetValue<uint16_t>("SystemUpdateID") + 1 );
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 /////////////////////////////////////////////////////////////////////////////
@@ -794,6 +829,8 @@ void UPnpCDS::HandleGetServiceResetToken(HTTPRequest* pRequest)
 
 UPnpCDSExtension::~UPnpCDSExtension()
 {
+    ClearCache();
+
     if (m_pRoot)
     {
         m_pRoot->DecrRef();
@@ -860,6 +897,8 @@ UPnpCDSExtensionResults *UPnpCDSExtension::Browse( UPnpCDSRequest *pRequest )
                     pRequest->m_sParentId = pRequest->m_sObjectId.section("/", 0, -2);
 
                 LOG(VB_UPNP, LOG_DEBUG, QString("UPnpCDS::Browse: BrowseMetadata (%1)").arg(pRequest->m_sObjectId));
+                // A single object, read from the database rather than the
+                // cache, which only holds the containers browsed so far
                 if (LoadMetadata(pRequest, pResults, tokens, currentToken))
                     return pResults;
                 pResults->m_eErrorCode = UPnPResult_CDS_NoSuchObject;
@@ -870,7 +909,7 @@ UPnpCDSExtensionResults *UPnpCDSExtension::Browse( UPnpCDSRequest *pRequest )
             {
                 pRequest->m_sParentId = pRequest->m_sObjectId;
                 LOG(VB_UPNP, LOG_DEBUG, QString("UPnpCDS::Browse: BrowseDirectChildren (%1)").arg(pRequest->m_sObjectId));
-                if (LoadChildren(pRequest, pResults, tokens, currentToken))
+                if (LoadCachedChildren(pRequest, pResults, tokens, currentToken))
                     return pResults;
                 pResults->m_eErrorCode = UPnPResult_CDS_NoSuchObject;
                 break;
@@ -922,6 +961,8 @@ UPnpCDSExtensionResults *UPnpCDSExtension::Search( UPnpCDSRequest *pRequest )
 
     auto *pResults = new UPnpCDSExtensionResults();
 
+    // Searches do not go through the Browse cache, which is kept per
+    // container. Their results span containers and are not paged the same.
 //    CreateItems( pRequest, pResults, 0, "", false );
 
     return pResults;
@@ -1078,6 +1119,134 @@ QString UPnpCDSExtension::CreateIDString(const QString &requestId,
     return QString("%1/%2=%3").arg(requestId, name, value);
 }
 
+/**
+ *  \brief Answer a 'BrowseDirectChildren' request from the cache
+ *
+ *  The first browse of a container loads all of its children with
+ *  LoadChildren(), every page is then cut from that one list. This keeps
+ *  the database out of clients paging through large containers and makes
+ *  paging stable: a page never shifts because something was added between
+ *  two requests. Containers too large to be loaded at once are paged from
+ *  LoadChildren() as before.
+ */
+bool UPnpCDSExtension::LoadCachedChildren(const UPnpCDSRequest* pRequest,
+                                          UPnpCDSExtensionResults* pResults,
+                                          const IDTokenMap& tokens,
+                                          const QString& currentToken)
+{
+    QMutexLocker locker(&m_cacheLock);
+
+    auto it = m_childCache.constFind(pRequest->m_sObjectId);
+    if (it == m_childCache.constEnd())
+    {
+        uint16_t nUpdateId = m_nUpdateId;
+        locker.unlock();
+
+        UPnpCDSRequest request(*pRequest);
+        request.m_nStartingIndex  = 0;
+        request.m_nRequestedCount = UINT16_MAX;
+
+        UPnpCDSExtensionResults all;
+        if (!LoadChildren(&request, &all, tokens, currentToken))
+            return false;
+
+        if (all.m_List.size() < all.m_nTotalMatches)
+            return LoadChildren(pRequest, pResults, tokens, currentToken);
+
+        locker.relock();
+
+        it = m_childCache.constFind(pRequest->m_sObjectId);
+        if (it == m_childCache.constEnd())
+        {
+            if (nUpdateId != m_nUpdateId)
+            {
+                // Loaded across a change, use it this once
+                locker.unlock();
+                return LoadChildren(pRequest, pResults, tokens, currentToken);
+            }
+
+            CachedChildren children;
+            children.m_objects       = all.m_List;
+            children.m_nTotalMatches = all.m_nTotalMatches;
+            all.m_List.clear(); // The references move to the cache
+
+            while (!m_cacheOrder.isEmpty() &&
+                   m_nCachedObjects + children.m_objects.size() > kMaxCachedObjects)
+            {
+                CachedChildren old = m_childCache.take(m_cacheOrder.takeFirst());
+                m_nCachedObjects -= old.m_objects.size();
+                for (auto *object : std::as_const(old.m_objects))
+                    object->DecrRef();
+            }
+
+            m_nCachedObjects += children.m_objects.size();
+            m_cacheOrder.append(pRequest->m_sObjectId);
+            it = m_childCache.insert(pRequest->m_sObjectId, children);
+
+            LOG(VB_UPNP, LOG_DEBUG, QString("%1: Cached %2 children of %3")
+                    .arg(m_sExtensionId).arg(children.m_objects.size())
+                    .arg(pRequest->m_sObjectId));
+        }
+    }
+    else
+    {
+        m_cacheOrder.removeOne(pRequest->m_sObjectId);
+        m_cacheOrder.append(pRequest->m_sObjectId);
+    }
+
+    const CDSObjects &objects = it->m_objects;
+    int nStart = pRequest->m_nStartingIndex;
+    int nEnd   = std::min(static_cast<int>(objects.size()),
+                          nStart + pRequest->m_nRequestedCount);
+    for (int i = nStart; i < nEnd; ++i)
+        pResults->Add(objects[i]);
+
+    pResults->m_nTotalMatches = it->m_nTotalMatches;
+    pResults->m_nUpdateID     = m_nUpdateId;
+
+    return true;
+}
+
+void UPnpCDSExtension::ClearCache()
+{
+    QMutexLocker locker(&m_cacheLock);
+
+    for (const auto &children : std::as_const(m_childCache))
+        for (auto *object : std::as_const(children.m_objects))
+            object->DecrRef();
+
+    m_childCache.clear();
+    m_cacheOrder.clear();
+    m_nCachedObjects = 0;
+}
+
+bool UPnpCDSExtension::IsChangeEvent(const QString &sEvent) const
+{
+    return std::any_of(m_changeEvents.cbegin(), m_changeEvents.cend(),
+                       [&sEvent](const QString &prefix)
+                           { return sEvent.startsWith(prefix); });
+}
+
+/**
+ *  \brief Drop the cached containers after our content has changed
+ *
+ *  \return The new update ID of our containers
+ */
+uint16_t UPnpCDSExtension::ContentChanged()
+{
+    // Move the update ID on first, so a browse still loading from before the
+    // change will not put its result in the cache
+    m_cacheLock.lock();
+    if (++m_nUpdateId == 0)
+        m_nUpdateId = 1;
+    uint16_t nUpdateId = m_nUpdateId;
+    m_cacheLock.unlock();
+
+    ClearCache();
+
+    return nUpdateId;
+}
+
 void UPnpCDSExtension::CreateRoot()
 {
     LOG(VB_GENERAL, LOG_CRIT, "UPnpCDSExtension::CreateRoot() called on base class");
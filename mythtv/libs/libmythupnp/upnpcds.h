@@ -17,8 +17,10 @@
 #include <utility>
 
 // QT headers
+#include <QHash>
 #include <QList>
 #include <QMap>
+#include <QMutex>
 #include <QObject>
 #include <QString>
 
@@ -210,6 +212,9 @@ class UPNP_PUBLIC UPnpCDSExtension
 
         CDSShortCutList m_shortcuts;
 
+        // Event messages (or their first words) that change our content
+        QStringList     m_changeEvents;
+
     protected:
 
         static QString RemoveToken ( const QString &sToken, const QString &sStr, int num );
@@ -248,6 +253,28 @@ class UPNP_PUBLIC UPnpCDSExtension
 
         CDSObject *m_pRoot {nullptr};
 
+    private:
+
+        bool LoadCachedChildren ( const UPnpCDSRequest *pRequest,
+                                  UPnpCDSExtensionResults *pResults,
+                                  const IDTokenMap& tokens,
+                                  const QString& currentToken );
+        void ClearCache         ( );
+
+        struct CachedChildren
+        {
+            CDSObjects m_objects;          // each holds a reference
+            uint16_t   m_nTotalMatches {0};
+        };
+
+        // Children of the containers browsed so far, loaded in full and
+        // kept until our content changes
+        QMutex                         m_cacheLock;
+        QHash<QString, CachedChildren> m_childCache;
+        QStringList                    m_cacheOrder;   // least recently used first
+        int                            m_nCachedObjects {0};
+        uint16_t                       m_nUpdateId      {1};
+
     public:
 
         UPnpCDSExtension( QString sName,
@@ -264,6 +291,9 @@ class UPNP_PUBLIC UPnpCDSExtension
         virtual UPnpCDSExtensionResults *Browse( UPnpCDSRequest *pRequest );
         virtual UPnpCDSExtensionResults *Search( UPnpCDSRequest *pRequest );
 
+        bool     IsChangeEvent   ( const QString &sEvent ) const;
+        uint16_t ContentChanged  ( );
+
         virtual QString         GetSearchCapabilities() { return ""; }
         virtual QString         GetSortCapabilities  () { return ""; }
         virtual CDSShortCutList GetShortCuts         () { return m_shortcuts; }
@@ -332,6 +362,8 @@ class UPNP_PUBLIC UPnpCDS : public Eventing
                                       const QString &objectID );
         void     RegisterFeature    ( UPnPFeature *feature );
 
+        void     ContentChanged     ( const QString &sEvent );
+
         QStringList GetBasePaths() override; // Eventing
         
         bool ProcessRequest( HTTPRequest *pRequest ) override; // Eventing
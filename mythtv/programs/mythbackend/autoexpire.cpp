@@ -43,6 +43,7 @@
 // MythBackend
 #include "autoexpire.h"
 #include "backendcontext.h"
+#include "deletescheduler.h"
 #include "encoderlink.h"
 #include "mainserver.h"
 
@@ -444,6 +445,10 @@ void AutoExpire::ExpireRecordings(void)
             QString rechost = query.value(0).toString();
             QString recdir  = query.value(1).toString();
 
+            // Deletes on this host report their progress, see below
+            if (rechost == gCoreContext->GetHostName())
+                continue;
+
             LOG(VB_FILE, LOG_INFO, LOC +
                 QString("%1:%2 has an in-progress truncating delete.")
                     .arg(rechost, recdir));
@@ -507,6 +512,22 @@ fsit != fsInfos.end(); ++fsit)
             continue;
         }
 
+        // Space that local deletes have yet to free counts as free
+        if (fsit->getHostname() == gCoreContext->GetHostName())
+        {
+            uint64_t pending = DeleteScheduler::GetPendingBytes(fsit->getPath());
+            if (pending > 0)
+            {
+                fsit->setUsedSpace(std::max((int64_t)0LL,
+                                            fsit->getUsedSpace() -
+                                            (int64_t)(pending / 1024)));
+                LOG(VB_FILE, LOG_INFO,
+                    QString("    %1 MB still being freed by deletes, "
+                            "counting it as free space")
+                        .arg(pending / 1024 / 1024));
+            }
+        }
+
         if (truncateMap.contains(fsit->getFSysID()))
         {
             LOG(VB_FILE, LOG_INFO,
@@ -0,0 +1,363 @@
+// C++
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Qt
+#include <QDeadlineTimer>
+#include <QQueue>
+#include <QWaitCondition>
+
+// MythTV
+#include "libmythbase/mthread.h"
+#include "libmythbase/mythchrono.h"
+#include "libmythbase/mythdbcon.h"
+#include "libmythbase/mythlogging.h"
+#include "libmythbase/threadedfilewriter.h"
+#include "libmythtv/programinfo.h"
+
+#include "deletescheduler.h"
+
+#define LOC QString("DeleteScheduler: ")
+
+// Below this recording write rate a device counts as idle
+static constexpr uint64_t kBusyWriteRate { 512ULL * 1024 };
+// Step size and pause on an idle device
+static constexpr uint64_t kIdleStep      { 256ULL * 1024 * 1024 };
+static constexpr std::chrono::milliseconds kIdleDelay { 50ms };
+// Freeing rate and pause while recordings are written to the device
+static constexpr uint64_t kBusyMinRate   { 64ULL * 1024 * 1024 };
+static constexpr std::chrono::milliseconds kBusyDelay { 500ms };
+// Keep the in use mark fresh, AutoExpire ignores marks older than 2 minutes
+static constexpr std::chrono::seconds kInUseUpdate { 60s };
+
+/// Frees the files queued for one device, one at a time.
+class DeleteWorker : public MThread
+{
+  public:
+    DeleteWorker(dev_t Device, uint64_t SlowRate)
+      : MThread("DeleteWorker"), m_device(Device), m_slowRate(SlowRate),
+        m_sampleBytes(ThreadedFileWriter::GetDeviceBytesWritten(Device)),
+        m_sampleTime(std::chrono::steady_clock::now()) {}
+    ~DeleteWorker() override;
+
+    void     Add(int Fd, const QString &Filename, off_t Size, bool Slow,
+                 ProgramInfo *ProgInfo);
+    uint64_t GetPendingBytes(void);
+    void     Stop(void);
+
+  protected:
+    void run(void) override; // MThread
+
+  private:
+    struct Job
+    {
+        int          m_fd        { -1 };
+        QString      m_filename;
+        off_t        m_remaining { 0 };
+        bool         m_slow      { false };
+        ProgramInfo *m_progInfo  { nullptr };
+    };
+
+    void     Process(Job &Work);
+    bool     Free(Job &Work, uint64_t Bytes);
+    static void Finish(Job &Work);
+    uint64_t WriteRate(void);
+
+    dev_t          m_device;
+    uint64_t       m_slowRate;
+
+    QMutex         m_lock;
+    QWaitCondition m_wait;
+    QQueue<Job>    m_jobs;           // protected by m_lock
+    uint64_t       m_queuedBytes  { 0 };     // protected by m_lock
+    uint64_t       m_currentBytes { 0 };     // protected by m_lock
+    bool           m_stop         { false }; // protected by m_lock
+
+    // Only used on the worker thread
+    bool           m_punchHoles   { true };
+    uint64_t       m_sampleBytes;
+    std::chrono::steady_clock::time_point m_sampleTime;
+    uint64_t       m_writeRate    { 0 };
+};
+
+DeleteWorker::~DeleteWorker()
+{
+    Stop();
+    wait();
+}
+
+void DeleteWorker::Add(int Fd, const QString &Filename, off_t Size, bool Slow,
+                       ProgramInfo *ProgInfo)
+{
+    QMutexLocker locker(&m_lock);
+    m_jobs.enqueue({ Fd, Filename, std::max(Size, static_cast<off_t>(0)), Slow, ProgInfo });
+    m_queuedBytes += std::max(Size, static_cast<off_t>(0));
+    m_wait.wakeAll();
+}
+
+uint64_t DeleteWorker::GetPendingBytes(void)
+{
+    QMutexLocker locker(&m_lock);
+    return m_queuedBytes + m_currentBytes;
+}
+
+void DeleteWorker::Stop(void)
+{
+    QMutexLocker locker(&m_lock);
+    m_stop = true;
+    m_wait.wakeAll();
+}
+
+void DeleteWorker::run(void)
+{
+    RunProlog();
+
+    QMutexLocker locker(&m_lock);
+    while (!m_stop)
+    {
+        if (m_jobs.isEmpty())
+        {
+            m_wait.wait(&m_lock);
+            continue;
+        }
+
+        Job work = m_jobs.dequeue();
+        m_queuedBytes -= work.m_remaining;
+        m_currentBytes = work.m_remaining;
+        locker.unlock();
+
+        Process(work);
+        Finish(work);
+
+        locker.relock();
+        m_currentBytes = 0;
+    }
+
+    // Closing the rest frees them in one go, which is all that is left to
+    // do when the backend is shutting down
+    while (!m_jobs.isEmpty())
+    {
+        Job work = m_jobs.dequeue();
+        Finish(work);
+    }
+    m_queuedBytes = 0;
+    locker.unlock();
+
+    RunEpilog();
+}
+
+void DeleteWorker::Process(Job &Work)
+{
+    if (Work.m_progInfo)
+    {
+        Work.m_progInfo->SetPathname(Work.m_filename);
+        Work.m_progInfo->MarkAsInUse(true, kTruncatingDeleteInUseID);
+    }
+
+    LOG(VB_FILE, LOG_INFO, LOC + QString("Freeing %1 MB of '%2'%3")
+        .arg(Work.m_remaining / (1024.0 * 1024.0), 0, 'f', 1)
+        .arg(Work.m_filename, Work.m_slow ? " slowly" : ""));
+
+    auto inUseTime = std::chrono::steady_clock::now();
+
+    // Start a new write rate sample, the previous one may be from a job
+    // that finished hours ago, and get a first measurement.
+    m_sampleBytes = ThreadedFileWriter::GetDeviceBytesWritten(m_device);
+    m_sampleTime = inUseTime;
+    QMutexLocker locker(&m_lock);
+    QDeadlineTimer firstSample(1s);
+    while (!m_stop && !firstSample.hasExpired())
+        m_wait.wait(&m_lock, firstSample);
+
+    while (Work.m_remaining > 0 && !m_stop)
+    {
+        locker.unlock();
+
+        uint64_t rate = WriteRate();
+        uint64_t step = kIdleStep;
+        std::chrono::milliseconds delay = kIdleDelay;
+        if (Work.m_slow || rate >= kBusyWriteRate)
+        {
+            uint64_t freeRate = Work.m_slow ? std::max(m_slowRate, rate * 6 / 5)
+                                            : std::max(kBusyMinRate, rate * 2);
+            step = freeRate * kBusyDelay.count() / 1000;
+            delay = kBusyDelay;
+        }
+
+        bool ok = Free(Work, step);
+
+        if (Work.m_progInfo &&
+            (std::chrono::steady_clock::now() - inUseTime) >= kInUseUpdate)
+        {
+            Work.m_progInfo->UpdateInUseMark(true);
+            inUseTime = std::chrono::steady_clock::now();
+        }
+
+        locker.relock();
+        m_currentBytes = Work.m_remaining;
+        if (!ok)
+            break;
+        if (Work.m_remaining > 0 && !m_stop)
+            m_wait.wait(&m_lock, delay.count());
+    }
+}
+
+/// Free the last Bytes of what is left of the file.
+bool DeleteWorker::Free(Job &Work, uint64_t Bytes)
+{
+    off_t length = std::min(static_cast<off_t>(Bytes), Work.m_remaining);
+    off_t offset = Work.m_remaining - length;
+
+#ifdef FALLOC_FL_PUNCH_HOLE
+    if (m_punchHoles)
+    {
+        if (fallocate(Work.m_fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                      offset, length) == 0)
+        {
+            Work.m_remaining = offset;
+            return true;
+        }
+        LOG(VB_FILE, LOG_INFO, LOC +
+            QString("Unable to punch holes in '%1', truncating instead")
+                .arg(Work.m_filename) + ENO);
+        m_punchHoles = false;
+    }
+#endif
+
+    if (ftruncate(Work.m_fd, offset) != 0)
+    {
+        LOG(VB_GENERAL, LOG_ERR, LOC + QString("Error truncating '%1'")
+                .arg(Work.m_filename) + ENO);
+        return false;
+    }
+    Work.m_remaining = offset;
+    return true;
+}
+
+void DeleteWorker::Finish(Job &Work)
+{
+    if (close(Work.m_fd) != 0)
+    {
+        LOG(VB_GENERAL, LOG_ERR, LOC + QString("Error closing '%1'")
+                .arg(Work.m_filename) + ENO);
+    }
+
+    if (Work.m_progInfo)
+    {
+        Work.m_progInfo->MarkAsInUse(false, kTruncatingDeleteInUseID);
+        delete Work.m_progInfo;
+        Work.m_progInfo = nullptr;
+    }
+
+    LOG(VB_FILE, LOG_INFO, LOC + QString("Finished freeing '%1'")
+        .arg(Work.m_filename));
+}
+
+/// Bytes per second that recordings are writing to this device.
+uint64_t DeleteWorker::WriteRate(void)
+{
+    auto now = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_sampleTime);
+    if (elapsed >= 1s)
+    {
+        uint64_t bytes = ThreadedFileWriter::GetDeviceBytesWritten(m_device);
+        m_writeRate = (bytes - m_sampleBytes) * 1000 / elapsed.count();
+        m_sampleBytes = bytes;
+        m_sampleTime = now;
+    }
+    return m_writeRate;
+}
+
+DeleteScheduler *DeleteScheduler::s_scheduler = nullptr;
+QMutex           DeleteScheduler::s_schedulerLock;
+
+DeleteScheduler *DeleteScheduler::GetScheduler(void)
+{
+    QMutexLocker locker(&s_schedulerLock);
+    if (!s_scheduler)
+        s_scheduler = new DeleteScheduler();
+    return s_scheduler;
+}
+
+void DeleteScheduler::Shutdown(void)
+{
+    QMutexLocker locker(&s_schedulerLock);
+    delete s_scheduler;
+    s_scheduler = nullptr;
+}
+
+/// Bytes that deletes have yet to free on the filesystem holding Path.
+uint64_t DeleteScheduler::GetPendingBytes(const QString &Path)
+{
+    struct stat st {};
+    if (stat(Path.toLocal8Bit().constData(), &st) != 0)
+        return 0;
+
+    QMutexLocker locker(&s_schedulerLock);
+    if (!s_scheduler)
+        return 0;
+
+    QMutexLocker workers(&s_scheduler->m_lock);
+    DeleteWorker *worker = s_scheduler->m_workers.value(static_cast<quint64>(st.st_dev));
+    return worker ? worker->GetPendingBytes() : 0;
+}
+
+DeleteScheduler::DeleteScheduler()
+{
+    // The TruncateDeletesSlowly rate, somewhat faster than all the capture
+    // cards could record at once
+    int cards = 5;
+    MSqlQuery query(MSqlQuery::InitCon());
+    query.prepare("SELECT COUNT(cardid) FROM capturecard;");
+    if (query.exec() && query.next())
+        cards = query.value(0).toInt();
+
+    const uint64_t minRate  = 8ULL * 1024 * 1024;
+    const auto     calcRate = static_cast<uint64_t>(cards * 1.2 * (22200000LL / 8.0));
+    m_slowRate = std::max(minRate, calcRate);
+}
+
+DeleteScheduler::~DeleteScheduler()
+{
+    QMutexLocker locker(&m_lock);
+    for (auto *worker : std::as_const(m_workers))
+        delete worker;
+    m_workers.clear();
+}
+
+/** \brief Free an unlinked file in the background and close it when done.
+ *
+ *  \param Fd       Descriptor of the unlinked file, owned by the scheduler
+ *                  from now on.
+ *  \param Size     File size, taken before unlinking it.
+ *  \param Slow     Keep to the TruncateDeletesSlowly pace.
+ *  \param ProgInfo Recording to mark as being deleted while this runs.
+ */
+void DeleteScheduler::Add(int Fd, const QString &Filename, off_t Size,
+                          bool Slow, const ProgramInfo *ProgInfo)
+{
+    struct stat st {};
+    if (fstat(Fd, &st) != 0)
+    {
+        LOG(VB_GENERAL, LOG_ERR, LOC + QString("Unable to stat '%1'")
+                .arg(Filename) + ENO);
+        close(Fd);
+        return;
+    }
+
+    QMutexLocker locker(&m_lock);
+    auto device = static_cast<quint64>(st.st_dev);
+    DeleteWorker *worker = m_workers.value(device);
+    if (!worker)
+    {
+        worker = new DeleteWorker(st.st_dev, m_slowRate);
+        worker->start();
+        m_workers.insert(device, worker);
+    }
+
+    worker->Add(Fd, Filename, Size, Slow,
+                ProgInfo ? new ProgramInfo(*ProgInfo) : nullptr);
+}
@@ -0,0 +1,58 @@
+#ifndef DELETESCHEDULER_H
+#define DELETESCHEDULER_H
+
+// C++
+#include <cstdint>
+#include <sys/types.h>
+
+// Qt
+#include <QHash>
+#include <QMutex>
+#include <QString>
+
+class DeleteWorker;
+class ProgramInfo;
+
+/*! \brief Frees the disk space of deleted files in the background.
+ *
+ * MainServer unlinks a deleted recording at once and hands the still open
+ * file descriptor to the scheduler, which gives the space back a piece at a
+ * time so the filesystem journal never has to free a whole recording in one
+ * go. Each filesystem has its own worker thread; files on the same
+ * filesystem are freed one after the other, different filesystems in
+ * parallel.
+ *
+ * Space is freed from the end of the file with FALLOC_FL_PUNCH_HOLE, or with
+ * ftruncate() where hole punching is not supported. The size of each step
+ * follows the rate at which recordings are currently being written to the
+ * same device: with no recordings on it a file is freed in large steps,
+ * otherwise just fast enough to stay ahead of the recordings. The
+ * TruncateDeletesSlowly setting keeps the old, gentler pace at all times.
+ *
+ * GetPendingBytes() reports what is still to be freed so AutoExpire can
+ * count it as free space.
+ */
+class DeleteScheduler
+{
+  public:
+    static DeleteScheduler *GetScheduler(void);
+    static void Shutdown(void);
+    static uint64_t GetPendingBytes(const QString &Path);
+
+    void Add(int Fd, const QString &Filename, off_t Size, bool Slow,
+             const ProgramInfo *ProgInfo = nullptr);
+
+  private:
+    DeleteScheduler();
+    ~DeleteScheduler();
+    Q_DISABLE_COPY(DeleteScheduler)
+
+    static DeleteScheduler *s_scheduler;
+    static QMutex           s_schedulerLock;
+
+    QMutex                         m_lock;
+    QHash<quint64, DeleteWorker *> m_workers;
+    uint64_t                       m_slowRate { 0 };
+};
+
+#endif // DELETESCHEDULER_H
@@ -80,6 +80,7 @@
 // mythbackend headers
 #include "autoexpire.h"
 #include "backendcontext.h"
+#include "deletescheduler.h"
 #include "scheduler.h"
 
 /** Milliseconds to wait for an existing thread from
@@ -136,7 +137,6 @@ bool delete_file_immediately(const QString &filename,
 
 };
 
-QMutex MainServer::s_truncate_and_close_lock;
 const std::chrono::milliseconds MainServer::kMasterServerReconnectTimeout { 1s };
 
 class BEProcessRequestRunnable : public QRunnable
@@ -541,6 +541,13 @@ void MainServer::ProcessRequestWork(MythSocket *sock)
         else
             HandleQueryRecordings(tokens[1], pbs);
     }
+    else if (command == "QUERY_RECORDINGS_CHANGED")
+    {
+        if (tokens.size() != 3)
+            SendErrorResponse(pbs, "Bad QUERY_RECORDINGS_CHANGED query");
+        else
+            HandleQueryRecordingsChanged(tokens, pbs);
+    }
     else if (command == "QUERY_RECORDING")
     {
         HandleQueryRecording(tokens, pbs);
@@ -1516,6 +1523,8 @@ void MainServer::customEvent(QEvent *e)
                 return;
 
             ProgramInfo evinfo(recordedid);
+            if (m_ismaster)
+                m_recChanges.Changed(recordedid);
             if (evinfo.GetChanID())
             {
                 QDateTime rectime = MythDate::current().addSecs(
@@ -1534,6 +1543,24 @@ void MainServer::customEvent(QEvent *e)
             }
         }
 
+        if (m_ismaster && me->Message().startsWith("RECORDING_LIST_CHANGE"))
+        {
+            QStringList tokens = me->Message().simplified().split(" ");
+            if (tokens.size() == 1)
+                m_recChanges.Reset();
+            else if (tokens.size() >= 3 && tokens[1] == "ADD")
+                m_recChanges.Changed(tokens[2].toUInt());
+            else if (tokens.size() >= 3 && tokens[1] == "DELETE")
+                m_recChanges.Changed(tokens[2].toUInt(), true);
+        }
+
+        if (m_ismaster && me->Message().startsWith("UPDATE_FILE_SIZE"))
+        {
+            QStringList tokens = me->Message().simplified().split(" ");
+            if (tokens.size() >= 2)
+                m_recChanges.Changed(tokens[1].toUInt());
+        }
+
         if (me->Message().startsWith("DOWNLOAD_FILE"))
         {
             QStringList extraDataList = me->ExtraDataList();
@@ -2192,93 +2219,169 @@ void MainServer::HandleQueryRecordings(const QString& type, PlaybackSock *pbs)
 
     QStringList outputlist(QString::number(destination.size()));
     QMap<QString, int> backendPortMap;
-    int port = gCoreContext->GetBackendServerPort();
-    QString host = gCoreContext->GetHostName();
 
     for (auto* proginfo : destination)
     {
-        PlaybackSock *slave = nullptr;
+        FillRecordingPathname(proginfo, playbackhost, backendPortMap);
+        proginfo->ToStringList(outputlist);
+    }
 
-        if (proginfo->GetHostname() != gCoreContext->GetHostName())
-            slave = GetSlaveByHostname(proginfo->GetHostname());
+    SendResponse(pbssock, outputlist);
+}
 
-        if ((proginfo->GetHostname() == gCoreContext->GetHostName()) ||
-            (!slave && m_masterBackendOverride))
+/// Set the playback URL (and file size, if unknown) of a recording
+void MainServer::FillRecordingPathname(ProgramInfo *proginfo,
+                                       const QString &playbackhost,
+                                       QMap<QString, int> &backendPortMap)
+{
+    int port = gCoreContext->GetBackendServerPort();
+    QString host = gCoreContext->GetHostName();
+
+    PlaybackSock *slave = nullptr;
+
+    if (proginfo->GetHostname() != gCoreContext->GetHostName())
+        slave = GetSlaveByHostname(proginfo->GetHostname());
+
+    if ((proginfo->GetHostname() == gCoreContext->GetHostName()) ||
+        (!slave && m_masterBackendOverride))
+    {
+        proginfo->SetPathname(MythCoreContext::GenMythURL(host,port,
+                                                          proginfo->GetBasename()));
+        if (!proginfo->GetFilesize())
         {
-            proginfo->SetPathname(MythCoreContext::GenMythURL(host,port,
-                                                              proginfo->GetBasename()));
-            if (!proginfo->GetFilesize())
+            QString tmpURL = GetPlaybackURL(proginfo);
+            if (tmpURL.startsWith('/'))
             {
-                QString tmpURL = GetPlaybackURL(proginfo);
-                if (tmpURL.startsWith('/'))
+                QFile checkFile(tmpURL);
+                if (!tmpURL.isEmpty() && checkFile.exists())
                 {
-                    QFile checkFile(tmpURL);
-                    if (!tmpURL.isEmpty() && checkFile.exists())
+                    proginfo->SetFilesize(checkFile.size());
+                    if (proginfo->GetRecordingEndTime() <
+                        MythDate::current())
                     {
-                        proginfo->SetFilesize(checkFile.size());
-                        if (proginfo->GetRecordingEndTime() <
-                            MythDate::current())
-                        {
-                            proginfo->SaveFilesize(proginfo->GetFilesize());
-                        }
+                        proginfo->SaveFilesize(proginfo->GetFilesize());
                     }
                 }
             }
         }
-        else if (!slave)
+    }
+    else if (!slave)
+    {
+        proginfo->SetPathname(GetPlaybackURL(proginfo));
+        if (proginfo->GetPathname().isEmpty())
         {
-            proginfo->SetPathname(GetPlaybackURL(proginfo));
-            if (proginfo->GetPathname().isEmpty())
-            {
-                LOG(VB_GENERAL, LOG_ERR, LOC +
-                    QString("HandleQueryRecordings() "
-                            "Couldn't find backend for:\n\t\t\t%1")
-                        .arg(proginfo->toString(ProgramInfo::kTitleSubtitle)));
+            LOG(VB_GENERAL, LOG_ERR, LOC +
+                QString("HandleQueryRecordings() "
+                        "Couldn't find backend for:\n\t\t\t%1")
+                    .arg(proginfo->toString(ProgramInfo::kTitleSubtitle)));
 
-                proginfo->SetFilesize(0);
-                proginfo->SetPathname("file not found");
-            }
+            proginfo->SetFilesize(0);
+            proginfo->SetPathname("file not found");
         }
-        else
+    }
+    else
+    {
+        if (!proginfo->GetFilesize())
         {
-            if (!proginfo->GetFilesize())
+            if (!slave->FillProgramInfo(*proginfo, playbackhost))
             {
-                if (!slave->FillProgramInfo(*proginfo, playbackhost))
-                {
-                    LOG(VB_GENERAL, LOG_ERR, LOC +
-                        "MainServer::HandleQueryRecordings()"
-                        "\n\t\t\tCould not fill program info "
-                        "from backend");
-                }
-                else
-                {
-                    if (proginfo->GetRecordingEndTime() <
-                        MythDate::current())
-                    {
-                        proginfo->SaveFilesize(proginfo->GetFilesize());
-                    }
-                }
+                LOG(VB_GENERAL, LOG_ERR, LOC +
+                    "MainServer::HandleQueryRecordings()"
+                    "\n\t\t\tCould not fill program info "
+                    "from backend");
             }
             else
             {
-                ProgramInfo *p      = proginfo;
-                QString hostname    = p->GetHostname();
+                if (proginfo->GetRecordingEndTime() <
+                    MythDate::current())
+                {
+                    proginfo->SaveFilesize(proginfo->GetFilesize());
+                }
+            }
+        }
+        else
+        {
+            ProgramInfo *p      = proginfo;
+            QString hostname    = p->GetHostname();
 
-                if (!backendPortMap.contains(hostname))
-                    backendPortMap[hostname] = gCoreContext->GetBackendServerPort(hostname);
+            if (!backendPortMap.contains(hostname))
+                backendPortMap[hostname] = gCoreContext->GetBackendServerPort(hostname);
 
-                p->SetPathname(MythCoreContext::GenMythURL(hostname,
-                                                           backendPortMap[hostname],
-                                                           p->GetBasename()));
-            }
+            p->SetPathname(MythCoreContext::GenMythURL(hostname,
+                                                       backendPortMap[hostname],
+                                                       p->GetBasename()));
         }
+    }
 
-        if (slave)
-            slave->DecrRef();
+    if (slave)
+        slave->DecrRef();
+}
 
+/**
+ * \addtogroup myth_network_protocol
+ * \par        QUERY_RECORDINGS_CHANGED \e epoch \e generation
+ * Returns the recordings changed since \e generation, as \e epoch,
+ * \e generation, "DELTA", the number of deleted recordings, their recording
+ * ids, the number of changed recordings and their programinfo. Returns
+ * \e epoch, \e generation, "FULL" if the client must use QUERY_RECORDINGS
+ * to reload every recording instead, which is always the case for an
+ * \e epoch of 0.
+ */
+void MainServer::HandleQueryRecordingsChanged(const QStringList &tokens,
+                                              PlaybackSock *pbs)
+{
+    MythSocket *pbssock = pbs->getSocket();
+
+    std::vector<uint> changed;
+    std::vector<uint> deleted;
+    qint64 epoch = 0;
+    uint64_t generation = 0;
+    bool delta = m_recChanges.GetChangesSince(
+        tokens[1].toLongLong(), tokens[2].toULongLong(),
+        changed, deleted, epoch, generation);
+
+    QStringList outputlist { QString::number(epoch), QString::number(generation) };
+    if (!delta)
+    {
+        outputlist << "FULL";
+        SendResponse(pbssock, outputlist);
+        return;
+    }
+
+    ProgramList programs;
+    QDateTime rectime = MythDate::current().addSecs(
+        -gCoreContext->GetNumSetting("RecordOverTime"));
+    for (uint recordedid : changed)
+    {
+        auto *proginfo = new ProgramInfo(recordedid);
+        if (!proginfo->GetChanID())
+        {
+            // Gone since it was changed
+            delete proginfo;
+            deleted.push_back(recordedid);
+            continue;
+        }
+        if (m_sched && proginfo->GetRecordingEndTime() > rectime)
+            proginfo->SetRecordingStatus(m_sched->GetRecStatus(*proginfo));
+        programs.push_back(proginfo);
+    }
+
+    outputlist << "DELTA" << QString::number(deleted.size());
+    for (uint recordedid : deleted)
+        outputlist << QString::number(recordedid);
+
+    outputlist << QString::number(programs.size());
+    QMap<QString, int> backendPortMap;
+    for (auto *proginfo : programs)
+    {
+        FillRecordingPathname(proginfo, pbs->getHostname(), backendPortMap);
         proginfo->ToStringList(outputlist);
     }
 
+    LOG(VB_GENERAL, LOG_DEBUG, LOC +
+        QString("Sending %1 changed and %2 deleted recordings since %3")
+        .arg(programs.size()).arg(deleted.size()).arg(tokens[2]));
+
     SendResponse(pbssock, outputlist);
 }
 
@@ -2450,11 +2553,10 @@ void MainServer::DoDeleteThread(DeleteStruct *ds)
     // TODO Move the following into DeleteRecordedFiles
     //-----------------------------------------------------------------------
 
-    // Delete recording.
-    if (slowDeletes)
+    // Delete recording. The space is freed afterwards by the
+    // DeleteScheduler, since stat fails after unlinking on some
+    // filesystems get the filesize first.
     {
-        // Since stat fails after unlinking on some filesystems,
-        // get the filesize first
         const QFileInfo info(ds->m_filename);
         size = info.size();
         fd = DeleteFile(ds->m_filename, followLinks, ds->m_forceMetadataDelete);
@@ -2462,13 +2564,6 @@ void MainServer::DoDeleteThread(DeleteStruct *ds)
         if ((fd < 0) && checkFile.exists())
             errmsg = true;
     }
-    else
-    {
-        delete_file_immediately(ds->m_filename, followLinks, false);
-        std::this_thread::sleep_for(2s);
-        if (checkFile.exists())
-            errmsg = true;
-    }
 
     if (errmsg)
     {
@@ -2514,8 +2609,11 @@ void MainServer::DoDeleteThread(DeleteStruct *ds)
 
     m_deletelock.unlock();
 
-    if (slowDeletes && fd >= 0)
-        TruncateAndClose(&pginfo, fd, ds->m_filename, size);
+    if (fd >= 0)
+    {
+        DeleteScheduler::GetScheduler()->Add(fd, ds->m_filename, size,
+                                             slowDeletes, &pginfo);
+    }
 }
 
 void MainServer::DeleteRecordedFiles(DeleteStruct *ds)
@@ -2652,9 +2750,9 @@ void MainServer::DoDeleteInDB(DeleteStruct *ds)
 /**
  *  \brief Deletes links and unlinks the main file and returns the descriptor.
  *
- *  This is meant to be used with TruncateAndClose() to slowly shrink a
- *  large file and then eventually delete the file by closing the file
- *  descriptor.
+ *  This is meant to be used with the DeleteScheduler, which frees the space
+ *  of a large file a piece at a time and then eventually deletes the file
+ *  by closing the file descriptor.
  *
  *  \return fd for success, -1 for error, -2 for only a symlink deleted.
  */
@@ -2753,87 +2851,6 @@ int MainServer::OpenAndUnlink(const QString &filename)
     return fd;
 }
 
-/**
- *  \brief Repeatedly truncate an open file in small increments.
- *
- *   When the file is small enough this closes the file and returns.
- *
- *   NOTE: This acquires a lock so that only one instance of TruncateAndClose()
- *         is running at a time.
- */
-bool MainServer::TruncateAndClose(ProgramInfo *pginfo, int fd,
-                                  const QString &filename, off_t fsize)
-{
-    QMutexLocker locker(&s_truncate_and_close_lock);
-
-    if (pginfo)
-    {
-        pginfo->SetPathname(filename);
-        pginfo->MarkAsInUse(true, kTruncatingDeleteInUseID);
-    }
-
-    int cards = 5;
-    {
-        MSqlQuery query(MSqlQuery::InitCon());
-        query.prepare("SELECT COUNT(cardid) FROM capturecard;");
-        if (query.exec() && query.next())
-            cards = query.value(0).toInt();
-    }
-
-    // Time between truncation steps in milliseconds
-    constexpr std::chrono::milliseconds sleep_time = 500ms;
-    const size_t min_tps    = 8LL * 1024 * 1024;
-    const auto calc_tps     = (size_t) (cards * 1.2 * (22200000LL / 8.0));
-    const size_t tps        = std::max(min_tps, calc_tps);
-    const auto increment    = (size_t) (tps * (sleep_time.count() * 0.001F));
-
-    LOG(VB_FILE, LOG_INFO, LOC +
-        QString("Truncating '%1' by %2 MB every %3 milliseconds")
-            .arg(filename)
-            .arg(increment / (1024.0 * 1024.0), 0, 'f', 2)
-            .arg(sleep_time.count()));
-
-    GetMythDB()->GetDBManager()->PurgeIdleConnections(false);
-
-    int count = 0;
-    while (fsize > 0)
-    {
-#if 0
-        LOG(VB_FILE, LOG_DEBUG, LOC + QString("Truncating '%1' to %2 MB")
-                .arg(filename).arg(fsize / (1024.0 * 1024.0), 0, 'f', 2));
-#endif
-
-        int err = ftruncate(fd, fsize);
-        if (err)
-        {
-            LOG(VB_GENERAL, LOG_ERR, LOC + QString("Error truncating '%1'")
-                    .arg(filename) + ENO);
-            if (pginfo)
-                pginfo->MarkAsInUse(false, kTruncatingDeleteInUseID);
-            return 0 == close(fd);
-        }
-
-        fsize -= increment;
-
-        if (pginfo && ((count % 100) == 0))
-            pginfo->UpdateInUseMark(true);
-
-        count++;
-
-        std::this_thread::sleep_for(sleep_time);
-    }
-
-    bool ok = (0 == close(fd));
-
-    if (pginfo)
-        pginfo->MarkAsInUse(false, kTruncatingDeleteInUseID);
-
-    LOG(VB_FILE, LOG_INFO, LOC +
-        QString("Finished truncating '%1'").arg(filename));
-
-    return ok;
-}
-
 void MainServer::HandleCheckRecordingActive(QStringList &slist,
                                             PlaybackSock *pbs)
 {
@@ -5368,15 +5385,9 @@ void TruncateThread::run(void)
 
 void MainServer::DoTruncateThread(DeleteStruct *ds)
 {
-    if (gCoreContext->GetBoolSetting("TruncateDeletesSlowly", false))
-    {
-        TruncateAndClose(nullptr, ds->m_fd, ds->m_filename, ds->m_size);
-    }
-    else
-    {
-        QMutexLocker dl(&m_deletelock);
-        close(ds->m_fd);
-    }
+    bool slowDeletes = gCoreContext->GetBoolSetting("TruncateDeletesSlowly", false);
+    DeleteScheduler::GetScheduler()->Add(ds->m_fd, ds->m_filename, ds->m_size,
+                                         slowDeletes);
 }
 
 bool MainServer::HandleDeleteFile(const QStringList &slist, PlaybackSock *pbs)
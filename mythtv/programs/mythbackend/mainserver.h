@@ -28,6 +28,7 @@
 #include "encoderlink.h"
 #include "filetransfer.h"
 #include "playbacksock.h"
+#include "recordingchangelog.h"
 #include "scheduler.h"
 
 #ifdef DeleteFile
@@ -179,6 +180,11 @@ class MainServer : public QObject, public MythSocketCBs
     bool HandleDeleteFile(const QString& filename, const QString& storagegroup,
                           PlaybackSock *pbs = nullptr);
     void HandleQueryRecordings(const QString& type, PlaybackSock *pbs);
+    void HandleQueryRecordingsChanged(const QStringList &tokens,
+                                      PlaybackSock *pbs);
+    void FillRecordingPathname(ProgramInfo *proginfo,
+                               const QString &playbackhost,
+                               QMap<QString, int> &backendPortMap);
     void HandleQueryRecording(QStringList &slist, PlaybackSock *pbs);
     void HandleStopRecording(QStringList &slist, PlaybackSock *pbs);
     void DoHandleStopRecording(RecordingInfo &recinfo, PlaybackSock *pbs);
@@ -303,9 +309,6 @@ class MainServer : public QObject, public MythSocketCBs
     static int  DeleteFile(const QString &filename, bool followLinks,
                            bool deleteBrokenSymlinks = false);
     static int  OpenAndUnlink(const QString &filename);
-    static bool TruncateAndClose(ProgramInfo *pginfo,
-                                 int fd, const QString &filename,
-                                 off_t fsize);
 
     std::vector<LiveTVChain*> m_liveTVChains;
     QMutex               m_liveTVChainsLock;
@@ -331,6 +334,8 @@ class MainServer : public QObject, public MythSocketCBs
 
     bool m_ismaster;
 
+    RecordingChangeLog m_recChanges;
+
     QMutex m_deletelock;
     MThreadPool m_threadPool;
 
@@ -351,7 +356,6 @@ class MainServer : public QObject, public MythSocketCBs
     MythDeque<DeferredDeleteStruct> m_deferredDeleteList;
 
     QTimer *m_autoexpireUpdateTimer          {nullptr}; // audited ref #5318
-    static QMutex s_truncate_and_close_lock;
 
     FileSystemInfoList    m_fsInfosCache;
     QMutex                m_fsInfosCacheLock;
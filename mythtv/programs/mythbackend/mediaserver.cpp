@@ -190,13 +190,12 @@ void MediaServer::Init(bool bIsMaster, bool bDisableUPnp /* = false */)
                 "MediaServer: Registering UPnpCDSVideo Extension");
 
             RegisterExtension(new UPnpCDSVideo());
-        }
 
-#if 0
-        LOG(VB_UPNP, LOG_INFO, "MediaServer::Adding Context Listener");
+            // Recording, video and music changes invalidate the CDS cache
+            LOG(VB_UPNP, LOG_INFO, "MediaServer::Adding Context Listener");
 
-        gCoreContext->addListener( this );
-#endif
+            gCoreContext->addListener( this );
+        }
 
         Start();
 
@@ -227,9 +226,8 @@ MediaServer::~MediaServer()
 {
     // -=>TODO: Need to check to see if calling this more than once is ok.
 
-#if 0
-    gCoreContext->removeListener(this);
-#endif
+    if (gCoreContext)
+        gCoreContext->removeListener(this);
 
     delete m_webSocketServer;
     delete m_pHttpServer;
@@ -242,18 +240,19 @@ MediaServer::~MediaServer()
 //////////////////////////////////////////////////////////////////////////////
 //
 //////////////////////////////////////////////////////////////////////////////
-#if 0
+
 void MediaServer::customEvent( QEvent *e )
 {
-    if (MythEvent::Type(e->type()) == MythEvent::MythEventMessage)
-    {
-        MythEvent *me = static_cast<MythEvent *>(e);
-        QString message = me->Message();
+    if (e->type() != MythEvent::kMythEventMessage || !m_pUPnpCDS)
+        return;
 
-        //-=>TODO: Need to handle events to notify clients of changes
-    }
+    auto *me = dynamic_cast<MythEvent *>(e);
+    if (me == nullptr)
+        return;
+
+    m_pUPnpCDS->ContentChanged( me->Message() );
 }
-#endif
+
 //////////////////////////////////////////////////////////////////////////////
 //
 //////////////////////////////////////////////////////////////////////////////
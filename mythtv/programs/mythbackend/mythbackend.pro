@@ -23,7 +23,8 @@ HEADERS += playbacksock.h scheduler.h backendhousekeeper.h
 HEADERS += upnpcdstv.h upnpcdsmusic.h upnpcdsvideo.h mediaserver.h
 HEADERS += internetContent.h mythbackend_main_helpers.h backendcontext.h
 HEADERS += mythsettings.h mythbackend_commandlineparser.h
-HEADERS += recordingextender.h
+HEADERS += recordingchangelog.h recordingextender.h scaledimagecache.h
+HEADERS += deletescheduler.h
 
 SOURCES += autoexpire.cpp encoderlink.cpp filetransfer.cpp httpstatus.cpp
 SOURCES += mythbackend.cpp mainserver.cpp playbacksock.cpp scheduler.cpp
@@ -31,7 +32,8 @@ SOURCES += backendhousekeeper.cpp
 SOURCES += upnpcdstv.cpp upnpcdsmusic.cpp upnpcdsvideo.cpp mediaserver.cpp
 SOURCES += internetContent.cpp mythbackend_main_helpers.cpp backendcontext.cpp
 SOURCES += mythsettings.cpp mythbackend_commandlineparser.cpp
-SOURCES += recordingextender.cpp
+SOURCES += recordingchangelog.cpp recordingextender.cpp scaledimagecache.cpp
+SOURCES += deletescheduler.cpp
 
 HEADERS += servicesv2/v2myth.h servicesv2/v2connectionInfo.h servicesv2/v2wolInfo.h
 HEADERS += servicesv2/v2databaseInfo.h servicesv2/v2versionInfo.h
@@ -53,6 +55,7 @@ HEADERS += servicesv2/v2blurayInfo.h
 HEADERS += servicesv2/v2country.h servicesv2/v2countryList.h
 HEADERS += servicesv2/v2language.h servicesv2/v2languageList.h
 HEADERS += servicesv2/v2databaseStatus.h servicesv2/v2systemEventList.h
+HEADERS += servicesv2/v2databaseStatement.h servicesv2/v2databaseStats.h
 
 
 HEADERS += servicesv2/v2dvr.h servicesv2/v2recording.h
@@ -51,6 +51,7 @@ static inline void be_sd_notify(const char */*str*/) {};
 #include "autoexpire.h"
 #include "backendcontext.h"
 #include "backendhousekeeper.h"
+#include "deletescheduler.h"
 #include "encoderlink.h"
 #include "httpstatus.h"
 #include "mainserver.h"
@@ -315,6 +316,9 @@ void cleanup(void)
     delete mainServer;
     mainServer = nullptr;
 
+    StorageGroup::DisableFileIndex();
+    DeleteScheduler::Shutdown();
+
      delete gBackendContext;
      gBackendContext = nullptr;
 }
@@ -709,6 +713,7 @@ int run_backend(MythBackendCommandLineParser &cmdline)
 
     be_sd_notify("STATUS=Check all storage groups");
     StorageGroup::CheckAllStorageGroupDirs();
+    StorageGroup::EnableFileIndex();
 
     be_sd_notify("STATUS=Sending \"master started\" message");
     if (gCoreContext->IsMasterBackend())
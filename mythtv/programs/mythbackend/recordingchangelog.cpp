@@ -0,0 +1,85 @@
+// Qt
+#include <QDateTime>
+
+// MythTV
+#include "libmythbase/mythlogging.h"
+
+// MythBackend
+#include "recordingchangelog.h"
+
+#define LOC QString("RecChangeLog: ")
+
+// The most changes remembered before the oldest are dropped.
+static constexpr uint64_t kMaxChanges { 10000 };
+// Beyond this many changes a full reload is cheaper than a delta.
+static constexpr size_t   kMaxDelta   { 1000 };
+
+RecordingChangeLog::RecordingChangeLog()
+  : m_epoch(QDateTime::currentMSecsSinceEpoch())
+{
+}
+
+/// Note that a recording has been added, updated or deleted.
+void RecordingChangeLog::Changed(uint RecordedId, bool Deleted)
+{
+    if (!RecordedId)
+        return;
+
+    QMutexLocker locker(&m_lock);
+    m_changes[RecordedId] = { ++m_generation, Deleted };
+
+    if (static_cast<uint64_t>(m_changes.size()) <= kMaxChanges)
+        return;
+
+    // Forget the older half, anyone behind that has to reload everything.
+    m_oldest = m_generation - (kMaxChanges / 2);
+    for (auto it = m_changes.begin(); it != m_changes.end(); )
+    {
+        if (it->m_generation <= m_oldest)
+            it = m_changes.erase(it);
+        else
+            ++it;
+    }
+    LOG(VB_GENERAL, LOG_DEBUG, LOC + QString("Pruned to generation %1")
+        .arg(m_oldest));
+}
+
+/// Note that any recording may have changed.
+void RecordingChangeLog::Reset(void)
+{
+    QMutexLocker locker(&m_lock);
+    m_oldest = ++m_generation;
+    m_changes.clear();
+}
+
+/*! \brief Get the recordings changed after the given generation.
+ *
+ * \return false if the caller has to reload the whole recording list,
+ *         CurrentEpoch and CurrentGeneration are valid either way.
+ */
+bool RecordingChangeLog::GetChangesSince(qint64 Epoch, uint64_t Generation,
+                                         std::vector<uint> &Changed,
+                                         std::vector<uint> &Deleted,
+                                         qint64 &CurrentEpoch,
+                                         uint64_t &CurrentGeneration) const
+{
+    QMutexLocker locker(&m_lock);
+    CurrentEpoch = m_epoch;
+    CurrentGeneration = m_generation;
+
+    if (Epoch != m_epoch || Generation < m_oldest || Generation > m_generation)
+        return false;
+
+    for (auto it = m_changes.cbegin(); it != m_changes.cend(); ++it)
+    {
+        if (it->m_generation <= Generation)
+            continue;
+        if (Changed.size() + Deleted.size() >= kMaxDelta)
+            return false;
+        if (it->m_deleted)
+            Deleted.push_back(it.key());
+        else
+            Changed.push_back(it.key());
+    }
+    return true;
+}
@@ -0,0 +1,55 @@
+#ifndef RECORDINGCHANGELOG_H
+#define RECORDINGCHANGELOG_H
+
+// C++
+#include <cstdint>
+#include <vector>
+
+// Qt
+#include <QHash>
+#include <QMutex>
+#include <QtGlobal>
+
+/*! \brief Tracks which recordings have changed, so clients can ask for
+ *         "everything since generation N" rather than the whole list.
+ *
+ * Every add, update or delete of a recording bumps the generation and records
+ * the latest change for that recording. A client that remembers the epoch
+ * and generation of its last load can then fetch only the recordings that
+ * changed since.
+ *
+ * Only a bounded number of changes is kept. When a client's generation is
+ * older than the oldest change kept, or when something happens that could
+ * have changed any recording (a slave disconnecting, for example), the client
+ * is told to reload everything. The epoch changes every time the backend
+ * starts, so generations from a previous run are never trusted.
+*/
+class RecordingChangeLog
+{
+  public:
+    RecordingChangeLog();
+
+    void   Changed(uint RecordedId, bool Deleted = false);
+    void   Reset(void);
+
+    bool   GetChangesSince(qint64 Epoch, uint64_t Generation,
+                           std::vector<uint> &Changed,
+                           std::vector<uint> &Deleted,
+                           qint64 &CurrentEpoch,
+                           uint64_t &CurrentGeneration) const;
+
+  private:
+    struct Change
+    {
+        uint64_t m_generation { 0 };
+        bool     m_deleted    { false };
+    };
+
+    mutable QMutex       m_lock;
+    qint64               m_epoch      { 0 };
+    uint64_t             m_generation { 0 };
+    uint64_t             m_oldest     { 0 };
+    QHash<uint,Change>   m_changes;
+};
+
+#endif // RECORDINGCHANGELOG_H
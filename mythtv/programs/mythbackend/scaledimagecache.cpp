@@ -0,0 +1,230 @@
+// Std
+#include <algorithm>
+#include <vector>
+
+// Qt
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QImage>
+#include <QImageReader>
+
+// MythTV
+#include "libmythbase/mythcorecontext.h"
+#include "libmythbase/mythdirs.h"
+#include "libmythbase/mythlogging.h"
+
+// MythBackend
+#include "scaledimagecache.h"
+
+#define LOC QString("ScaledImageCache: ")
+
+// Bump this if the scaling or encoding changes, so that existing entries are
+// not served under a name that no longer describes their content.
+static constexpr int  kCacheVersion { 1 };
+static constexpr int  kMaxDimension { 4096 };
+static constexpr int  kJpegQuality  { 85 };
+// How long an entry that has been handed out is protected from pruning. The
+// HTTP server opens the file after GetImage returns, and once open it can
+// be served even if the entry is removed.
+static constexpr qint64 kHoldMs     { 60LL * 1000 };
+
+ScaledImageCache& ScaledImageCache::GetCache()
+{
+    static ScaledImageCache s_cache;
+    return s_cache;
+}
+
+ScaledImageCache::ScaledImageCache()
+  : m_dir(GetCacheDir() + "/scaledimages"),
+    m_maxBytes(gCoreContext->GetNumSetting("ScaledImageCacheSize", 512) * 1024LL * 1024)
+{
+    QDir dir;
+    if (!dir.mkpath(m_dir))
+        LOG(VB_GENERAL, LOG_ERR, LOC + QString("Failed to create '%1'").arg(m_dir));
+    Scan();
+}
+
+/*! \brief Return a copy of Source scaled to fit within Width x Height.
+ *
+ * A zero (or negative) dimension is derived from the other using the source
+ * aspect ratio. Images are never scaled up, a request for a size at or above
+ * that of the source returns an unscaled copy. Concurrent requests for the
+ * same entry wait for the first to finish rather than scaling twice.
+ *
+ * \returns The cache file, or an empty QFileInfo if the source could not be
+ *          read.
+*/
+QFileInfo ScaledImageCache::GetImage(const QString& Source, int Width, int Height)
+{
+    QFileInfo source(Source);
+    if (!source.exists())
+        return {};
+
+    QSize sourcesize = QImageReader(Source).size();
+    if (!sourcesize.isValid())
+    {
+        LOG(VB_FILE, LOG_WARNING, LOC + QString("Unreadable image '%1'").arg(Source));
+        return {};
+    }
+
+    QString key = CacheKey(source, TargetSize(sourcesize, Width, Height));
+
+    QMutexLocker locker(&m_lock);
+    while (m_pending.contains(key))
+        m_created.wait(&m_lock);
+
+    auto found = m_entries.find(key);
+    if (found != m_entries.end())
+    {
+        if (QFile::exists(found->m_fileName))
+        {
+            found->m_lastUsed = QDateTime::currentMSecsSinceEpoch();
+            found->m_heldUntil = found->m_lastUsed + kHoldMs;
+            return QFileInfo(found->m_fileName);
+        }
+        m_bytes -= found->m_bytes;
+        m_entries.erase(found);
+    }
+
+    m_pending.insert(key);
+    locker.unlock();
+    QString filename = Create(key, source, Width, Height);
+    locker.relock();
+    m_pending.remove(key);
+    m_created.wakeAll();
+
+    if (filename.isEmpty())
+        return {};
+
+    QFileInfo result(filename);
+    qint64 now = QDateTime::currentMSecsSinceEpoch();
+    m_entries.insert(key, { filename, result.size(), now, now + kHoldMs });
+    m_bytes += result.size();
+    if (m_bytes > m_maxBytes)
+        Prune(now);
+    return result;
+}
+
+QString ScaledImageCache::CacheKey(const QFileInfo& Source, QSize Size)
+{
+    QByteArray id = QString("%1|%2|%3|%4x%5|%6")
+        .arg(Source.absoluteFilePath())
+        .arg(Source.size())
+        .arg(Source.lastModified().toMSecsSinceEpoch())
+        .arg(Size.width()).arg(Size.height())
+        .arg(kCacheVersion).toUtf8();
+    return QCryptographicHash::hash(id, QCryptographicHash::Sha1).toHex();
+}
+
+QSize ScaledImageCache::TargetSize(QSize Source, int Width, int Height)
+{
+    Width  = std::min(Width, kMaxDimension);
+    Height = std::min(Height, kMaxDimension);
+    if (Width <= 0 && Height <= 0)
+        return Source;
+
+    QSize bound { Width  > 0 ? Width  : kMaxDimension,
+                  Height > 0 ? Height : kMaxDimension };
+    QSize target = Source.scaled(bound, Qt::KeepAspectRatio);
+    if (target.width() >= Source.width() || target.height() >= Source.height())
+        return Source;
+    return target.expandedTo({ 1, 1 });
+}
+
+QString ScaledImageCache::Create(const QString& Key, const QFileInfo& Source,
+                                 int Width, int Height)
+{
+    QImageReader reader(Source.absoluteFilePath());
+    QSize sourcesize = reader.size();
+    QSize target = TargetSize(sourcesize, Width, Height);
+
+    // Decoders that support it (e.g. JPEG) scale while decoding, which is
+    // considerably cheaper than decoding the full image and scaling after.
+    if (target != sourcesize)
+        reader.setScaledSize(target);
+
+    QImage image = reader.read();
+    if (image.isNull())
+    {
+        LOG(VB_GENERAL, LOG_WARNING, LOC + QString("Failed to read '%1': %2")
+            .arg(Source.absoluteFilePath(), reader.errorString()));
+        return {};
+    }
+
+    bool alpha = image.hasAlphaChannel();
+    QString filename = QString("%1/%2.%3").arg(m_dir, Key, alpha ? "png" : "jpg");
+    QString temp = filename + ".tmp";
+    if (!image.save(temp, alpha ? "PNG" : "JPG", alpha ? -1 : kJpegQuality))
+    {
+        LOG(VB_GENERAL, LOG_ERR, LOC + QString("Failed to write '%1'").arg(temp));
+        QFile::remove(temp);
+        return {};
+    }
+
+    // Publish atomically so a partially written file is never served
+    QFile::remove(filename);
+    if (!QFile::rename(temp, filename))
+    {
+        QFile::remove(temp);
+        return {};
+    }
+
+    LOG(VB_FILE, LOG_DEBUG, LOC + QString("Created %1x%2 copy of '%3'")
+        .arg(image.width()).arg(image.height()).arg(Source.absoluteFilePath()));
+    return filename;
+}
+
+void ScaledImageCache::Scan()
+{
+    QDir dir(m_dir);
+    const QFileInfoList files = dir.entryInfoList(QDir::Files);
+    for (const auto & file : files)
+    {
+        if (file.suffix() == "tmp")
+        {
+            QFile::remove(file.absoluteFilePath());
+            continue;
+        }
+        m_entries.insert(file.completeBaseName(),
+                         { file.absoluteFilePath(), file.size(),
+                           file.lastModified().toMSecsSinceEpoch(), 0 });
+        m_bytes += file.size();
+    }
+
+    LOG(VB_GENERAL, LOG_INFO, LOC + QString("%1 entries, %2 of %3 MB used")
+        .arg(m_entries.size()).arg(m_bytes / (1024 * 1024)).arg(m_maxBytes / (1024 * 1024)));
+    if (m_bytes > m_maxBytes)
+        Prune(QDateTime::currentMSecsSinceEpoch());
+}
+
+/*! \brief Remove the least recently used entries until the cache is no more
+ *         than 90% of its limit.
+ *
+ * Entries handed out in the last kHoldMs are kept, even if that leaves the
+ * cache over its limit, so that a file is not removed before the HTTP server
+ * has opened it.
+*/
+void ScaledImageCache::Prune(qint64 Now)
+{
+    std::vector<std::pair<qint64,QString>> byage;
+    byage.reserve(static_cast<size_t>(m_entries.size()));
+    for (auto it = m_entries.cbegin(); it != m_entries.cend(); ++it)
+        if (it->m_heldUntil <= Now)
+            byage.emplace_back(it->m_lastUsed, it.key());
+    std::ranges::sort(byage);
+
+    qint64 limit = m_maxBytes - (m_maxBytes / 10);
+    int removed = 0;
+    for (const auto & [used, key] : byage)
+    {
+        if (m_bytes <= limit)
+            break;
+        auto entry = m_entries.take(key);
+        QFile::remove(entry.m_fileName);
+        m_bytes -= entry.m_bytes;
+        removed++;
+    }
+
+    LOG(VB_FILE, LOG_INFO, LOC + QString("Pruned %1 entries").arg(removed));
+}
@@ -0,0 +1,58 @@
+#ifndef SCALEDIMAGECACHE_H
+#define SCALEDIMAGECACHE_H
+
+// Qt
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QSet>
+#include <QSize>
+#include <QWaitCondition>
+
+/*! \brief A content addressed cache of pre-scaled artwork.
+ *
+ * Frontends ask for artwork at the size they will render it. The scaled copy
+ * is keyed on the identity of the source (path, size and modification time)
+ * and the requested size, so the cache file name doubles as a strong ETag:
+ * a given name only ever refers to one sequence of bytes and a changed
+ * source simply produces a new name.
+ *
+ * The cache is shared by every frontend talking to this backend and is
+ * bounded by the ScaledImageCacheSize setting (in MB), least recently used
+ * entries are pruned first.
+*/
+class ScaledImageCache
+{
+  public:
+    static ScaledImageCache& GetCache();
+
+    QFileInfo GetImage(const QString& Source, int Width, int Height);
+
+  private:
+    struct Entry
+    {
+        QString m_fileName;
+        qint64  m_bytes    { 0 };
+        qint64  m_lastUsed { 0 };
+        qint64  m_heldUntil { 0 }; ///< Not pruned before this time
+    };
+
+    ScaledImageCache();
+    Q_DISABLE_COPY(ScaledImageCache)
+
+    static QString CacheKey(const QFileInfo& Source, QSize Size);
+    static QSize   TargetSize(QSize Source, int Width, int Height);
+    QString Create(const QString& Key, const QFileInfo& Source, int Width, int Height);
+    void    Scan();
+    void    Prune(qint64 Now);
+
+    QMutex         m_lock;
+    QWaitCondition m_created;
+    QString        m_dir;
+    qint64         m_maxBytes { 0 };
+    qint64         m_bytes    { 0 };
+    QHash<QString,Entry> m_entries;
+    QSet<QString>  m_pending;
+};
+
+#endif
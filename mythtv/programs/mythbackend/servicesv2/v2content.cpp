@@ -47,8 +47,10 @@
 #include "libmythtv/metadataimagehelper.h"
 #include "libmythtv/previewgenerator.h"
 #include "libmythtv/programinfo.h"
+#include "libmythtv/thumbstrip.h"
 
 // MythBackend
+#include "scaledimagecache.h"
 #include "v2content.h"
 #include "v2serviceUtil.h"
 
@@ -232,6 +234,43 @@ QFileInfo V2Content::GetImageFile( const QString &sStorageGroup,
     return QFileInfo( sNewFileName );
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// Unlike GetImageFile, the scaled copy is kept in a shared, size bounded
+// cache rather than next to the original and is served with a strong ETag,
+// so frontends can revalidate their copy without refetching it.
+/////////////////////////////////////////////////////////////////////////////
+
+QFileInfo V2Content::GetScaledImage( const QString &sStorageGroup,
+                                     const QString &sFileName,
+                                     int nWidth,
+                                     int nHeight)
+{
+    QString sGroup = sStorageGroup;
+
+    if (sGroup.isEmpty())
+    {
+        LOG(VB_UPNP, LOG_WARNING,
+            "GetScaledImage - StorageGroup missing... using 'Default'");
+        sGroup = "Default";
+    }
+
+    if (sFileName.isEmpty())
+        throw QString( "GetScaledImage - FileName missing." );
+
+    StorageGroup storage( sGroup );
+    QString sFullFileName = storage.FindFile( sFileName );
+
+    if (sFullFileName.isEmpty())
+    {
+        LOG(VB_UPNP, LOG_WARNING,
+            QString("GetScaledImage - Unable to find %1.").arg(sFileName));
+
+        return {};
+    }
+
+    return ScaledImageCache::GetCache().GetImage(sFullFileName, nWidth, nHeight);
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 /////////////////////////////////////////////////////////////////////////////
@@ -688,6 +727,59 @@ QFileInfo V2Content::GetPreviewImage(        int        nRecordedId,
 //
 /////////////////////////////////////////////////////////////////////////////
 
+/////////////////////////////////////////////////////////////////////////////
+// Seek preview thumbnails made when the recording finished. The layout is
+// stored in the JPEG comments as "Interval", "TileSize" and "Count", with
+// ThumbStrip::kColumns tiles per row.
+/////////////////////////////////////////////////////////////////////////////
+
+QFileInfo V2Content::GetThumbStrip( int              nRecordedId,
+                                    int              nChanId,
+                                    const QDateTime &StartTime )
+{
+    if ((nRecordedId <= 0) &&
+        (nChanId <= 0 || !StartTime.isValid()))
+        throw QString("Recorded ID or Channel ID and StartTime appears invalid.");
+
+    ProgramInfo pginfo;
+    if (nRecordedId > 0)
+        pginfo = ProgramInfo(nRecordedId);
+    else
+        pginfo = ProgramInfo(nChanId, StartTime.toUTC());
+
+    if (!pginfo.GetChanID())
+    {
+        LOG(VB_GENERAL, LOG_ERR,
+            QString("GetThumbStrip: No recording for '%1'")
+            .arg(nRecordedId));
+        return {};
+    }
+
+    if (pginfo.GetHostname().toLower() != gCoreContext->GetHostName().toLower()
+            &&  ! gCoreContext->GetBoolSetting("MasterBackendOverride", false))
+    {
+        QString sMsg =
+            QString("GetThumbStrip: Wrong Host '%1' request from '%2'")
+                          .arg( gCoreContext->GetHostName(),
+                                pginfo.GetHostname() );
+
+        LOG(VB_UPNP, LOG_ERR, sMsg);
+
+        throw V2HttpRedirectException( pginfo.GetHostname() );
+    }
+
+    QString sStripFileName = ThumbStrip::GetFilename(GetPlaybackURL(&pginfo));
+
+    if (!QFile::exists( sStripFileName ))
+        return {};
+
+    return QFileInfo( sStripFileName );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
 QFileInfo V2Content::GetRecording( int              nRecordedId,
                                  int              nChanId,
                                  const QDateTime &StartTime,
@@ -46,6 +46,7 @@ class V2Content : public MythHTTPService
     Q_CLASSINFO("GetLiveStreamList",      "methods=GET,POST,HEAD")
     Q_CLASSINFO("StopLiveStream",         "methods=GET,POST,HEAD")
     Q_CLASSINFO("RemoveLiveStream",       "methods=GET,POST,HEAD;name=bool")
+    Q_CLASSINFO("GetScaledImage",         "methods=GET,HEAD;ContentAddressed=true")
 
     public:
 
@@ -62,6 +63,10 @@ class V2Content : public MythHTTPService
                                                   const QString   &FileName,
                                                   int Width, int Height );
 
+        static QFileInfo    GetScaledImage      ( const QString   &StorageGroup,
+                                                  const QString   &FileName,
+                                                  int Width, int Height );
+
         static QStringList  GetFileList         ( const QString   &StorageGroup );
 
         static QStringList  GetDirList          ( const QString   &StorageGroup );
@@ -93,6 +98,10 @@ class V2Content : public MythHTTPService
                                                   int              SecsIn,
                                                   const QString   &Format);
 
+        static QFileInfo    GetThumbStrip       ( int              RecordedId,
+                                                  int              ChanId,
+                                                  const QDateTime &StartTime );
+
         QFileInfo    GetRecording               ( int              RecordedId,
                                                   int              ChanId,
                                                   const QDateTime &StartTime,
@@ -0,0 +1,80 @@
+#ifndef V2DATABASESTATEMENT_H_
+#define V2DATABASESTATEMENT_H_
+
+#include <QString>
+#include <QStringList>
+#include <QVariantList>
+
+#include "libmythbase/http/mythhttpservice.h"
+#include "v2labelValue.h"
+
+class V2DatabaseStatement : public QObject
+{
+    Q_OBJECT
+    Q_CLASSINFO( "Version", "1.0" );
+
+    // Q_CLASSINFO Used to augment Metadata for properties.
+    // See datacontracthelper.h for details
+
+    Q_CLASSINFO( "ExecHistogram", "type=V2LabelValue");
+
+    // Times are in microseconds, the percentiles are the end of the
+    // histogram bucket they fall in
+
+    SERVICE_PROPERTY2( QString     , Query         )
+    SERVICE_PROPERTY2( QStringList , CallSites     )
+    SERVICE_PROPERTY2( qlonglong   , Prepares      )
+    SERVICE_PROPERTY2( qlonglong   , Reuses        )
+    SERVICE_PROPERTY2( qlonglong   , PrepareTime   )
+    SERVICE_PROPERTY2( qlonglong   , Execs         )
+    SERVICE_PROPERTY2( qlonglong   , ExecTime      )
+    SERVICE_PROPERTY2( qlonglong   , AvgExecTime   )
+    SERVICE_PROPERTY2( qlonglong   , MaxExecTime   )
+    SERVICE_PROPERTY2( qlonglong   , P50ExecTime   )
+    SERVICE_PROPERTY2( qlonglong   , P95ExecTime   )
+    SERVICE_PROPERTY2( qlonglong   , P99ExecTime   )
+    SERVICE_PROPERTY2( QVariantList, ExecHistogram );
+
+    public:
+
+        Q_INVOKABLE V2DatabaseStatement(QObject *parent = nullptr)
+            : QObject( parent )
+        {
+        }
+
+        void Copy( const V2DatabaseStatement *src )
+        {
+            m_Query       = src->m_Query       ;
+            m_CallSites   = src->m_CallSites   ;
+            m_Prepares    = src->m_Prepares    ;
+            m_Reuses      = src->m_Reuses      ;
+            m_PrepareTime = src->m_PrepareTime ;
+            m_Execs       = src->m_Execs       ;
+            m_ExecTime    = src->m_ExecTime    ;
+            m_AvgExecTime = src->m_AvgExecTime ;
+            m_MaxExecTime = src->m_MaxExecTime ;
+            m_P50ExecTime = src->m_P50ExecTime ;
+            m_P95ExecTime = src->m_P95ExecTime ;
+            m_P99ExecTime = src->m_P99ExecTime ;
+            CopyListContents< V2LabelValue >( this, m_ExecHistogram,
+                                              src->m_ExecHistogram );
+        }
+
+        V2LabelValue *AddNewExecHistogram()
+        {
+            // We must make sure the object added to the QVariantList has
+            // a parent of 'this'
+
+            auto *pObject = new V2LabelValue( this );
+            m_ExecHistogram.append( QVariant::fromValue<QObject *>( pObject ));
+
+            return pObject;
+        }
+
+    private:
+        Q_DISABLE_COPY(V2DatabaseStatement);
+};
+
+Q_DECLARE_METATYPE(V2DatabaseStatement*)
+
+#endif // V2DATABASESTATEMENT_H_
@@ -0,0 +1,83 @@
+#ifndef V2DATABASESTATS_H_
+#define V2DATABASESTATS_H_
+
+#include <QVariantList>
+
+#include "libmythbase/http/mythhttpservice.h"
+#include "v2databaseStatement.h"
+#include "v2labelValue.h"
+
+class V2DatabaseStats : public QObject
+{
+    Q_OBJECT
+    Q_CLASSINFO( "Version", "1.0" );
+
+    // Q_CLASSINFO Used to augment Metadata for properties.
+    // See datacontracthelper.h for details
+
+    Q_CLASSINFO( "PoolWaitHistogram", "type=V2LabelValue");
+    Q_CLASSINFO( "Statements", "type=V2DatabaseStatement");
+
+    // Times are in microseconds
+
+    SERVICE_PROPERTY2( int         , Connections       )
+    SERVICE_PROPERTY2( qlonglong   , PoolRequests      )
+    SERVICE_PROPERTY2( qlonglong   , NewConnections    )
+    SERVICE_PROPERTY2( qlonglong   , PoolWaitTime      )
+    SERVICE_PROPERTY2( qlonglong   , MaxPoolWait       )
+    SERVICE_PROPERTY2( qlonglong   , P99PoolWait       )
+    SERVICE_PROPERTY2( QVariantList, PoolWaitHistogram )
+    SERVICE_PROPERTY2( int         , StatementCount    )
+    SERVICE_PROPERTY2( QVariantList, Statements        );
+
+    public:
+
+        Q_INVOKABLE V2DatabaseStats(QObject *parent = nullptr)
+            : QObject( parent )
+        {
+        }
+
+        void Copy( const V2DatabaseStats *src )
+        {
+            m_Connections    = src->m_Connections    ;
+            m_PoolRequests   = src->m_PoolRequests   ;
+            m_NewConnections = src->m_NewConnections ;
+            m_PoolWaitTime   = src->m_PoolWaitTime   ;
+            m_MaxPoolWait    = src->m_MaxPoolWait    ;
+            m_P99PoolWait    = src->m_P99PoolWait    ;
+            m_StatementCount = src->m_StatementCount ;
+            CopyListContents< V2LabelValue >( this, m_PoolWaitHistogram,
+                                              src->m_PoolWaitHistogram );
+            CopyListContents< V2DatabaseStatement >( this, m_Statements,
+                                                     src->m_Statements );
+        }
+
+        V2LabelValue *AddNewPoolWaitHistogram()
+        {
+            // We must make sure the object added to the QVariantList has
+            // a parent of 'this'
+
+            auto *pObject = new V2LabelValue( this );
+            m_PoolWaitHistogram.append( QVariant::fromValue<QObject *>( pObject ));
+
+            return pObject;
+        }
+
+        V2DatabaseStatement *AddNewStatement()
+        {
+            // We must make sure the object added to the QVariantList has
+            // a parent of 'this'
+
+            auto *pObject = new V2DatabaseStatement( this );
+            m_Statements.append( QVariant::fromValue<QObject *>( pObject ));
+
+            return pObject;
+        }
+
+    private:
+        Q_DISABLE_COPY(V2DatabaseStats);
+};
+
+Q_DECLARE_METATYPE(V2DatabaseStats*)
+
+#endif // V2DATABASESTATS_H_
@@ -1,3 +1,7 @@
+// C++
+#include <algorithm>
+#include <vector>
+
 // Qt
 #include <QDir>
 #include <QFileInfo>
@@ -61,6 +65,8 @@ void V2Myth::RegisterCustomTypes()
     qRegisterMetaType<V2EnvInfo*>("V2EnvInfo");
     qRegisterMetaType<V2LogInfo*>("V2LogInfo");
     qRegisterMetaType<V2BuildInfo*>("V2BuildInfo");
+    qRegisterMetaType<V2DatabaseStats*>("V2DatabaseStats");
+    qRegisterMetaType<V2DatabaseStatement*>("V2DatabaseStatement");
 }
 
 
@@ -1020,6 +1026,74 @@ bool V2Myth::CheckDatabase( bool repair )
     return bResult;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+template <typename AddBucket>
+static void FillDatabaseHistogram( const MSqlTimeHistogram::Counts &histogram,
+                                   AddBucket addBucket )
+{
+    // Labelled with the start of the bucket, in microseconds
+    for (size_t i = 0; i < histogram.size(); ++i)
+    {
+        if (histogram[i] == 0)
+            continue;
+        V2LabelValue *pBucket = addBucket();
+        pBucket->setLabel(QString::number(MSqlTimeHistogram::BucketStart(i)));
+        pBucket->setValue(QString::number(histogram[i]));
+    }
+}
+
+V2DatabaseStats* V2Myth::GetDatabaseStats( int nCount )
+{
+    MDBManager *dbmanager = GetMythDB()->GetDBManager();
+    MSqlPoolSummary pool = dbmanager->GetPoolSummary();
+    std::vector<MSqlStatementSummary> statements =
+        dbmanager->GetStatementSummaries();
+
+    auto *pStats = new V2DatabaseStats();
+
+    pStats->setConnections    ( pool.m_connections    );
+    pStats->setPoolRequests   ( pool.m_requests       );
+    pStats->setNewConnections ( pool.m_newConnections );
+    pStats->setPoolWaitTime   ( pool.m_waitTime / 1000 );
+    pStats->setMaxPoolWait    ( pool.m_maxWait  / 1000 );
+    pStats->setP99PoolWait    ( MSqlTimeHistogram::Percentile(pool.m_histogram, 0.99) );
+    FillDatabaseHistogram(pool.m_histogram,
+                          [pStats]() { return pStats->AddNewPoolWaitHistogram(); });
+    pStats->setStatementCount ( static_cast<int>(statements.size()) );
+
+    // The statements that took the most time first
+    if (nCount <= 0)
+        nCount = 50;
+    if (statements.size() > static_cast<size_t>(nCount))
+        statements.resize(nCount);
+
+    for (const auto & statement : statements)
+    {
+        V2DatabaseStatement *pStatement = pStats->AddNewStatement();
+        int64_t execs = std::max(static_cast<int64_t>(statement.m_execs), int64_t{1});
+
+        pStatement->setQuery      ( statement.m_query                  );
+        pStatement->setCallSites  ( statement.m_callSites              );
+        pStatement->setPrepares   ( statement.m_prepares               );
+        pStatement->setReuses     ( statement.m_reuses                 );
+        pStatement->setPrepareTime( statement.m_prepareTime / 1000     );
+        pStatement->setExecs      ( statement.m_execs                  );
+        pStatement->setExecTime   ( statement.m_execTime / 1000        );
+        pStatement->setAvgExecTime( statement.m_execTime / execs / 1000 );
+        pStatement->setMaxExecTime( statement.m_maxExecTime / 1000     );
+        pStatement->setP50ExecTime( MSqlTimeHistogram::Percentile(statement.m_histogram, 0.50) );
+        pStatement->setP95ExecTime( MSqlTimeHistogram::Percentile(statement.m_histogram, 0.95) );
+        pStatement->setP99ExecTime( MSqlTimeHistogram::Percentile(statement.m_histogram, 0.99) );
+        FillDatabaseHistogram(statement.m_histogram,
+                              [pStatement]() { return pStatement->AddNewExecHistogram(); });
+    }
+
+    return pStats;
+}
+
 bool V2Myth::DelayShutdown( void )
 {
     auto *scheduler = dynamic_cast<Scheduler*>(gCoreContext->GetScheduler());
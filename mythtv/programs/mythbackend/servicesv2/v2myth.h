@@ -3,6 +3,7 @@
 
 #include "libmythbase/http/mythhttpservice.h"
 #include "v2connectionInfo.h"
+#include "v2databaseStats.h"
 #include "v2storageGroupDirList.h"
 #include "v2timeZoneInfo.h"
 #include "v2logMessageList.h"
@@ -19,7 +20,7 @@
 class V2Myth : public MythHTTPService
 {
     Q_OBJECT
-    Q_CLASSINFO( "Version"    , "5.2" )
+    Q_CLASSINFO( "Version"    , "5.3" )
     Q_CLASSINFO( "GetHostName",           "methods=GET;name=String"     )
     Q_CLASSINFO( "GetHosts",              "methods=GET;name=StringList" )
     Q_CLASSINFO( "GetKeys",               "methods=GET;name=StringList" )
@@ -37,6 +38,7 @@ class V2Myth : public MythHTTPService
     Q_CLASSINFO( "SendNotification",      "methods=POST"                )
     Q_CLASSINFO( "BackupDatabase",        "methods=POST"                )
     Q_CLASSINFO( "CheckDatabase",         "methods=POST"                )
+    Q_CLASSINFO( "GetDatabaseStats",      "methods=GET"                 )
     Q_CLASSINFO( "DelayShutdown",         "methods=POST"                )
     Q_CLASSINFO( "ProfileSubmit",         "methods=POST"                )
     Q_CLASSINFO( "ProfileDelete",         "methods=POST"                )
@@ -169,6 +171,8 @@ class V2Myth : public MythHTTPService
 
     static bool         CheckDatabase       ( bool Repair );
 
+    static V2DatabaseStats* GetDatabaseStats ( int Count );
+
     static bool         DelayShutdown       ( void );
 
     static bool         ProfileSubmit       ( void );
@@ -16,6 +16,10 @@
 #include <cstdio>
 #include <cstdlib>
 
+// C++ headers
+#include <algorithm>
+#include <vector>
+
 // Qt headers
 #include <QtGlobal>
 #if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
@@ -29,6 +33,7 @@
 #include "libmythbase/http/mythhttpmetaservice.h"
 #include "libmythbase/mythcorecontext.h"
 #include "libmythbase/mythdate.h"
+#include "libmythbase/mythdb.h"
 #include "libmythbase/mythdbcon.h"
 #include "libmythbase/mythlogging.h"
 #include "libmythbase/mythmiscutil.h"
@@ -835,6 +840,37 @@ void V2Status::FillStatusXML( QDomDocument *pDoc )
         guide.setAttribute("guideDays", qdtNow.daysTo(GuideDataThrough));
     }
 
+    // Add Database information, times are in microseconds
+
+    QDomElement database = pDoc->createElement("Database");
+    root.appendChild(database);
+
+    MDBManager *dbmanager = GetMythDB()->GetDBManager();
+    MSqlPoolSummary pool = dbmanager->GetPoolSummary();
+    database.setAttribute("connections"   , pool.m_connections);
+    database.setAttribute("poolRequests"  , static_cast<qlonglong>(pool.m_requests));
+    database.setAttribute("newConnections", static_cast<qlonglong>(pool.m_newConnections));
+    database.setAttribute("poolWait"      , static_cast<qlonglong>(pool.m_waitTime / 1000));
+    database.setAttribute("maxPoolWait"   , static_cast<qlonglong>(pool.m_maxWait / 1000));
+    database.setAttribute("p99PoolWait"   , static_cast<qlonglong>(
+                              MSqlTimeHistogram::Percentile(pool.m_histogram, 0.99)));
+
+    std::vector<MSqlStatementSummary> statements = dbmanager->GetStatementSummaries(10);
+    for (const auto & stat : statements)
+    {
+        int64_t execs = std::max(static_cast<int64_t>(stat.m_execs), int64_t{1});
+        QDomElement statement = pDoc->createElement("Statement");
+        database.appendChild(statement);
+        statement.setAttribute("execs"      , static_cast<qlonglong>(stat.m_execs));
+        statement.setAttribute("execTime"   , static_cast<qlonglong>(stat.m_execTime / 1000));
+        statement.setAttribute("avgExecTime", static_cast<qlonglong>(stat.m_execTime / execs / 1000));
+        statement.setAttribute("p95ExecTime", static_cast<qlonglong>(
+                                   MSqlTimeHistogram::Percentile(stat.m_histogram, 0.95)));
+        statement.setAttribute("maxExecTime", static_cast<qlonglong>(stat.m_maxExecTime / 1000));
+        statement.setAttribute("callSites"  , stat.m_callSites.join(", "));
+        statement.appendChild(pDoc->createTextNode(stat.m_query));
+    }
+
     // Add Miscellaneous information
 
     QString info_script = gCoreContext->GetSetting("MiscStatusScript");
@@ -964,6 +1000,13 @@ void V2Status::PrintStatus( QTextStream &os, QDomDocument *pDoc )
     if (!node.isNull())
         PrintMachineInfo( os, node.toElement());
 
+    // Database statistics ---------------------
+
+    node = docElem.namedItem( "Database" );
+
+    if (!node.isNull())
+        PrintDatabaseStats( os, node.toElement());
+
     // Miscellaneous information ---------------
 
     node = docElem.namedItem( "Miscellaneous" );
@@ -1724,6 +1767,58 @@ int V2Status::PrintMachineInfo( QTextStream &os, const QDomElement& info )
     return 1;
 }
 
+int V2Status::PrintDatabaseStats( QTextStream &os, const QDomElement& database )
+{
+    if (database.isNull())
+        return 0;
+
+    os << "  <div class=\"content\">\r\n"
+       << "    <h2 class=\"status\">Database</h2>\r\n"
+       << "    Connections open: " << database.attribute( "connections", "0" )
+       << ", handed out " << database.attribute( "poolRequests", "0" )
+       << " times, " << database.attribute( "newConnections", "0" )
+       << " opened.<br />\r\n"
+       << "    Waiting for a connection took "
+       << database.attribute( "poolWait", "0" ).toLongLong() / 1000
+       << " ms, 99% of the requests under "
+       << database.attribute( "p99PoolWait", "0" ) << " us and at most "
+       << database.attribute( "maxPoolWait", "0" ) << " us.<br />\r\n";
+
+    QDomNodeList nodes = database.elementsByTagName("Statement");
+    int count = nodes.count();
+    if (count > 0)
+    {
+        os << "    The statements that took the most time:\r\n"
+           << "    <ul>\r\n";
+        for (int i = 0; i < count; i++)
+        {
+            QDomElement e = nodes.item(i).toElement();
+            if (e.isNull())
+                continue;
+
+            QString callSites = e.attribute( "callSites", "" );
+            os << "      <li>" << e.attribute( "execs", "0" ) << " runs taking "
+               << e.attribute( "execTime", "0" ).toLongLong() / 1000
+               << " ms, average " << e.attribute( "avgExecTime", "0" )
+               << " us, 95% under " << e.attribute( "p95ExecTime", "0" )
+               << " us, at most " << e.attribute( "maxExecTime", "0" ) << " us";
+            if (!callSites.isEmpty())
+                os << ", from " << callSites.toHtmlEscaped();
+            os << "<br />\r\n"
+               << "        <code>" << e.text().toHtmlEscaped() << "</code></li>\r\n";
+        }
+        os << "    </ul>\r\n";
+    }
+
+    os << "  </div>\r\n\r\n";
+
+    return 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
 int V2Status::PrintMiscellaneousInfo( QTextStream &os, const QDomElement& info )
 {
     if (info.isNull())
@@ -78,6 +78,7 @@ class V2Status : public MythHTTPService
         static int     PrintBackends     ( QTextStream &os, const QDomElement& backends );
         static int     PrintJobQueue     ( QTextStream &os, const QDomElement& jobs );
         static int     PrintMachineInfo  ( QTextStream &os, const QDomElement& info );
+        static int     PrintDatabaseStats( QTextStream &os, const QDomElement& database );
         static int     PrintMiscellaneousInfo ( QTextStream &os, const QDomElement& info );
 
         static void    FillProgramInfo   ( QDomDocument *pDoc,
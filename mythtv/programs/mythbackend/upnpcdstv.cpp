@@ -145,6 +145,8 @@ UPnpCDSTv::UPnpCDSTv()
 
     // ShortCuts
     m_shortcuts.insert(UPnPShortcutFeature::VIDEOS_RECORDINGS, "Recordings");
+
+    m_changeEvents << "RECORDING_LIST_CHANGE";
 }
 
 void UPnpCDSTv::CreateRoot()
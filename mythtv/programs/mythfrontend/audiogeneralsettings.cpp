@@ -165,6 +165,7 @@ AudioConfigSettings::AudioConfigSettings()
     addChild(srcqualityoverride);
 
     advancedSettings->addChild(Audio48kOverride());
+    advancedSettings->addChild(AudioUpmixFast());
 #if CONFIG_AUDIO_ALSA
     advancedSettings->addChild(SPDIFRateOverride());
 #endif
@@ -1258,6 +1259,19 @@ HostCheckBoxSetting *AudioConfigSettings::Audio48kOverride()
     return gc;
 }
 
+HostCheckBoxSetting *AudioConfigSettings::AudioUpmixFast()
+{
+    auto *gc = new HostCheckBoxSetting("AudioUpmixFast");
+
+    gc->setLabel(tr("Fast surround upconversion"));
+    gc->setValue(false);
+
+    gc->setHelpText(tr("Use a faster, approximate calculation when upconverting "
+                       "stereo to 5.1 with the Good or Best upmix quality. "
+                       "Recommended for low powered frontends."));
+    return gc;
+}
+
 HostCheckBoxSetting *AudioConfigSettings::PassThroughOverride()
 {
     auto *gc = new HostCheckBoxSetting("PassThruDeviceOverride");
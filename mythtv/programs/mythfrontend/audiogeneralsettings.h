@@ -80,6 +80,7 @@ class AudioConfigSettings : public GroupSetting
     static HostCheckBoxSetting *SRCQualityOverride();
     static HostComboBoxSetting *SRCQuality();
     static HostCheckBoxSetting *Audio48kOverride();
+    static HostCheckBoxSetting *AudioUpmixFast();
     static HostCheckBoxSetting *PassThroughOverride();
     static HostComboBoxSetting *PassThroughOutputDevice();
     static HostCheckBoxSetting *SPDIFRateOverride();
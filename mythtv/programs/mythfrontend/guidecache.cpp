@@ -0,0 +1,188 @@
+// C++
+#include <algorithm>
+#include <vector>
+
+// MythTV
+#include "libmythbase/mythdate.h"
+#include "libmythbase/mythdbcon.h"
+#include "libmythbase/mythlogging.h"
+
+// MythFrontend
+#include "guidecache.h"
+
+#define LOC QString("GuideCache: ")
+
+// Enough for a few screens worth of channels either side of a day's guide
+static constexpr int kMaxTiles { 128 };
+
+GuideCache::~GuideCache()
+{
+    LOG(VB_GUI, LOG_INFO, LOC + QString("%1 hits, %2 misses")
+        .arg(m_hits).arg(m_misses));
+}
+
+QDateTime GuideCache::TileStart(const QDateTime &Time)
+{
+    qint64 secs = Time.toSecsSinceEpoch();
+    qint64 length = kTileLength.count();
+    secs -= ((secs % length) + length) % length;
+    return MythDate::fromSecsSinceEpoch(secs);
+}
+
+/** \brief Return a copy of the programs on ChanId that overlap Start to End.
+ *
+ *  Any tiles that are not cached are loaded first. Channels lists the
+ *  channels in the block, in display order, and is used both to load
+ *  missing tiles and to detect tiles loaded for a different set of channels.
+ */
+ProgramList *GuideCache::GetPrograms(int Block, const ChanIds &Channels,
+                                     uint ChanId, const QDateTime &Start,
+                                     const QDateTime &End,
+                                     const ProgramList &SchedList)
+{
+    auto *result = new ProgramList();
+
+    for (QDateTime tile = TileStart(Start); tile <= End; tile = tile.addSecs(kTileLength.count()))
+    {
+        auto cached = GetTile(Block, Channels, tile, SchedList);
+        if (!cached)
+            continue;
+
+        auto programs = cached->m_programs.value(ChanId);
+        if (!programs)
+            continue;
+
+        // Tiles overlap where a program spans a tile boundary. Both copies
+        // share a start time, and the lists are in start time order.
+        for (auto *program : *programs)
+        {
+            if (program->GetScheduledEndTime() < Start ||
+                program->GetScheduledStartTime() > End)
+                continue;
+            if (!result->empty() &&
+                program->GetScheduledStartTime() <= result->back()->GetScheduledStartTime())
+                continue;
+            result->push_back(new ProgramInfo(*program));
+        }
+    }
+
+    return result;
+}
+
+/// Load the tile at Start for the given block, if it is not already cached
+void GuideCache::Prefetch(int Block, const ChanIds &Channels,
+                          const QDateTime &Start, const ProgramList &SchedList)
+{
+    GetTile(Block, Channels, TileStart(Start), SchedList);
+}
+
+void GuideCache::Clear(void)
+{
+    QMutexLocker locker(&m_lock);
+    m_tiles.clear();
+    m_generation++;
+}
+
+std::shared_ptr<const GuideCache::Tile>
+GuideCache::GetTile(int Block, const ChanIds &Channels, const QDateTime &Start,
+                    const ProgramList &SchedList)
+{
+    TileKey key { Block, Start.toSecsSinceEpoch() };
+
+    QMutexLocker locker(&m_lock);
+    while (m_loading.contains(key))
+        m_loaded.wait(&m_lock);
+
+    auto found = m_tiles.constFind(key);
+    if (found != m_tiles.cend() && (*found)->m_chanIds == Channels)
+    {
+        (*found)->m_lastUsed = ++m_clock;
+        m_hits++;
+        return *found;
+    }
+
+    m_misses++;
+    m_loading.insert(key);
+    uint generation = m_generation;
+    locker.unlock();
+
+    auto tile = LoadTile(Channels, Start, SchedList);
+
+    locker.relock();
+    m_loading.remove(key);
+    m_loaded.wakeAll();
+
+    // Don't keep data loaded against a schedule that has since changed, but
+    // it is still good enough to show once.
+    if (tile && generation == m_generation)
+    {
+        tile->m_lastUsed = ++m_clock;
+        m_tiles.insert(key, tile);
+        if (m_tiles.size() > kMaxTiles)
+            Prune();
+    }
+    return tile;
+}
+
+std::shared_ptr<GuideCache::Tile>
+GuideCache::LoadTile(const ChanIds &Channels, const QDateTime &Start,
+                     const ProgramList &SchedList)
+{
+    if (Channels.isEmpty())
+        return nullptr;
+
+    MSqlBindings bindings;
+    QStringList chanids;
+    for (int i = 0; i < Channels.size(); ++i)
+    {
+        QString name = QString(":CHANID%1").arg(i);
+        chanids << name;
+        bindings[name] = Channels[i];
+    }
+
+    QString querystr = QString("WHERE program.chanid IN (%1) "
+                               "  AND program.endtime >= :STARTTS "
+                               "  AND program.starttime < :ENDTS "
+                               "  AND program.starttime >= :STARTLIMITTS "
+                               "  AND program.manualid = 0 ")
+        .arg(chanids.join(','));
+    bindings[":STARTTS"] = Start;
+    bindings[":STARTLIMITTS"] = Start.addDays(-1);
+    bindings[":ENDTS"] = Start.addSecs(kTileLength.count());
+
+    // Each program is unique for its channel, so no grouping is needed
+    ProgramList programs;
+    if (!LoadFromProgram(programs, querystr, bindings, SchedList,
+                         ProgGroupBy::None))
+    {
+        return nullptr;
+    }
+
+    auto tile = std::make_shared<Tile>();
+    tile->m_chanIds = Channels;
+    // Take ownership of the programs, keeping them in start time order
+    // within each channel
+    programs.setAutoDelete(false);
+    for (auto *program : programs)
+    {
+        auto &list = tile->m_programs[program->GetChanID()];
+        if (!list)
+            list = std::make_shared<ProgramList>();
+        list->push_back(program);
+    }
+    return tile;
+}
+
+/// Drop the least recently used quarter of the tiles
+void GuideCache::Prune(void)
+{
+    std::vector<std::pair<uint64_t,TileKey>> byage;
+    byage.reserve(static_cast<size_t>(m_tiles.size()));
+    for (auto it = m_tiles.cbegin(); it != m_tiles.cend(); ++it)
+        byage.emplace_back((*it)->m_lastUsed, it.key());
+    std::ranges::sort(byage);
+
+    auto remove = byage.size() / 4;
+    for (size_t i = 0; i < remove; ++i)
+        m_tiles.remove(byage[i].second);
+}
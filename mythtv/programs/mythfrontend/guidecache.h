@@ -0,0 +1,85 @@
+// -*- Mode: c++ -*-
+#ifndef GUIDECACHE_H_
+#define GUIDECACHE_H_
+
+// C++
+#include <chrono>
+#include <memory>
+
+// Qt
+#include <QDateTime>
+#include <QHash>
+#include <QMutex>
+#include <QSet>
+#include <QVector>
+#include <QWaitCondition>
+
+// MythTV
+#include "libmythbase/mythchrono.h"
+#include "libmythtv/programinfo.h"
+
+/** \class GuideCache
+ *  \brief Program guide data, cached in tiles of a block of channels by a
+ *         fixed length of time.
+ *
+ *  The guide grid shows a window onto the program table that moves a row or
+ *  a page at a time. Rather than querying each visible channel every time the
+ *  window moves, programs are loaded a tile at a time (one query for a block
+ *  of kChannelsPerBlock channels over kTileLength) and rows are assembled from
+ *  the tiles that cover them. Tiles remember the channels they were loaded
+ *  for, so a tile is reloaded if the channels in its block change.
+ *
+ *  Recording status is applied when a tile is loaded, so the cache must be
+ *  cleared when the schedule or the guide data changes.
+ *
+ *  This is safe to use from the guide's helper threads.
+ */
+class GuideCache
+{
+  public:
+    static constexpr int kChannelsPerBlock { 16 };
+    static constexpr std::chrono::seconds kTileLength { 3h };
+
+    using ChanIds = QVector<uint>;
+
+    GuideCache() = default;
+    ~GuideCache();
+
+    static int       BlockForRow(int ChanIndex) { return ChanIndex / kChannelsPerBlock; }
+    static QDateTime TileStart(const QDateTime &Time);
+
+    ProgramList *GetPrograms(int Block, const ChanIds &Channels,
+                             uint ChanId, const QDateTime &Start,
+                             const QDateTime &End, const ProgramList &SchedList);
+    void Prefetch(int Block, const ChanIds &Channels,
+                  const QDateTime &Start, const ProgramList &SchedList);
+    void Clear(void);
+
+  private:
+    struct Tile
+    {
+        ChanIds m_chanIds;
+        QHash<uint, std::shared_ptr<ProgramList>> m_programs;
+        uint64_t m_lastUsed { 0 };
+    };
+    using TileKey = QPair<int, qint64>;
+
+    std::shared_ptr<const Tile> GetTile(int Block, const ChanIds &Channels,
+                                        const QDateTime &Start,
+                                        const ProgramList &SchedList);
+    static std::shared_ptr<Tile> LoadTile(const ChanIds &Channels,
+                                          const QDateTime &Start,
+                                          const ProgramList &SchedList);
+    void Prune(void);
+
+    QMutex         m_lock;
+    QWaitCondition m_loaded;
+    QHash<TileKey, std::shared_ptr<Tile>> m_tiles;
+    QSet<TileKey>  m_loading;
+    uint64_t       m_clock      { 0 };
+    uint           m_generation { 0 };
+    uint64_t       m_hits       { 0 };
+    uint64_t       m_misses     { 0 };
+};
+
+#endif // GUIDECACHE_H_
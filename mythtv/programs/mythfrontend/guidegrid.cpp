@@ -42,6 +42,7 @@
 #include "libmythui/mythuiutils.h"          // for UIUtilW, UIUtilE
 
 // MythFrontend
+#include "guidecache.h"
 #include "guidegrid.h"
 #include "progfind.h"
 
@@ -339,6 +340,22 @@ public:
     QVector<bool> m_unavailables;
 };
 
+class GuidePrefetch : public GuideUpdaterBase
+{
+public:
+    GuidePrefetch(GuideGrid *guide, QVector<GuideGrid::PrefetchTile> tiles)
+        : GuideUpdaterBase(guide), m_tiles(std::move(tiles)) {}
+    bool ExecuteNonUI(void) override // GuideUpdaterBase
+    {
+        for (const auto & tile : std::as_const(m_tiles))
+            m_guide->prefetchProgramTile(tile);
+        return false;
+    }
+    void ExecuteUI(void) override {} // GuideUpdaterBase
+private:
+    const QVector<GuideGrid::PrefetchTile> m_tiles;
+};
+
 class UpdateGuideEvent : public QEvent
 {
 public:
@@ -496,6 +513,7 @@ GuideGrid::GuideGrid(MythScreenStack *parent,
     m_embedVideo(embedVideo),
     m_channelOrdering(gCoreContext->GetSetting("ChannelOrdering", "channum")),
     m_updateTimer(new QTimer(this)),
+    m_scheduleChangeTimer(new QTimer(this)),
     m_threadPool("GuideGridHelperPool"),
     m_changrpid(changrpid),
     m_changrplist(ChannelGroup::GetChannelGroups(false)),
@@ -503,6 +521,10 @@ GuideGrid::GuideGrid(MythScreenStack *parent,
 {
     connect(m_updateTimer, &QTimer::timeout, this, &GuideGrid::updateTimeout);
 
+    m_scheduleChangeTimer->setSingleShot(true);
+    m_scheduleChangeTimer->setInterval(500ms);
+    connect(m_scheduleChangeTimer, &QTimer::timeout, this, &GuideGrid::scheduleChanged);
+
     m_programs.resize(MAX_DISPLAY_CHANS, nullptr);
 
     m_originalStartTime = MythDate::current();
@@ -1564,29 +1586,85 @@ void GuideGrid::fillProgramInfos(bool useExistingData)
     fillProgramRowInfos(-1, useExistingData);
 }
 
+GuideCache::ChanIds GuideGrid::GetBlockChanIds(int block) const
+{
+    GuideCache::ChanIds chanids;
+    int first = block * GuideCache::kChannelsPerBlock;
+    int last  = std::min(first + GuideCache::kChannelsPerBlock,
+                         static_cast<int>(GetChannelCount()));
+    for (int i = first; i < last; ++i)
+    {
+        const ChannelInfo *chinfo = GetChannelInfo(i);
+        chanids.push_back(chinfo ? chinfo->m_chanId : 0);
+    }
+    return chanids;
+}
+
 ProgramList *GuideGrid::getProgramListFromProgram(int chanNum)
 {
-    auto *proglist = new ProgramList();
+    const ChannelInfo *chinfo = GetChannelInfo(chanNum);
+    if (!chinfo)
+        return new ProgramList();
 
-    if (proglist)
+    int block = GuideCache::BlockForRow(chanNum);
+    QDateTime starttime = m_currentStartTime.addSecs(0 - m_currentStartTime.time().second());
+    QDateTime endtime = m_currentEndTime.addSecs(0 - m_currentEndTime.time().second());
+
+    return m_guideCache.GetPrograms(block, GetBlockChanIds(block),
+                                    chinfo->m_chanId, starttime, endtime,
+                                    m_recList);
+}
+
+void GuideGrid::prefetchProgramTile(const PrefetchTile &tile)
+{
+    m_guideCache.Prefetch(tile.m_block, tile.m_chanIds, tile.m_start, m_recList);
+}
+
+/** \brief Queue loading of the guide tiles next to the visible area.
+ *
+ *  The tiles in the direction the guide last moved are loaded first. This
+ *  runs at a lower priority than the row updates, so it never delays the
+ *  rows that are on screen.
+ */
+void GuideGrid::prefetchAdjacentTiles(void)
+{
+    int chancount = static_cast<int>(GetChannelCount());
+    int rows = std::min(chancount, m_guideGrid->getChannelCount());
+    if (rows <= 0)
+        return;
+
+    int blocks = GuideCache::BlockForRow(chancount - 1) + 1;
+    int first  = GuideCache::BlockForRow(static_cast<int>(m_currentStartChannel));
+    int last   = GuideCache::BlockForRow(static_cast<int>(m_currentStartChannel + rows - 1) % chancount);
+    int before = (first + blocks - 1) % blocks;
+    int after  = (last + 1) % blocks;
+
+    QDateTime tilestart = GuideCache::TileStart(m_currentStartTime);
+    QDateTime tileend   = GuideCache::TileStart(m_currentEndTime);
+    QDateTime earlier   = tilestart.addSecs(-GuideCache::kTileLength.count());
+    QDateTime later     = tileend.addSecs(GuideCache::kTileLength.count());
+
+    bool up   = m_lastPrefetchChannel > m_currentStartChannel;
+    bool back = m_lastPrefetchTime.isValid() && m_lastPrefetchTime > m_currentStartTime;
+    m_lastPrefetchChannel = m_currentStartChannel;
+    m_lastPrefetchTime = m_currentStartTime;
+
+    QVector<PrefetchTile> tiles;
+    auto add = [&](int block, const QDateTime &start)
     {
-        MSqlBindings bindings;
-        QString querystr = "WHERE program.chanid = :CHANID "
-                           "  AND program.endtime >= :STARTTS "
-                           "  AND program.starttime <= :ENDTS "
-                           "  AND program.starttime >= :STARTLIMITTS "
-                           "  AND program.manualid = 0 ";
-        QDateTime starttime = m_currentStartTime.addSecs(0 - m_currentStartTime.time().second());
-        bindings[":CHANID"]  = GetChannelInfo(chanNum)->m_chanId;
-        bindings[":STARTTS"] = starttime;
-        bindings[":STARTLIMITTS"] = starttime.addDays(-1);
-        bindings[":ENDTS"] = m_currentEndTime.addSecs(0 - m_currentEndTime.time().second());
+        for (const auto & tile : std::as_const(tiles))
+            if (tile.m_block == block && tile.m_start == start)
+                return;
+        tiles.push_back({ block, GetBlockChanIds(block), start });
+    };
 
-        LoadFromProgram(*proglist, querystr, bindings, m_recList,
-                        ProgGroupBy::ChanNum);
-    }
+    add(up ? before : after, tilestart);
+    add(back ? first : last, back ? earlier : later);
+    add(up ? after : before, tilestart);
+    add(back ? last : first, back ? later : earlier);
 
-    return proglist;
+    m_threadPool.start(new GuideHelper(this, new GuidePrefetch(this, tiles)),
+                       "GuidePrefetch", 1);
 }
 
 void GuideGrid::fillProgramRowInfos(int firstRow, bool useExistingData)
@@ -1653,6 +1731,9 @@ void GuideGrid::fillProgramRowInfos(int firstRow, bool useExistingData)
     auto *updater = new GuideUpdateProgramRow(this, gs, proglists);
     if (updater)
         m_threadPool.start(new GuideHelper(this, updater), "GuideHelper");
+
+    if (allRows)
+        prefetchAdjacentTiles();
 }
 
 void GuideUpdateProgramRow::fillProgramRowInfosWith(int row,
@@ -1894,6 +1975,14 @@ void GuideUpdateProgramRow::fillProgramRowInfosWith(int row,
     }
 }
 
+void GuideGrid::scheduleChanged(void)
+{
+    GuideHelper::Wait(this);
+    LoadFromScheduler(m_recList);
+    m_guideCache.Clear();
+    fillProgramInfos();
+}
+
 void GuideGrid::customEvent(QEvent *event)
 {
     if (event->type() == MythEvent::kMythEventMessage)
@@ -1904,11 +1993,12 @@ void GuideGrid::customEvent(QEvent *event)
 
         const QString& message = me->Message();
 
-        if (message == "SCHEDULE_CHANGE")
+        // A single reschedule can produce a burst of these, so reload
+        // once when they stop arriving.
+        if (message == "SCHEDULE_CHANGE" ||
+            message.startsWith("SYSTEM_EVENT MYTHFILLDATABASE_RAN"))
         {
-            GuideHelper::Wait(this);
-            LoadFromScheduler(m_recList);
-            fillProgramInfos();
+            m_scheduleChangeTimer->start();
         }
     }
     else if (event->type() == DialogCompletionEvent::kEventType)
@@ -2298,6 +2388,7 @@ void GuideGrid::generateListings()
     m_channelCount = std::min(m_guideGrid->getChannelCount(), maxchannel + 1);
 
     LoadFromScheduler(m_recList);
+    m_guideCache.Clear();
     fillProgramInfos();
 }
 
@@ -22,6 +22,7 @@
 #include "libmythui/mythuiguidegrid.h"
 
 // MythFrontend
+#include "guidecache.h"
 #include "schedulecommon.h"
 
 class ProgramInfo;
@@ -211,8 +212,16 @@ class GuideGrid : public ScheduleCommon, public JumpToChannelListener
     // Set row=-1 to fill all rows.
     void fillProgramRowInfos(int row, bool useExistingData);
 public:
+    struct PrefetchTile
+    {
+        int                 m_block { 0 };
+        GuideCache::ChanIds m_chanIds;
+        QDateTime           m_start;
+    };
+
     // These need to be public so that the helper classes can operate.
     ProgramList *getProgramListFromProgram(int chanNum);
+    void prefetchProgramTile(const PrefetchTile &tile);
     void updateProgramsUI(unsigned int firstRow, unsigned int numRows,
                           int progPast,
                           const QVector<ProgramList*> &proglists,
@@ -225,6 +234,9 @@ public:
 private:
 
     void setStartChannel(int newStartChannel);
+    void scheduleChanged(void);
+    void prefetchAdjacentTiles(void);
+    GuideCache::ChanIds GetBlockChanIds(int block) const;
 
     ChannelInfo       *GetChannelInfo(uint chan_idx, int sel = -1);
     const ChannelInfo *GetChannelInfo(uint chan_idx, int sel = -1) const;
@@ -274,7 +286,11 @@ private:
     QString m_channelOrdering;
 
     QTimer *m_updateTimer                 {nullptr}; // audited ref #5318
+    QTimer *m_scheduleChangeTimer         {nullptr};
 
+    GuideCache        m_guideCache;
+    uint              m_lastPrefetchChannel {0};
+    QDateTime         m_lastPrefetchTime;
     MThreadPool       m_threadPool;
 
     int               m_changrpid {-1};
@@ -595,6 +595,9 @@ bool PlaybackBox::Create()
             this, &PlaybackBox::ItemVisible);
     connect(m_recordingList, &MythUIButtonList::itemLoaded,
             this, &PlaybackBox::ItemLoaded);
+    connect(m_recordingList, &MythUIButtonList::itemPrefetch,
+            this, &PlaybackBox::ItemPrefetch);
+    m_recordingList->SetPrefetchPages(2);
 
     // connect up timers...
     connect(m_artTimer[kArtworkFanart],   &QTimer::timeout, this, &PlaybackBox::fanartLoad);
@@ -1115,16 +1118,50 @@ void PlaybackBox::ItemVisible(MythUIButtonListItem *item)
 
         m_previewTokens.insert(token);
         // now make sure selected item is still at the top of the queue
-        auto *sel_pginfo = sel_item->GetData().value<ProgramInfo*>();
-        if (sel_pginfo && sel_item->GetImageFilename("preview").isEmpty() &&
-            (asAvailable == sel_pginfo->GetAvailableStatus()))
-        {
-            m_previewTokens.insert(m_helper.GetPreviewImage(*sel_pginfo, false));
-        }
+        RequeueSelectedPreview(sel_item);
+    }
+}
+
+/// Request the preview for the selected item again, so that it moves back to
+/// the front of the queue after previews for other items have been queued.
+void PlaybackBox::RequeueSelectedPreview(MythUIButtonListItem *sel_item)
+{
+    if (!sel_item)
+        return;
+
+    auto *sel_pginfo = sel_item->GetData().value<ProgramInfo*>();
+    if (sel_pginfo && sel_item->GetImageFilename("preview").isEmpty() &&
+        (asAvailable == sel_pginfo->GetAvailableStatus()))
+    {
+        m_previewTokens.insert(m_helper.GetPreviewImage(*sel_pginfo, false));
     }
 }
 
 
+/// Request the preview for an item that is about to be scrolled into view,
+/// so that it is ready (and prefetched on the next move) when it gets there.
+void PlaybackBox::ItemPrefetch(MythUIButtonListItem *item)
+{
+    auto *pginfo = item->GetData().value<ProgramInfo*>();
+    if (!pginfo)
+        return;
+
+    ItemLoaded(item);
+
+    if (item->GetImageFilename("preview").isEmpty() &&
+        (asAvailable == pginfo->GetAvailableStatus()))
+    {
+        QString token = m_helper.GetPreviewImage(*pginfo, true);
+        if (token.isEmpty())
+            return;
+
+        m_previewTokens.insert(token);
+        MythUIButtonListItem *sel_item = item->parent()->GetItemCurrent();
+        if (sel_item != item)
+            RequeueSelectedPreview(sel_item);
+    }
+}
+
 /** \brief Updates the UI properties for a new preview file.
  *  This first update the image property of the MythUIButtonListItem
  *  with the new preview file, then if it is selected and there is
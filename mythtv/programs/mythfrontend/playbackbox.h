@@ -149,6 +149,7 @@ class PlaybackBox : public ScheduleCommon
         { UpdateUIListItem(item, true); }
     void ItemVisible(MythUIButtonListItem *item);
     void ItemLoaded(MythUIButtonListItem *item);
+    void ItemPrefetch(MythUIButtonListItem *item);
     void selected(MythUIButtonListItem *item);
     void updateRecGroup(MythUIButtonListItem *sel_item);
     void PlayFromAnyMark(MythUIButtonListItem *item);
@@ -290,6 +291,7 @@ class PlaybackBox : public ScheduleCommon
     void UpdateUIGroupList(const QStringList &groupPreferences);
     void UpdateUIRecGroupList(void);
     void SelectNextRecGroup(void);
+    void RequeueSelectedPreview(MythUIButtonListItem *sel_item);
 
     void UpdateProgressBar(void);
 
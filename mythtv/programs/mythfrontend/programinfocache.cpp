@@ -35,6 +35,26 @@ static void free_vec(VPI_ptr &v)
     }
 }
 
+namespace {
+/// The recordings last loaded by a ProgramInfoCache that has since been
+/// destroyed, so the next cache only needs to load what changed since.
+struct SavedCache
+{
+    ~SavedCache() { free_vec(m_list); }
+
+    QMutex                     m_lock;
+    std::vector<ProgramInfo*> *m_list       {nullptr};
+    qint64                     m_epoch      {0};
+    uint64_t                   m_generation {0};
+};
+
+SavedCache &GetSavedCache(void)
+{
+    static SavedCache s_saved;
+    return s_saved;
+}
+} // namespace
+
 class ProgramInfoLoader : public QRunnable
 {
   public:
@@ -52,13 +72,39 @@ class ProgramInfoLoader : public QRunnable
 
 ProgramInfoCache::~ProgramInfoCache()
 {
-    QMutexLocker locker(&m_lock);
+    WaitForLoadToComplete();
 
-    while (m_loadsInProgress)
-        m_loadWait.wait(&m_lock);
+    // Hand the recordings over to the next cache, which then only has to
+    // load what changed while there was no cache listening for updates.
+    Refresh();
+
+    QMutexLocker locker(&m_lock);
+    if (m_epoch)
+    {
+        SavedCache &saved = GetSavedCache();
+        QMutexLocker savedLocker(&saved.m_lock);
+        free_vec(saved.m_list);
+        saved.m_list = new std::vector<ProgramInfo*>();
+        saved.m_list->reserve(m_cache.size());
+        for (auto *pg : std::as_const(m_cache))
+        {
+            if (pg->GetAvailableStatus() == asDeleted)
+                delete pg;
+            else
+                saved.m_list->push_back(pg);
+        }
+        saved.m_epoch = m_epoch;
+        saved.m_generation = m_generation;
+        m_cache.clear();
+    }
 
     Clear();
     free_vec(m_nextCache);
+    for (auto & delta : m_nextDeltas)
+    {
+        for (auto *pg : delta.m_changed)
+            delete pg;
+    }
 }
 
 void ProgramInfoCache::ScheduleLoad(const bool updateUI)
@@ -73,16 +119,62 @@ void ProgramInfoCache::ScheduleLoad(const bool updateUI)
     }
 }
 
+/** \brief Loads the recordings that have changed since the last load.
+ *
+ *  The first load starts from the recordings of the previous cache, if
+ *  there was one. If the backend can't supply just the changes, because
+ *  nothing has been loaded yet or too much has changed, every recording
+ *  is loaded instead.
+ */
 void ProgramInfoCache::Load(const bool updateUI)
 {
     QMutexLocker locker(&m_lock);
     m_loadIsQueued = false;
+    if (!m_epoch && m_cache.empty() && !m_nextCache)
+    {
+        SavedCache &saved = GetSavedCache();
+        QMutexLocker savedLocker(&saved.m_lock);
+        if (saved.m_list)
+        {
+            m_nextCache = saved.m_list;
+            m_epoch = saved.m_epoch;
+            m_generation = saved.m_generation;
+            saved.m_list = nullptr;
+        }
+    }
+    qint64   epoch      = m_epoch;
+    uint64_t generation = m_generation;
 
     locker.unlock();
 
-    // Get an unsorted list (sort = 0) from RemoteGetRecordedList
-    // we sort the list later anyway.
-    std::vector<ProgramInfo*> *tmp = RemoteGetRecordedList(0);
+    Delta delta;
+    std::vector<ProgramInfo*> *tmp = nullptr;
+    bool isDelta = RemoteGetRecordedListChanges(epoch, generation,
+                                                delta.m_changed,
+                                                delta.m_deleted);
+    if (isDelta)
+    {
+        LOG(VB_GUI, LOG_DEBUG,
+            QString("ProgramInfoCache: %1 changed, %2 deleted at generation %3")
+            .arg(delta.m_changed.size()).arg(delta.m_deleted.size())
+            .arg(generation));
+
+        for (ProgramInfo* pg : delta.m_changed)
+            pg->CalculateProgress(pg->QueryLastPlayPos());
+    }
+    else
+    {
+        for (auto *pg : delta.m_changed)
+            delete pg;
+        delta.m_changed.clear();
+        delta.m_deleted.clear();
+
+        // Get an unsorted list (sort = 0) from RemoteGetRecordedList
+        // we sort the list later anyway.
+        tmp = RemoteGetRecordedList(0);
+        if (!tmp)
+            epoch = 0;
+    }
 
     // Calculate play positions for UI
     if (tmp)
@@ -121,12 +213,35 @@ void ProgramInfoCache::Load(const bool updateUI)
         }
      }
 
-   locker.relock();
+    locker.relock();
 
-    free_vec(m_nextCache);
-    m_nextCache = tmp;
+    m_epoch = epoch;
+    m_generation = generation;
 
-    if (updateUI)
+    bool changed = true;
+    if (tmp)
+    {
+        // A full list replaces any changes not yet applied
+        free_vec(m_nextCache);
+        m_nextCache = tmp;
+        for (auto & pending : m_nextDeltas)
+        {
+            for (auto *pg : pending.m_changed)
+                delete pg;
+        }
+        m_nextDeltas.clear();
+    }
+    else if (isDelta &&
+             (!delta.m_changed.empty() || !delta.m_deleted.empty()))
+    {
+        m_nextDeltas.push_back(std::move(delta));
+    }
+    else
+    {
+        changed = false;
+    }
+
+    if (updateUI && changed)
         QCoreApplication::postEvent(
             m_listener, new MythEvent("UPDATE_UI_LIST"));
 
@@ -149,9 +264,9 @@ void ProgramInfoCache::WaitForLoadToComplete(void) const
 
 /** \brief Refreshed the cache.
  *
- *  If a new list has been loaded this fills the cache with that list
- *  if not, this simply removes list items marked for deletion from the
- *  the list.
+ *  If a new list has been loaded this fills the cache with that list,
+ *  then applies any changes loaded since. If there is no new list, this
+ *  also removes list items marked for deletion from the list.
  *
  *  \note This must only be called from the UI thread.
  *  \note All references to the ProgramInfo pointers should be cleared
@@ -160,6 +275,7 @@ void ProgramInfoCache::WaitForLoadToComplete(void) const
 void ProgramInfoCache::Refresh(void)
 {
     QMutexLocker locker(&m_lock);
+    bool rebuilt = (m_nextCache != nullptr);
     if (m_nextCache)
     {
         Clear();
@@ -179,9 +295,15 @@ void ProgramInfoCache::Refresh(void)
         }
         delete m_nextCache;
         m_nextCache = nullptr;
-        return;
     }
 
+    for (auto & delta : m_nextDeltas)
+        ApplyDelta(delta);
+    m_nextDeltas.clear();
+
+    if (rebuilt)
+        return;
+
 #if QT_VERSION < QT_VERSION_CHECK(6,1,0)
     // clazy:exclude-next-line=detaching-member (erases item)
     for (auto it = m_cache.begin(); it != m_cache.end(); )
@@ -349,6 +471,35 @@ ProgramInfo *ProgramInfoCache::GetRecordingInfo(uint recordingID) const
     return nullptr;
 }
 
+/// Applies a set of changes to the cache, m_lock must be held when this
+/// is called. The cache takes ownership of the changed ProgramInfos.
+void ProgramInfoCache::ApplyDelta(Delta &delta)
+{
+    for (uint recordingID : delta.m_deleted)
+    {
+        auto it = m_cache.find(recordingID);
+        if (it != m_cache.end())
+        {
+            delete *it;
+            m_cache.erase(it);
+        }
+    }
+
+    for (auto *pg : delta.m_changed)
+    {
+        if (!pg->GetChanID())
+        {
+            delete pg;
+            continue;
+        }
+
+        ProgramInfo *&entry = m_cache[pg->GetRecordingID()];
+        delete entry;
+        entry = pg;
+    }
+    delta.m_changed.clear();
+}
+
 /// Clears the cache, m_lock must be held when this is called.
 void ProgramInfoCache::Clear(void)
 {
@@ -50,8 +50,16 @@ class ProgramInfoCache
     ProgramInfo *GetRecordingInfo(uint recordingID) const;
 
   private:
+    /// Recordings changed since the previous load
+    struct Delta
+    {
+        std::vector<ProgramInfo*> m_changed;
+        std::vector<uint>         m_deleted;
+    };
+
     void Load(bool updateUI = true);
     void Clear(void);
+    void ApplyDelta(Delta &delta);
 
   private:
     // NOTE: Hash would be faster for lookups and updates, but we need a sorted
@@ -64,6 +72,9 @@ class ProgramInfoCache
     mutable QMutex          m_lock;
     Cache                   m_cache;
     std::vector<ProgramInfo*> *m_nextCache      {nullptr};
+    std::vector<Delta>      m_nextDeltas;
+    qint64                  m_epoch             {0};
+    uint64_t                m_generation        {0};
     QObject                *m_listener          {nullptr};
     bool                    m_loadIsQueued      {false};
     uint                    m_loadsInProgress   {0};
@@ -1103,6 +1103,7 @@ bool VideoDialog::Create()
                 this, &VideoDialog::UpdateText);
         connect(m_videoButtonList, &MythUIButtonList::itemVisible,
                 this, &VideoDialog::UpdateVisible);
+        m_videoButtonList->SetPrefetchPages(2);
     }
 
     return true;
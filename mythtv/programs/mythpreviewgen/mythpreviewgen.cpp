@@ -1,4 +1,5 @@
 // C++ headers
+#include <array>
 #include <cerrno>
 #include <csignal>
 #include <cstdlib>
@@ -6,6 +7,9 @@
 #include <fstream>
 #include <iostream>
 #include <libgen.h>
+#ifndef _WIN32
+#include <poll.h>
+#endif
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -31,14 +35,17 @@
 #include "libmythbase/compat.h"
 #include "libmythbase/exitcodes.h"
 #include "libmythbase/mythappname.h"
+#include "libmythbase/mythdate.h"
 #include "libmythbase/mythdb.h"
 #include "libmythbase/mythlogging.h"
+#include "libmythbase/mythmiscutil.h"
 #include "libmythbase/mythversion.h"
 #include "libmythbase/storagegroup.h"
 #include "libmythtv/dbcheck.h"
 #include "libmythtv/mythsystemevent.h"
 #include "libmythtv/previewgenerator.h"
 #include "libmythtv/programinfo.h"
+#include "libmythtv/thumbstrip.h"
 
 //MythPreviewGen
 #include "mythpreviewgen_commandlineparser.h"
@@ -52,10 +59,8 @@ static constexpr long UNUSED_FILENO { 5 };
 static constexpr long UNUSED_FILENO { 3 };
 #endif
 
-int preview_helper(uint chanid, QDateTime starttime,
-                   long long previewFrameNumber, std::chrono::seconds previewSeconds,
-                   const QSize previewSize,
-                   const QString &infile, const QString &outfile)
+static ProgramInfo *find_program(uint chanid, QDateTime starttime,
+                                 const QString &infile)
 {
     if (!QFileInfo(infile).isReadable() && ((chanid == 0U) || !starttime.isValid()))
         ProgramInfo::QueryKeyFromPathname(infile, chanid, starttime);
@@ -70,7 +75,7 @@ int preview_helper(uint chanid, QDateTime starttime,
                 QString("Cannot locate recording made on '%1' at '%2'")
                 .arg(chanid).arg(starttime.toString(Qt::ISODate)));
             delete pginfo;
-            return GENERIC_EXIT_NOT_OK;
+            return nullptr;
         }
         pginfo->SetPathname(pginfo->GetPlaybackURL(false, true));
     }
@@ -80,7 +85,7 @@ int preview_helper(uint chanid, QDateTime starttime,
         {
             LOG(VB_GENERAL, LOG_ERR,
                 QString("Cannot read this file '%1'").arg(infile));
-            return GENERIC_EXIT_NOT_OK;
+            return nullptr;
         }
         pginfo = new ProgramInfo(
             infile, ""/*plot*/, ""/*title*/, ""/*sortTitle*/, ""/*subtitle*/,
@@ -90,9 +95,21 @@ int preview_helper(uint chanid, QDateTime starttime,
     else
     {
         LOG(VB_GENERAL, LOG_ERR, "Cannot locate recording to preview");
-        return GENERIC_EXIT_NOT_OK;
+        return nullptr;
     }
 
+    return pginfo;
+}
+
+int preview_helper(uint chanid, QDateTime starttime,
+                   long long previewFrameNumber, std::chrono::seconds previewSeconds,
+                   const QSize previewSize,
+                   const QString &infile, const QString &outfile)
+{
+    ProgramInfo *pginfo = find_program(chanid, starttime, infile);
+    if (!pginfo)
+        return GENERIC_EXIT_NOT_OK;
+
     auto *previewgen = new PreviewGenerator(pginfo, QString(),
                                             PreviewGenerator::kLocal);
 
@@ -112,6 +129,101 @@ int preview_helper(uint chanid, QDateTime starttime,
     return ok ? GENERIC_EXIT_OK : GENERIC_EXIT_NOT_OK;
 }
 
+static int thumbstrip_helper(uint chanid, const QDateTime &starttime,
+                             const QString &infile, const QString &outfile)
+{
+    ProgramInfo *pginfo = find_program(chanid, starttime, infile);
+    if (!pginfo)
+        return GENERIC_EXIT_NOT_OK;
+
+    myth_nice(17);
+    myth_ioprio(7);
+
+    pginfo->MarkAsInUse(true, kPreviewGeneratorInUseID);
+    QString pathname = pginfo->GetPathname();
+    bool ok = ThumbStrip::Generate(
+        *pginfo, pathname,
+        outfile.isEmpty() ? ThumbStrip::GetFilename(pathname) : outfile);
+    pginfo->MarkAsInUse(false, kPreviewGeneratorInUseID);
+
+    delete pginfo;
+
+    return ok ? GENERIC_EXIT_OK : GENERIC_EXIT_NOT_OK;
+}
+
+#ifndef _WIN32
+/// Exit after this long without a request, the backend starts a new worker
+static constexpr std::chrono::minutes kServerIdleTimeout { 5min };
+
+/** \brief Make previews requested on stdin until stdin is closed.
+ *
+ *  Keeps the MythContext, database connection and loaded codecs between
+ *  previews so the backend doesn't pay for them on every thumbnail.
+ */
+static int preview_server(void)
+{
+    myth_nice(10);
+    myth_ioprio(7);
+
+    QByteArray buffer;
+    std::array<char,4096> chunk {};
+    while (true)
+    {
+        int newline = buffer.indexOf('\n');
+        if (newline < 0)
+        {
+            pollfd pfd { 0, POLLIN, 0 };
+            int rc = poll(&pfd, 1,
+                          std::chrono::milliseconds(kServerIdleTimeout).count());
+            if (rc == 0)
+            {
+                LOG(VB_GENERAL, LOG_INFO, LOC + "Idle, exiting");
+                return GENERIC_EXIT_OK;
+            }
+            if (rc < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                return GENERIC_EXIT_NOT_OK;
+            }
+            ssize_t len = read(0, chunk.data(), chunk.size());
+            if (len < 0 && errno == EINTR)
+                continue;
+            if (len <= 0)
+                return GENERIC_EXIT_OK;
+            buffer.append(chunk.data(), len);
+            continue;
+        }
+
+        QByteArray line = buffer.left(newline);
+        buffer.remove(0, newline + 1);
+
+        QStringList fields = QString::fromUtf8(line).split('\t');
+        if (fields.size() != 7)
+        {
+            LOG(VB_GENERAL, LOG_ERR, LOC +
+                QString("Invalid request '%1'").arg(QString::fromUtf8(line)));
+            continue;
+        }
+
+        QStringList size = fields[5].split('x');
+        int ret = preview_helper(
+            fields[1].toUInt(),
+            MythDate::fromString(fields[2]),
+            fields[4].toLongLong(),
+            std::chrono::seconds(fields[3].toLongLong()),
+            QSize(size.value(0).toInt(), size.value(1).toInt()),
+            QString(), fields[6]);
+
+        // preview_helper deletes the generator with deleteLater()
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+        std::cout << "PREVIEW\t" << fields[0].toStdString() << "\t"
+                  << ((ret == GENERIC_EXIT_OK) ? "1" : "0") << std::endl;
+    }
+}
+#endif
+
 int main(int argc, char **argv)
 {
     MythPreviewGeneratorCommandLineParser cmdline;
@@ -152,7 +264,13 @@ int main(int argc, char **argv)
     if (retval != GENERIC_EXIT_OK)
         return retval;
 
-    if ((!cmdline.toBool("chanid") || !cmdline.toBool("starttime")) &&
+    bool server = false;
+#ifndef _WIN32
+    server = cmdline.toBool("server");
+#endif
+
+    if (!server &&
+        (!cmdline.toBool("chanid") || !cmdline.toBool("starttime")) &&
         !cmdline.toBool("inputfile"))
     {
         std::cerr << "--generate-preview must be accompanied by either\n"
@@ -163,8 +281,9 @@ int main(int argc, char **argv)
 
     ///////////////////////////////////////////////////////////////////////
 
-    // Don't listen to console input
-    close(0);
+    // Don't listen to console input, unless it is where requests come from
+    if (!server)
+        close(0);
 
     if (signal(SIGPIPE, SIG_IGN) == SIG_ERR)
         LOG(VB_GENERAL, LOG_WARNING, LOC + "Unable to ignore SIGPIPE");
@@ -176,6 +295,18 @@ int main(int argc, char **argv)
         return GENERIC_EXIT_NO_MYTHCONTEXT;
     }
 
+#ifndef _WIN32
+    if (server)
+        return preview_server();
+#endif
+
+    if (cmdline.toBool("thumbstrip"))
+    {
+        return thumbstrip_helper(
+            cmdline.toUInt("chanid"), cmdline.toDateTime("starttime"),
+            cmdline.toString("inputfile"), cmdline.toString("outputfile"));
+    }
+
     int ret = preview_helper(
         cmdline.toUInt("chanid"), cmdline.toDateTime("starttime"),
         cmdline.toLongLong("frame"), std::chrono::seconds(cmdline.toLongLong("seconds")),
@@ -20,6 +20,17 @@ void MythPreviewGeneratorCommandLineParser::LoadArguments(void)
     add("--size", "size", QSize(0,0), "Dimensions of preview image.", "");
     add("--infile", "inputfile", "", "Input video for preview generation.", "");
     add("--outfile", "outputfile", "", "Optional output file for preview generation.", "");
+    add("--thumbstrip", "thumbstrip", false,
+        "Make a strip of seek preview thumbnails instead of a preview image.",
+        "Thumbnails are taken from the keyframes every 10 seconds and "
+        "saved next to the recording as <basename>.strip.jpg, unless "
+        "--outfile is given.");
+    add("--server", "server", false,
+        "Stay running and make previews requested on stdin.",
+        "Used by the backend to keep preview workers running. Requests "
+        "are read one per line as tab separated fields: id, chanid, "
+        "starttime, seconds, frame, size and outfile. The result is "
+        "written to stdout as \"PREVIEW <id> <1|0>\".");
 }
 
 
@@ -3,6 +3,7 @@
 //support analyze-only mode
 
 // C++ headers
+#include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
@@ -313,6 +314,7 @@ MPEG2fixup::MPEG2fixup(const QString &inf, const QString &outf,
 
 MPEG2fixup::~MPEG2fixup()
 {
+    m_reader.Stop();
     mpeg2_close(m_headerDecoder);
     mpeg2_close(m_imgDecoder);
 
@@ -496,6 +498,7 @@ MPEG2replex::~MPEG2replex()
 
 int MPEG2replex::WaitBuffers()
 {
+    auto start = std::chrono::steady_clock::now();
     pthread_mutex_lock( &m_mutex );
     while (true)
     {
@@ -515,10 +518,14 @@ int MPEG2replex::WaitBuffers()
         pthread_cond_wait(&m_cond, &m_mutex);
     }
     pthread_mutex_unlock(&m_mutex);
+    m_waitTime += std::chrono::duration_cast<std::chrono::microseconds>
+        (std::chrono::steady_clock::now() - start);
 
     if (m_done)
     {
         finish_mpg(m_mplex);
+        m_runTime = std::chrono::duration_cast<std::chrono::microseconds>
+            (std::chrono::steady_clock::now() - m_startTime);
 	// mythtv#244: thread exit must return static, not stack
 	static int errorcount = 0;
 	errorcount = m_mplex->error;
@@ -573,6 +580,7 @@ void MPEG2replex::Start()
     pthread_cond_wait(&m_cond, &m_mutex);
     pthread_mutex_unlock(&m_mutex);
 
+    m_startTime = std::chrono::steady_clock::now();
     m_mplex = &mx;
 
     init_multiplex(&mx, &m_seq_head, m_extframe.data(), m_exttype.data(), m_exttypcnt.data(),
@@ -594,6 +602,219 @@ void MPEG2replex::Start()
     }
 }
 
+MPEG2reader::MPEG2reader()
+{
+    pthread_mutex_init(&m_mutex, nullptr);
+    pthread_cond_init(&m_cond, nullptr);
+}
+
+MPEG2reader::~MPEG2reader()
+{
+    Stop();
+    while (!m_free.isEmpty())
+    {
+        AVPacket *pkt = m_free.dequeue();
+        av_packet_free(&pkt);
+    }
+    pthread_cond_destroy(&m_cond);
+    pthread_mutex_destroy(&m_mutex);
+}
+
+//start demuxing on a separate thread, keeping only packets for streams
+void MPEG2reader::Start(const QList<int> &streams)
+{
+    if (m_running || !m_fc)
+        return;
+    m_streams = streams;
+    m_stop = false;
+    m_finished = false;
+    m_lastError = 0;
+    m_running = (pthread_create(&m_thread, nullptr, ReaderStart, this) == 0);
+    if (!m_running)
+        LOG(VB_GENERAL, LOG_WARNING,
+            "MPEG2reader: Failed to start reader thread, reading inline");
+}
+
+void MPEG2reader::Stop()
+{
+    if (!m_running)
+        return;
+
+    pthread_mutex_lock(&m_mutex);
+    m_stop = true;
+    pthread_cond_broadcast(&m_cond);
+    pthread_mutex_unlock(&m_mutex);
+    pthread_join(m_thread, nullptr);
+    m_running = false;
+
+    while (!m_queue.isEmpty())
+    {
+        Entry entry = m_queue.dequeue();
+        av_packet_unref(entry.m_pkt);
+        m_free.enqueue(entry.m_pkt);
+    }
+}
+
+void *MPEG2reader::ReaderStart(void *data)
+{
+    MThread::ThreadSetup("MPEG2Reader");
+    auto *reader = static_cast<MPEG2reader *>(data);
+    if (reader)
+        reader->Run();
+    MThread::ThreadCleanup();
+    return nullptr;
+}
+
+void MPEG2reader::Run()
+{
+    while (true)
+    {
+        pthread_mutex_lock(&m_mutex);
+        if (!m_stop && m_queue.size() >= kReadAhead)
+        {
+            auto start = std::chrono::steady_clock::now();
+            while (!m_stop && m_queue.size() >= kReadAhead)
+                pthread_cond_wait(&m_cond, &m_mutex);
+            m_fullWait += std::chrono::duration_cast<std::chrono::microseconds>
+                (std::chrono::steady_clock::now() - start);
+        }
+        if (m_stop)
+        {
+            pthread_mutex_unlock(&m_mutex);
+            break;
+        }
+        AVPacket *pkt = m_free.isEmpty() ? av_packet_alloc() : m_free.dequeue();
+        pthread_mutex_unlock(&m_mutex);
+
+        int duration = 0;
+        int ret = pkt ? ReadPacket(pkt, duration) : AVERROR(ENOMEM);
+
+        pthread_mutex_lock(&m_mutex);
+        if (ret >= 0 && m_streams.contains(pkt->stream_index))
+        {
+            m_queue.enqueue({pkt, duration});
+        }
+        else
+        {
+            if (pkt)
+            {
+                av_packet_unref(pkt);
+                m_free.enqueue(pkt);
+            }
+            // If it is EAGAIN, obey it, dangit!
+            if (ret < 0 && ret != -EAGAIN)
+            {
+                m_lastError = ret;
+                m_finished = true;
+            }
+        }
+        pthread_cond_broadcast(&m_cond);
+        pthread_mutex_unlock(&m_mutex);
+
+        if (m_finished)
+            break;
+    }
+}
+
+//av_read_frame() plus the per packet bookkeeping.  The parser duration
+//has to be taken here since the next read will overwrite it.
+int MPEG2reader::ReadPacket(AVPacket *pkt, int &parserDuration)
+{
+    pkt->pts = AV_NOPTS_VALUE;
+    pkt->dts = AV_NOPTS_VALUE;
+
+    auto start = std::chrono::steady_clock::now();
+    int ret = av_read_frame(m_fc, pkt);
+    m_readTime += std::chrono::duration_cast<std::chrono::microseconds>
+        (std::chrono::steady_clock::now() - start);
+
+    parserDuration = 0;
+    if (ret < 0)
+        return ret;
+
+    m_packets++;
+    m_bytes += pkt->size;
+    AVCodecParserContext *parser =
+        av_stream_get_parser(m_fc->streams[pkt->stream_index]);
+    if (parser)
+        parserDuration = parser->duration;
+    return ret;
+}
+
+//returns the next packet, or the av_read_frame() error once the input ends
+int MPEG2reader::Read(AVPacket *pkt, int &parserDuration)
+{
+    if (!m_running)
+        return ReadPacket(pkt, parserDuration);
+
+    pthread_mutex_lock(&m_mutex);
+    if (m_queue.isEmpty() && !m_finished)
+    {
+        auto start = std::chrono::steady_clock::now();
+        while (m_queue.isEmpty() && !m_finished)
+            pthread_cond_wait(&m_cond, &m_mutex);
+        m_emptyWait += std::chrono::duration_cast<std::chrono::microseconds>
+            (std::chrono::steady_clock::now() - start);
+    }
+
+    int ret = m_lastError;
+    if (!m_queue.isEmpty())
+    {
+        Entry entry = m_queue.dequeue();
+        av_packet_move_ref(pkt, entry.m_pkt);
+        parserDuration = entry.m_duration;
+        m_free.enqueue(entry.m_pkt);
+        pthread_cond_broadcast(&m_cond);
+        ret = 0;
+    }
+    pthread_mutex_unlock(&m_mutex);
+    return ret;
+}
+
+void MPEG2fixup::ShowStageStats(std::chrono::steady_clock::time_point start,
+                                bool pipelined)
+{
+    auto secs = [](std::chrono::microseconds t) { return t.count() / 1000000.0; };
+    auto rate = [](double n, std::chrono::microseconds t)
+        { return t.count() > 0 ? n * 1000000.0 / t.count() : 0.0; };
+    auto total = std::chrono::duration_cast<std::chrono::microseconds>
+        (std::chrono::steady_clock::now() - start);
+
+    std::chrono::microseconds readBusy = m_reader.m_readTime;
+    std::chrono::microseconds procBusy =
+        total - m_reader.m_emptyWait - m_muxWait;
+    if (!pipelined)
+        procBusy -= m_reader.m_readTime;
+    std::chrono::microseconds writeBusy = m_rx.m_runTime - m_rx.m_waitTime;
+    double written = static_cast<double>(QFileInfo(m_rx.m_outfile).size());
+
+    LOG(VB_GENERAL, LOG_INFO,
+        QString("Lossless transcode took %1s (%2)")
+            .arg(secs(total), 0, 'f', 1)
+            .arg(pipelined ? "pipelined" : "serial"));
+    LOG(VB_GENERAL, LOG_INFO,
+        QString("  read:    %1 packets, %2 MB/s, %3s busy, %4s waiting on "
+                "a full queue")
+            .arg(m_reader.m_packets)
+            .arg(rate(m_reader.m_bytes / 1048576.0, readBusy), 0, 'f', 1)
+            .arg(secs(readBusy), 0, 'f', 1)
+            .arg(secs(m_reader.m_fullWait), 0, 'f', 1));
+    LOG(VB_GENERAL, LOG_INFO,
+        QString("  process: %1 frames/s, %2s busy, %3 frames re-encoded in "
+                "%4s, %5s waiting for input, %6s waiting on the writer")
+            .arg(rate(m_frameNum, procBusy), 0, 'f', 1)
+            .arg(secs(procBusy), 0, 'f', 1)
+            .arg(m_reencodedFrames)
+            .arg(secs(m_reencodeTime), 0, 'f', 1)
+            .arg(secs(m_reader.m_emptyWait), 0, 'f', 1)
+            .arg(secs(m_muxWait), 0, 'f', 1));
+    LOG(VB_GENERAL, LOG_INFO,
+        QString("  write:   %1 MB/s, %2s busy, %3s waiting for frames")
+            .arg(rate(written / 1048576.0, writeBusy), 0, 'f', 1)
+            .arg(secs(writeBusy), 0, 'f', 1)
+            .arg(secs(m_rx.m_waitTime), 0, 'f', 1));
+}
+
 #define INDEX_BUF (sizeof(index_unit) * 200)
 void MPEG2fixup::InitReplex()
 {
@@ -768,8 +989,11 @@ int MPEG2fixup::AddFrame(MPEG2frame *f)
             return 1;
         }
 
+        auto start = std::chrono::steady_clock::now();
         pthread_cond_signal(&m_rx.m_cond);
         pthread_cond_wait(&m_rx.m_cond, &m_rx.m_mutex);
+        m_muxWait += std::chrono::duration_cast<std::chrono::microseconds>
+            (std::chrono::steady_clock::now() - start);
 
         FrameInfo(f);
     }
@@ -1421,9 +1645,8 @@ int MPEG2fixup::GetFrame(AVPacket *pkt)
 
         while (!done)
         {
-            pkt->pts = AV_NOPTS_VALUE;
-            pkt->dts = AV_NOPTS_VALUE;
-            int ret = av_read_frame(m_inputFC, pkt);
+            int duration = 0;
+            int ret = m_reader.Read(pkt, duration);
 
             if (ret < 0)
             {
@@ -1453,11 +1676,19 @@ int MPEG2fixup::GetFrame(AVPacket *pkt)
                 return 1;
             }
 
-            if (pkt->stream_index == m_vidId ||
-                  m_aFrame.contains(pkt->stream_index))
+            if (pkt->stream_index == m_vidId)
+            {
                 done = true;
-            else 
+            }
+            else if (m_aFrame.contains(pkt->stream_index))
+            {
+                m_parserDuration[pkt->stream_index] = duration;
+                done = true;
+            }
+            else
+            {
                 av_packet_unref(pkt);
+            }
         }
         pkt->duration = m_frameNum++;
         if ((m_showProgress || m_updateStatus) &&
@@ -1824,6 +2055,7 @@ MPEG2frame *MPEG2fixup::DecodeToFrame(int frameNum, int skip_reset)
 
 int MPEG2fixup::ConvertToI(FrameList *orderedFrames, int headPos)
 {
+    auto start = std::chrono::steady_clock::now();
     MPEG2frame *spare = nullptr;
     AVPacket *pkt = av_packet_alloc();
     if (pkt == nullptr)
@@ -1879,6 +2111,7 @@ int MPEG2fixup::ConvertToI(FrameList *orderedFrames, int headPos)
         LOG(VB_GENERAL, LOG_INFO,
             QString("Converting frame #%1 from %2 to I %3")
                 .arg(i).arg(GetFrameTypeT(spare)).arg(fname));
+        m_reencodedFrames++;
 
         spare->set_pkt(pkt);
         av_packet_unref(pkt);
@@ -1889,12 +2122,15 @@ int MPEG2fixup::ConvertToI(FrameList *orderedFrames, int headPos)
     //reorder frames
     m_vFrame.move(headPos, headPos + orderedFrames->count() - 1);
     av_packet_free(&pkt);
+    m_reencodeTime += std::chrono::duration_cast<std::chrono::microseconds>
+        (std::chrono::steady_clock::now() - start);
     return 0;
 }
 
 int MPEG2fixup::InsertFrame(int frameNum, int64_t deltaPTS,
                             int64_t ptsIncrement, int64_t initPTS)
 {
+    auto start = std::chrono::steady_clock::now();
     MPEG2frame *spare = nullptr;
     int increment = 0;
     int index = 0;
@@ -1934,6 +2170,7 @@ int MPEG2fixup::InsertFrame(int frameNum, int64_t deltaPTS,
             QString("Inserting %1 I-Frames after #%2 %3")
                 .arg((int)(deltaPTS / ptsIncrement))
                 .arg(GetFrameNum(spare)).arg(fname));
+        m_reencodedFrames++;
     }
     
     inc2x33(&pkt->pts, (ptsIncrement * GetNbFields(spare) / 2) + initPTS);
@@ -1966,6 +2203,8 @@ int MPEG2fixup::InsertFrame(int frameNum, int64_t deltaPTS,
     index++;
     RenumberFrames(index, increment);
 
+    m_reencodeTime += std::chrono::duration_cast<std::chrono::microseconds>
+        (std::chrono::steady_clock::now() - start);
     return increment;
 }
 
@@ -2133,6 +2372,7 @@ int MPEG2fixup::Start()
         return GENERIC_EXIT_NOT_OK;
     }
 
+    auto startTime = std::chrono::steady_clock::now();
     if (!InitAV(m_infile, m_format, 0))
     {
         av_packet_free(&pkt);
@@ -2146,6 +2386,16 @@ int MPEG2fixup::Start()
         return GENERIC_EXIT_NOT_OK;
     }
 
+    // Demux ahead on a separate thread while the frames are fixed up here
+    // and multiplexed on the replex thread
+    m_reader.Init(m_inputFC);
+    if (m_pipelined)
+    {
+        QList<int> streams = m_aFrame.keys();
+        streams.append(m_vidId);
+        m_reader.Start(streams);
+    }
+
     if (!FindStart())
     {
         av_packet_free(&pkt);
@@ -2623,7 +2873,8 @@ int MPEG2fixup::Start()
                 }
                 // What to do if the CC is corrupt?
                 // Just wait and hope it repairs itself
-                if (CC->sample_rate == 0 || !CPC || CPC->duration == 0)
+                int duration = m_parserDuration.value(it.key());
+                if (CC->sample_rate == 0 || duration == 0)
                     break;
 
                 // The order of processing frames is critical to making
@@ -2638,7 +2889,7 @@ int MPEG2fixup::Start()
                 //   if we get this far, update the expected PTS, and write out
                 //     the audio frame
                 int64_t incPTS =
-                         90000LL * (int64_t)CPC->duration / CC->sample_rate;
+                         90000LL * (int64_t)duration / CC->sample_rate;
 
                 if (poq.UpdateOrigPTS(it.key(), origaPTS[it.key()],
                                                   af->constFirst()->m_pkt) < 0)
@@ -2709,7 +2960,7 @@ int MPEG2fixup::Start()
                 }
 
                 int64_t nextPTS = add2x33(af->constFirst()->m_pkt->pts,
-                           90000LL * (int64_t)CPC->duration / CC->sample_rate);
+                           90000LL * (int64_t)duration / CC->sample_rate);
 
                 if ((cutState[it.key()] == 1 &&
                      cmp2x33(nextPTS, cutStartPTS) > 0) ||
@@ -2775,6 +3026,9 @@ int MPEG2fixup::Start()
     int ex = REENCODE_OK;
     void *errors = nullptr; // mythtv#244: return error if any write or close failures
     pthread_join(m_thread, &errors);
+    bool pipelined = m_reader.IsRunning();
+    m_reader.Stop();
+    ShowStageStats(startTime, pipelined);
     if (*(int *)errors) {
       LOG(VB_GENERAL, LOG_ERR,
 	  QString("joined thread failed with %1 write errors")
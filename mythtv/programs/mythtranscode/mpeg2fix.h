@@ -2,6 +2,7 @@
 #include <pthread.h>
 
 // C++
+#include <chrono>
 #include <cstdlib>
 
 extern "C"
@@ -110,10 +111,62 @@ class MPEG2replex
     AudioFrameArray m_extframe                {};
     sequence_t      m_seq_head                {};
 
+    //write stage statistics, only valid once the thread has been joined
+    std::chrono::steady_clock::time_point m_startTime;
+    std::chrono::microseconds m_runTime      {0};
+    std::chrono::microseconds m_waitTime     {0};
+
   private:
     multiplex_t    *m_mplex                   {nullptr};
 };
 
+//demuxes the input on its own thread, up to kReadAhead packets ahead of
+//the frame processing.  Without Start() it reads on the caller's thread.
+class MPEG2reader
+{
+  public:
+    static constexpr int kReadAhead { 256 };
+
+    MPEG2reader();
+    ~MPEG2reader();
+    void Init(AVFormatContext *fc) { m_fc = fc; }
+    void Start(const QList<int> &streams);
+    void Stop();
+    bool IsRunning() const { return m_running; }
+    int Read(AVPacket *pkt, int &parserDuration);
+
+    //read stage statistics
+    uint64_t                  m_packets   {0};
+    uint64_t                  m_bytes     {0};
+    std::chrono::microseconds m_readTime  {0};
+    std::chrono::microseconds m_fullWait  {0};
+    //time the consumer spent waiting for packets
+    std::chrono::microseconds m_emptyWait {0};
+
+  private:
+    struct Entry
+    {
+        AVPacket *m_pkt;
+        int       m_duration;
+    };
+
+    static void *ReaderStart(void *data);
+    void Run();
+    int ReadPacket(AVPacket *pkt, int &parserDuration);
+
+    AVFormatContext *m_fc        {nullptr};
+    QList<int>       m_streams;
+    QQueue<Entry>    m_queue;
+    QQueue<AVPacket *> m_free;
+    pthread_t        m_thread    {};
+    pthread_mutex_t  m_mutex     {};
+    pthread_cond_t   m_cond      {};
+    bool             m_running   {false};
+    bool             m_stop      {false};
+    bool             m_finished  {false};
+    int              m_lastError {0};
+};
+
 using FrameList  = QList<MPEG2frame *>;
 using FrameQueue = QQueue<MPEG2frame *>;
 using FrameMap   = QMap<int, FrameList *>;
@@ -132,6 +185,7 @@ class MPEG2fixup
     int BuildKeyframeIndex(const QString &file, frm_pos_map_t &posMap, frm_pos_map_t &durMap);
 
     void SetAllAudio(bool keep) { m_allAudio = keep; }
+    void SetPipelined(bool pipelined) { m_pipelined = pipelined; }
 
     static void dec2x33(int64_t *pts1, int64_t pts2);
     static void inc2x33(int64_t *pts1, int64_t pts2);
@@ -147,6 +201,8 @@ class MPEG2fixup
   private:
     static int FindMPEG2Header(const uint8_t *buf, int size, uint8_t code);
     void InitReplex();
+    void ShowStageStats(std::chrono::steady_clock::time_point start,
+                        bool pipelined);
     void FrameInfo(MPEG2frame *f);
     int AddFrame(MPEG2frame *f);
     bool InitAV(const QString& inputfile, const char *type, int64_t offset);
@@ -238,6 +294,10 @@ class MPEG2fixup
 
     pthread_t     m_thread          {};
 
+    MPEG2reader      m_reader;
+    //parser duration of the last packet read from each audio stream
+    QMap <int, int>  m_parserDuration;
+
     MythCodecMap     m_codecMap;
     AVFormatContext *m_inputFC      {nullptr};
     AVFrame         *m_picture      {nullptr};
@@ -256,6 +316,7 @@ class MPEG2fixup
     QString         m_infile;
     const char     *m_format        {nullptr};
     bool            m_allAudio      {false};
+    bool            m_pipelined     {true};
 
     //complete?
     bool            m_fileEnd       {false};
@@ -268,6 +329,11 @@ class MPEG2fixup
     int             m_frameNum              {0};
     int             m_statusUpdateTime      {5};
     uint64_t        m_lastWrittenPos        {0};
+
+    //process stage statistics
+    int                       m_reencodedFrames {0};
+    std::chrono::microseconds m_reencodeTime    {0};
+    std::chrono::microseconds m_muxWait         {0};
 };
 
 #ifdef NO_MYTH
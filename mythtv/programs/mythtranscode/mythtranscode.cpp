@@ -615,6 +615,11 @@ int main(int argc, char *argv[])
             m2f->SetAllAudio(true);
         }
 
+        if (cmdline.toBool("nopipeline"))
+        {
+            m2f->SetPipelined(false);
+        }
+
         if (build_index)
         {
             int err = BuildKeyframeIndex(m2f, infile, posMap, durMap, jobID);
@@ -42,6 +42,10 @@ void MythTranscodeCommandLineParser::LoadArguments(void)
         ->SetGroup("Encoding");
     add("--avf", "avf", false, "Generate libavformat output file.", "")
         ->SetGroup("Encoding");
+    add("--nopipeline", "nopipeline", false,
+            "Read the input on the same thread as the lossless transcode "
+            "instead of ahead of it.", "")
+        ->SetGroup("Encoding");
 
     add(QStringList{"-f", "--fifodir"}, "fifodir", "",
             "Directory in which to write fifos to.", "")
@@ -279,9 +279,11 @@ static HostCheckBoxSetting *TruncateDeletes()
     hc->setLabel(QObject::tr("Delete files slowly"));
     hc->setValue(false);
     hc->setHelpText(QObject::tr("Some filesystems use a lot of resources when "
-                    "deleting large files. If enabled, this option makes "
-                    "MythTV delete files slowly on this backend to lessen the "
-                    "impact."));
+                    "deleting large files. MythTV always frees the space of "
+                    "deleted files a piece at a time, more slowly while "
+                    "recordings are written to the same disk. If enabled, "
+                    "this option makes MythTV delete files slowly on this "
+                    "backend at all times to lessen the impact further."));
     return hc;
 };
 
@@ -296,6 +298,18 @@ static GlobalCheckBoxSetting *DeletesFollowLinks()
     return gc;
 };
 
+static GlobalCheckBoxSetting *ThumbStripGenerate()
+{
+    auto *gc = new GlobalCheckBoxSetting("ThumbStripGenerate");
+    gc->setLabel(QObject::tr("Generate seek thumbnails for recordings"));
+    gc->setValue(true);
+    gc->setHelpText(QObject::tr("If enabled, a strip of small thumbnails is "
+                    "made from the keyframes of each finished recording. "
+                    "The recording editor and the Services API use it to "
+                    "preview positions without decoding the video."));
+    return gc;
+};
+
 static GlobalSpinBoxSetting *HDRingbufferSize()
 {
     auto *bs = new GlobalSpinBoxSetting(
@@ -639,6 +653,44 @@ static HostSpinBoxSetting *JobQueueCheckFrequency()
     return gc;
 };
 
+static HostSpinBoxSetting *JobQueueMaxCPULoad()
+{
+    auto *gc = new HostSpinBoxSetting("JobQueueMaxCPULoad", -1, 400, 10);
+    gc->setLabel(QObject::tr("Maximum CPU load for new jobs (%)"));
+    gc->setHelpText(QObject::tr("New jobs will wait while the load average "
+                    "is above this percentage of the available CPUs. "
+                    "The load average also counts processes waiting on "
+                    "disks, so on busy systems jobs may wait for a long "
+                    "time. Set to -1 to start jobs regardless of the "
+                    "CPU load."));
+    gc->setValue(-1);
+    return gc;
+};
+
+static HostSpinBoxSetting *JobQueueMaxDiskBusy()
+{
+    auto *gc = new HostSpinBoxSetting("JobQueueMaxDiskBusy", 0, 100, 5);
+    gc->setLabel(QObject::tr("Maximum storage utilization for new jobs (%)"));
+    gc->setHelpText(QObject::tr("New jobs will wait while any disk holding "
+                    "a storage group on this backend is busy for more than "
+                    "this percentage of the time. Set to 0 to start jobs "
+                    "regardless of disk activity."));
+    gc->setValue(0);
+    return gc;
+};
+
+static HostSpinBoxSetting *JobQueueMaxRecordings()
+{
+    auto *gc = new HostSpinBoxSetting("JobQueueMaxRecordings", -1, 32, 1);
+    gc->setLabel(QObject::tr("Maximum recordings in progress for new jobs"));
+    gc->setHelpText(QObject::tr("New jobs will wait while more than this "
+                    "many recordings are being made on this backend. "
+                    "Set to 0 to only start jobs when nothing is recording, "
+                    "or -1 to start jobs regardless of recordings."));
+    gc->setValue(-1);
+    return gc;
+};
+
 static HostComboBoxSetting *JobQueueCPU()
 {
     auto *gc = new HostComboBoxSetting("JobQueueCPU");
@@ -980,6 +1032,7 @@ BackendSettings::BackendSettings()
     fm->addChild(DeletesFollowLinks());
     fm->addChild(TruncateDeletes());
     fm->addChild(HDRingbufferSize());
+    fm->addChild(ThumbStripGenerate());
     fm->addChild(StorageScheduler());
     group2->addChild(fm);
     auto* upnp = new GroupSetting();
@@ -1044,6 +1097,9 @@ BackendSettings::BackendSettings()
     group5->addChild(JobQueueWindowStart());
     group5->addChild(JobQueueWindowEnd());
     group5->addChild(JobQueueCPU());
+    group5->addChild(JobQueueMaxCPULoad());
+    group5->addChild(JobQueueMaxDiskBusy());
+    group5->addChild(JobQueueMaxRecordings());
     group5->addChild(JobAllowMetadata());
     group5->addChild(JobAllowCommFlag());
     group5->addChild(JobAllowTranscode());